@@ -0,0 +1,614 @@
+/**
+ * @file pyhelios_cpu_radiation.h
+ * @brief CPU ray-tracing radiation engine used by the PyHelios CPU radiation backend
+ *
+ * Implements the subset of RadiationModel needed to run radiation bands without CUDA/OptiX:
+ * collimated, sphere and sun-sphere sources, isotropic diffuse sky flux, thermal emission and
+ * multiple scattering. Rays are traced against the shared geometry BVH (pyhelios_geometry_cache.h)
+ * on a thread pool. Optical properties follow the Helios conventions: primitive data
+ * "reflectivity_<band>", "transmissivity_<band>" and "emissivity_<band>" (defaults 0, 0, 1) and
+ * "temperature" in Kelvin (default 300). Absorbed flux per band is written back to the primitive
+ * data "radiation_flux_<band>" in W/m^2. Cameras are rendered from the surface exitance of the
+ * last run of their bands.
+ *
+ * This is an internal C++ interface; the exported C API is in pyhelios_wrapper_cpuradiation.h.
+ */
+
+#ifndef PYHELIOS_CPU_RADIATION_H
+#define PYHELIOS_CPU_RADIATION_H
+
+#include "Context.h"
+#include "pyhelios_geometry_cache.h"
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace pyhelios {
+
+    //! Persistent worker threads shared by the parallel loops of one CPURadiationModel
+    class CPUWorkerPool;
+
+    enum class CPURadiationSourceType {
+        COLLIMATED,
+        SPHERE,
+        SUN_SPHERE
+    };
+
+    struct CPURadiationSource {
+        CPURadiationSourceType type = CPURadiationSourceType::COLLIMATED;
+        helios::vec3 direction;       //!< Unit vector pointing toward the source (collimated and sun sphere)
+        helios::vec3 position;        //!< Sphere center (sphere sources)
+        float radius = 0.f;           //!< Sphere radius (sphere sources)
+        float half_angle = 0.f;       //!< Half of the angular width of the solar disk in radians (sun sphere)
+        float flux_scaling = 1.f;     //!< Multiplier applied to the band flux (sun sphere)
+        std::map<std::string, float> fluxes;  //!< Source flux per band; W/m^2 normal to the beam, or at the sphere surface
+        std::string spectrum;         //!< Global data label of the source spectrum, empty for a flat spectrum
+    };
+
+    struct CPURadiationBand {
+        size_t direct_ray_count = 100;   //!< Rays per primitive for each source
+        size_t diffuse_ray_count = 1000; //!< Rays per primitive face for sky diffuse and scattering
+        float diffuse_flux = 0.f;        //!< Isotropic sky flux on a horizontal unobstructed surface (W/m^2)
+        uint scattering_depth = 0;       //!< Number of scattering bounces
+        float min_scatter_energy = 0.1f; //!< Faces whose outgoing flux is below this (W/m^2) do not scatter further
+        bool emission = true;            //!< Primitives emit epsilon*sigma*T^4 in this band
+        float target_error = 0.f;        //!< Adaptive tracing: area-weighted relative standard error to reach (0 = fixed ray counts)
+        size_t max_ray_count = 0;        //!< Adaptive tracing: budget of direct or diffuse rays per primitive summed over rounds
+        float scattering_tolerance = 0.f; //!< Stop scattering once the power left to scatter is below this fraction of the injected power (0 = run to scattering_depth)
+        float wavelength_min = 0.f;      //!< Wavelength range in nm for spectral optical properties (both 0 = no range)
+        float wavelength_max = 0.f;
+    };
+
+    //! Sampling effort of the last run of a band
+    struct CPURadiationBandStats {
+        size_t rounds = 0;            //!< Independent tracing rounds averaged
+        size_t direct_rays = 0;       //!< Direct rays per primitive and source, summed over rounds
+        size_t diffuse_rays = 0;      //!< Diffuse rays per primitive face, summed over rounds
+        float relative_error = -1.f;  //!< Area-weighted relative standard error of the absorbed flux (-1 if fewer than 2 rounds)
+        uint scattering_passes = 0;   //!< Scattering/emission passes traced (last round)
+        float scattering_residual = 0.f;  //!< Power reflected or transmitted but not traced further, relative to the injected power (last round)
+    };
+
+    //! Progress and cancellation of a runBands call, shared with the thread that observes it
+    struct CPURadiationRunMonitor {
+        std::atomic<bool> cancel{false};   //!< Set to stop the run at the next checkpoint
+        std::atomic<float> progress{0.f};  //!< Fraction of the run completed, from 0 to 1
+    };
+
+    /**
+     * @brief Pinhole or thin-lens camera
+     *
+     * Pixels see the exitance of the first surface hit: the reflected, transmitted and emitted flux
+     * leaving the visible face in the last run of each band (W/m^2, i.e. pi times the Lambertian
+     * radiance). Rays that miss all geometry see the band's sky diffuse flux above the horizon.
+     */
+    struct CPURadiationCamera {
+        helios::vec3 position;
+        helios::vec3 lookat;
+        std::vector<std::string> band_labels;
+        uint width = 512;
+        uint height = 512;
+        float HFOV = 20.f;                 //!< Horizontal field of view (degrees)
+        float FOV_aspect_ratio = 1.f;      //!< Horizontal over vertical field of view
+        float lens_diameter = 0.f;         //!< Thin lens diameter (0 = pinhole)
+        float focal_plane_distance = 1.f;  //!< Distance to the plane in focus
+        uint antialiasing_samples = 1;     //!< Rays per pixel
+        bool tiled_only = false;           //!< Rendered only through renderCameraTiles; never holds pixels
+        std::map<std::string, std::vector<float>> pixels;  //!< Per band, row-major from the top-left pixel
+    };
+
+    class CPURadiationModel {
+    public:
+        explicit CPURadiationModel(helios::Context* context);
+        ~CPURadiationModel();
+
+        helios::Context* getContext() const {
+            return context;
+        }
+
+        void setMessageFlag(bool flag) {
+            message_flag = flag;
+        }
+
+        //! Number of worker threads (0 = hardware concurrency)
+        void setThreadCount(int num_threads);
+
+        //! Seed of the per-primitive random streams; a given seed reproduces a run exactly up to summation order
+        void setSeed(uint64_t seed) {
+            random_seed = seed;
+        }
+
+        void addBand(const std::string& label);
+
+        /**
+         * @brief Add a band whose optical properties may be integrated from spectra
+         * Primitives without "reflectivity_<band>" / "transmissivity_<band>" data use the band average of the
+         * spectra named by their "reflectivity_spectrum" / "transmissivity_spectrum" string data. Spectra are
+         * Context global data of type vec2 (wavelength in nm, value), linear between samples and constant
+         * beyond the first and last sample. Averages are weighted by the spectrum of the first source that
+         * has one (setSourceSpectrum), or uniformly. Source fluxes are still set per band.
+         * @param wavelength_min Lower band edge (nm)
+         * @param wavelength_max Upper band edge (nm)
+         */
+        void addBand(const std::string& label, float wavelength_min, float wavelength_max);
+        void copyBand(const std::string& old_label, const std::string& new_label);
+        bool doesBandExist(const std::string& label) const;
+
+        //! Look up a band; throws std::runtime_error if it does not exist
+        CPURadiationBand& getBand(const std::string& label);
+        const CPURadiationBand& getBand(const std::string& label) const;
+
+        uint addCollimatedSource(const helios::vec3& direction);
+        uint addSphereSource(const helios::vec3& position, float radius);
+
+        /**
+         * @brief Add a sun sphere source
+         * Traced as a collimated beam whose direction is jittered over the solar disk, so shadows have a penumbra.
+         * @param zenith Solar zenith angle (degrees)
+         * @param azimuth Solar azimuth angle, clockwise from +y (degrees)
+         * @param angular_width Angular diameter of the solar disk (degrees)
+         * @param flux_scaling Multiplier applied to the band flux
+         */
+        uint addSunSphereSource(float zenith, float azimuth, float angular_width, float flux_scaling);
+
+        void setSourceFlux(uint source_id, const std::string& band_label, float flux);
+        float getSourceFlux(uint source_id, const std::string& band_label) const;
+
+        //! Weight spectral property averages by a source spectrum (Context global data label, "" = flat)
+        void setSourceSpectrum(uint source_id, const std::string& spectrum_label);
+
+        /**
+         * @brief Band average of a spectrum weighted by another, from the spectral integration cache
+         * The first use of a (spectrum, weight) pair builds a table of cumulative integrals over the merged
+         * wavelength samples of both spectra; afterwards any wavelength range is integrated exactly with two
+         * binary searches, so sweeping many narrow bands over the same materials does not re-integrate.
+         * Lookups use the cached table as is; tables are checked against the global data behind them at the
+         * start of each band run and rebuilt when it changed.
+         * @param spectrum_label Global data label of the spectrum to average
+         * @param weight_label Global data label of the weighting spectrum ("" = flat)
+         * @param wavelength_min Lower edge (nm)
+         * @param wavelength_max Upper edge (nm)
+         */
+        float averageSpectrum(const std::string& spectrum_label, const std::string& weight_label, float wavelength_min, float wavelength_max);
+
+        //! Number of spectrum tables in the spectral integration cache
+        size_t getSpectralCacheSize() const;
+
+        //! Set the isotropic sky flux of a band (W/m^2)
+        void setDiffuseFlux(const std::string& band_label, float flux);
+
+        /**
+         * @brief Cache per-source unit-flux responses so flux changes do not require re-tracing
+         *
+         * When enabled, runBands traces each source and the sky at unit flux (plus emission on its own)
+         * and stores the absorbed flux of every component. Absorbed flux is linear in source and sky
+         * flux, so after setSourceFlux or setDiffuseFlux the results and "radiation_flux_<band>" data
+         * are recomputed as a weighted sum the next time they are read. Changing geometry, optical
+         * properties, temperatures, sources or other band settings still requires runBands.
+         * min_scatter_energy is not applied to cached responses, since the cutoff is not linear.
+         * Disabling the mode drops the cached responses.
+         */
+        void setFluxSuperposition(bool enable);
+
+        /**
+         * @brief Build a sparse face-to-face exchange operator on the next run and reuse it afterwards
+         *
+         * For static scenes, sky diffuse and scattering/emission passes are then solved with sparse
+         * mat-vec products instead of tracing rays. The operator is built with the diffuse ray count of
+         * the first band run after enabling it, and is kept until updateGeometry or disableViewFactorOperator.
+         * Direct radiation from sources is still traced on every run. Bands with a target error
+         * (adaptive ray counts) keep tracing diffuse radiation, so their reported error stays a sampling error.
+         * @param tolerance Exchange fractions below this are dropped
+         * @param max_bytes Memory cap, enforced while the operator is built: only the exchange fractions
+         *        above a minimum ray count are kept (0 = no cap). Transposing the kept entries briefly needs
+         *        about twice the cap.
+         */
+        void enableViewFactorOperator(float tolerance, size_t max_bytes);
+
+        //! Drop the exchange operator and trace diffuse radiation again
+        void disableViewFactorOperator();
+
+        //! Memory used by the exchange operator in bytes (0 if not built)
+        size_t getViewFactorOperatorBytes() const;
+
+        //! Number of stored face-to-face exchange fractions (0 if not built)
+        size_t getViewFactorOperatorNonzeros() const;
+
+        /**
+         * @brief Precompute the sunlit fraction of every primitive for a set of sun directions
+         *
+         * All directions are traced in one pass: each primitive samples ray_count points once and
+         * tests each direction for occlusion. Fractions are stored quantized to 8 bits (one byte per
+         * primitive and direction) and kept until updateGeometry or clearSunlitFractions. Afterwards,
+         * collimated sources whose direction is within max_angle of a cached direction are not traced:
+         * their direct flux is the cached fraction (interpolated between the two nearest cached
+         * directions) times the cosine of incidence. Other sources are traced as usual.
+         * @param directions Unit vectors pointing toward the sun, e.g. every timestep of a day or a sky dome
+         * @param ray_count Sample points per primitive
+         * @param max_angle Largest angle between a source and a cached direction served from the cache (radians)
+         */
+        void precomputeSunlitFractions(const std::vector<helios::vec3>& directions, size_t ray_count, float max_angle);
+
+        //! Drop the sunlit fraction cache and trace every source again
+        void clearSunlitFractions();
+
+        //! Memory used by the sunlit fraction cache in bytes (0 if not built)
+        size_t getSunlitFractionBytes() const;
+
+        /**
+         * @brief Make rays leaving the scene through its lateral sides re-enter from the opposite side
+         * Approximates an infinite canopy from one representative tile. The period is the extent of the
+         * geometry's bounding box along each axis. Direct, diffuse and scattered rays wrap around (up to 64
+         * times); camera rays do not.
+         * @param boundary "x", "y", "xy", or "" to disable
+         */
+        void enforcePeriodicBoundary(const std::string& boundary);
+
+        //! Include every primitive in the Context
+        void updateGeometry();
+
+        //! Include only the given primitives (others neither absorb nor occlude)
+        void updateGeometry(const std::vector<uint>& uuids);
+
+        /**
+         * @brief Bring the current scope up to date with the primitives changed since the last update
+         *
+         * Vertex-only changes refit the scene in place and re-measure only the modified primitives;
+         * added or deleted primitives re-lay out the scene but read only the added ones from the Context.
+         * @return Number of added/modified/deleted primitives that triggered the update (0 if skipped)
+         */
+        size_t updateGeometryDirty();
+
+        /**
+         * @brief Trace the given bands and write "radiation_flux_<band>" primitive data
+         * Bands with equal direct and diffuse ray counts are traced together: each ray carries one energy
+         * per band, so traversal is shared while optical properties, fluxes and scattering depth stay
+         * per band. Results are the same as running the bands one at a time.
+         */
+        void runBands(const std::vector<std::string>& labels);
+
+        //! Inputs of a run read from the Context, and the bands it has traced so far (see prepareRun)
+        struct PreparedRun;
+
+        /**
+         * @brief Split form of runBands for tracing on another thread
+         * prepareRun reads everything the run needs from the Context (optical properties, temperatures and
+         * spectra) on the calling thread. traceRun then uses only the model and the prepared inputs, so it may
+         * run on a worker thread while the caller keeps using the Context but not the model. writeRunFluxData
+         * writes "radiation_flux_<band>" of the bands traced so far on the Context's thread; a cancelled or
+         * failed traceRun keeps the bands finished before it stopped. runBands calls the three in order.
+         */
+        std::unique_ptr<PreparedRun> prepareRun(const std::vector<std::string>& labels);
+        void traceRun(PreparedRun& run);
+        void writeRunFluxData(const PreparedRun& run);
+
+        /**
+         * @brief Report the progress of runBands to a monitor, and let it cancel the run
+         * Progress advances after the direct, sky diffuse and each scattering pass of every band group and
+         * adaptive round. The cancel flag is checked at the same points; a cancelled run throws
+         * std::runtime_error. Bands whose traversal finished before that keep their new results, the others
+         * keep the results of their previous run.
+         * @param monitor Monitor updated by later runs, or nullptr to stop reporting
+         */
+        void setRunMonitor(CPURadiationRunMonitor* monitor) {
+            run_monitor = monitor;
+        }
+
+        //! Add a camera, or replace the camera with the same label (rendered pixels are dropped, the tiled-only flag is kept)
+        void addCamera(const std::string& label, const CPURadiationCamera& camera);
+        bool doesCameraExist(const std::string& label) const;
+
+        //! Look up a camera; throws std::runtime_error if it does not exist
+        const CPURadiationCamera& getCamera(const std::string& label) const;
+
+        /**
+         * @brief Restrict a camera to streamed rendering through renderCameraTiles
+         * runBands and renderCameras skip a tiled-only camera, so its full frame is never allocated;
+         * enabling the flag drops pixels rendered earlier.
+         */
+        void setCameraTiledOnly(const std::string& label, bool tiled_only);
+
+        /**
+         * @brief Render cameras from the last run of their bands
+         * Primary rays of all listed cameras are scheduled together on the thread pool against the
+         * shared BVH, and each ray shades every band of its camera. runBands calls this for the cameras
+         * that observe any band it ran. Bands not run since the last geometry update are skipped.
+         * @param labels Camera labels (empty = all cameras except tiled-only ones; listing a tiled-only camera throws)
+         */
+        void renderCameras(const std::vector<std::string>& labels);
+
+        //! Receives one band of a finished tile; pixels are row-major, tile_width * tile_height values
+        typedef std::function<void(const std::string& band_label, uint x0, uint y0, uint tile_width, uint tile_height, const float* pixels)> CameraTileWriter;
+
+        /**
+         * @brief Render one camera tile by tile, streaming each finished tile to a writer
+         * The frame is never stored (the camera's pixel data is left untouched): tiles are rendered in
+         * waves of a few tiles per worker thread, and each wave is handed to the writer in row-major tile
+         * order on the calling thread, so peak memory scales with the tile size instead of the frame size.
+         * Exceptions thrown by the writer stop rendering and propagate to the caller.
+         * @param label Camera label
+         * @param tile_width Tile width in pixels (edge tiles are clipped to the frame)
+         * @param tile_height Tile height in pixels
+         * @param writer Called once per tile and rendered band
+         */
+        void renderCameraTiles(const std::string& label, uint tile_width, uint tile_height, const CameraTileWriter& writer);
+
+        /**
+         * @brief Rendered pixels of one camera band, row-major from the top-left pixel
+         * Throws std::runtime_error if the camera does not exist or the band has not been rendered.
+         */
+        const std::vector<float>& getCameraPixelData(const std::string& camera, const std::string& band_label) const;
+
+        /**
+         * @brief Sampling effort and achieved error of the last run of a band
+         * Throws std::runtime_error if the band does not exist or has not been run.
+         */
+        const CPURadiationBandStats& getBandStats(const std::string& label) const;
+
+        /**
+         * @brief Absorbed flux summed over all bands run so far, one entry per Context primitive in getAllUUIDs order
+         * Primitives outside the geometry scope, or added after the last updateGeometry, report 0.
+         */
+        std::vector<float> getTotalAbsorbedFlux();
+
+        /**
+         * @brief Absorbed flux of one band, one entry per Context primitive in getAllUUIDs order
+         * Throws std::runtime_error if the band does not exist.
+         */
+        std::vector<float> getAbsorbedFlux(const std::string& band_label);
+
+        /**
+         * @brief Absorbed power and area of one band summed per group of primitives, in one parallel pass
+         * Primitives not listed, or without flux from the last run of the band, are left out. The
+         * area-weighted mean flux of a group is power[g] / area[g].
+         * @param band_label Band label; throws std::runtime_error if it does not exist
+         * @param uuids Primitives to aggregate
+         * @param groups Group index of each entry of uuids, smaller than group_count
+         * @param group_count Number of groups
+         * @param power Output: sum of flux times area per group (W)
+         * @param area Output: summed area per group (m^2)
+         */
+        void aggregateAbsorbedFlux(const std::string& band_label, const std::vector<uint>& uuids, const std::vector<uint>& groups,
+                                   size_t group_count, std::vector<double>& power, std::vector<double>& area);
+
+        /**
+         * @brief Absorbed power and area of one band summed per parent Context object
+         * Primitives that do not belong to an object are left out.
+         * @param band_label Band label; throws std::runtime_error if it does not exist
+         * @param object_ids Output: object IDs in ascending order
+         * @param power Output: sum of flux times area per object (W)
+         * @param area Output: summed area per object (m^2)
+         */
+        void aggregateAbsorbedFluxByObject(const std::string& band_label, std::vector<uint>& object_ids,
+                                           std::vector<double>& power, std::vector<double>& area);
+
+    private:
+
+        //! Receiving primitive in the geometry scope
+        struct ScenePrimitive {
+            uint uuid;
+            uint32_t index;       //!< Index in GeometryBVH::primitive_uuids
+            helios::vec3 normal;  //!< Unit normal of the top face
+            float area;
+            uint parent_object;   //!< Parent Context object (0 if none)
+            uint32_t first_triangle;  //!< Offset into scene_triangles
+            uint32_t triangle_count;
+        };
+
+        //! Optical properties of a primitive (same for both faces) read from primitive data at run time
+        struct ScenePrimitiveOptics {
+            float reflectivity, transmissivity, absorptivity, emitted;
+        };
+
+        //! Absorbed flux of one band run, parallel to the scene primitives at the time of the run
+        struct BandResult {
+            std::vector<uint> uuids;
+            std::vector<float> flux;
+            std::vector<float> areas;     //!< Primitive areas in m^2
+            std::vector<uint> objects;    //!< Parent object of each primitive (0 if none)
+            std::vector<float> exitance;  //!< Flux leaving each face (2 per primitive, top first) in W/m^2
+        };
+
+        //! Cumulative integral of a spectrum times a weighting spectrum over their merged wavelength samples
+        struct SpectralTable {
+            std::vector<helios::vec2> spectrum;  //!< Global data the table was built from, to detect changes
+            std::vector<helios::vec2> weight;
+            std::vector<float> wavelengths;      //!< Merged sample wavelengths (nm)
+            std::vector<float> spectrum_values;  //!< Spectrum at each merged wavelength
+            std::vector<float> weight_values;
+            std::vector<double> prefix;          //!< Integral from the first wavelength to each merged wavelength
+        };
+
+        //! Absorbed flux and exitance of one linear component of a band
+        struct ResponseComponent {
+            std::vector<float> flux;
+            std::vector<float> exitance;
+        };
+
+        //! Linear components of a band, parallel to the scene primitives at the time of the run
+        struct BandResponse {
+            std::vector<uint> uuids;
+            std::vector<ResponseComponent> sources;  //!< Per source, at unit band flux
+            ResponseComponent diffuse;               //!< At unit sky flux
+            ResponseComponent emission;
+        };
+
+        enum class ChannelKind {
+            BAND,          //!< All sources, sky and emission at the band settings
+            UNIT_SOURCE,   //!< One source at unit band flux
+            UNIT_DIFFUSE,  //!< Sky at unit flux
+            EMISSION       //!< Emission only
+        };
+
+        //! One energy carried by the rays of a traversal
+        struct BandChannel {
+            std::string label;
+            const CPURadiationBand* band;
+            ChannelKind kind;
+            uint source;  //!< Source index for UNIT_SOURCE
+        };
+
+        //! Sparse exchange fractions between primitive faces, stored as compressed rows per receiving face
+        struct ViewFactorOperator {
+            std::vector<uint64_t> row_offsets;  //!< Size face count + 1
+            std::vector<uint32_t> columns;      //!< Emitting face of each entry
+            std::vector<float> values;          //!< Fraction of the emitting face's power arriving at the receiving face
+            std::vector<float> sky;             //!< Per face: cosine-weighted fraction of rays escaping to the upper sky
+            size_t bytes() const {
+                return row_offsets.size() * sizeof(uint64_t) + columns.size() * sizeof(uint32_t) + values.size() * sizeof(float) + sky.size() * sizeof(float);
+            }
+        };
+
+        //! Per channel scattering convergence of one traversal
+        struct TraceConvergence {
+            std::vector<uint> passes;        //!< Scattering/emission passes in which the channel carried energy
+            std::vector<double> residual;    //!< Power scattered by the last pass but not traced further (W)
+            std::vector<double> injected;    //!< Power injected by sources, sky and emission (W)
+        };
+
+        //! Sunlit fraction of each primitive for a set of sun directions, quantized to 1/255
+        struct SunlitFractionCache {
+            std::vector<helios::vec3> directions;
+            std::vector<uint8_t> fractions;  //!< [primitive * directions.size() + direction]
+            float max_angle = 0.f;
+        };
+
+        //! Exitance of the bands rendered by a set of cameras, interleaved as [face * bands.size() + band]
+        struct CameraShading {
+            std::vector<std::string> bands;  //!< Bands whose last run matches the current scene
+            std::vector<float> face_values;
+            std::vector<float> sky;          //!< Diffuse flux per band, seen by rays leaving the scene above the horizon
+        };
+
+        //! Primary ray setup of one camera
+        struct CameraView {
+            const CPURadiationCamera* camera = nullptr;
+            std::vector<std::string> band_labels;  //!< Bands of the camera that can be rendered
+            std::vector<uint32_t> bands;           //!< Index of each of band_labels in CameraShading::bands
+            helios::vec3 forward, right, up;
+            float tan_x = 0.f;
+            float tan_y = 0.f;
+            uint64_t seed = 0;                     //!< Derived from the label, so a camera renders the same alone, in a batch or in tiles
+        };
+
+        //! Result of one traversal: absorbed flux per channel and primitive, exitance as [face * K + channel]
+        struct TraceResult {
+            std::vector<std::vector<double>> flux;
+            std::vector<double> exitance;
+        };
+
+        //! Channels traced in one traversal; per-face energy arrays are laid out as [face * size() + channel]
+        struct BandGroup {
+            std::vector<BandChannel> channels;
+            size_t size() const {
+                return channels.size();
+            }
+        };
+
+        void buildScene();
+        void layoutScene(const std::vector<std::pair<uint, uint>>& known_parents);
+        void measurePrimitive(ScenePrimitive& primitive);
+        void updateSceneBounds();
+        void resetSceneCaches();
+        void requireGeometry() const;
+        unsigned int workerCount(size_t work_items) const;
+        std::shared_ptr<CPUWorkerPool> workerPool() const;
+        void runBandGroup(const BandGroup& group, const std::vector<ScenePrimitiveOptics>& optics);
+        TraceResult traceGroup(const BandGroup& group, const std::vector<ScenePrimitiveOptics>& optics, uint64_t seed, TraceConvergence& convergence) const;
+        void applyResponse(const std::string& label);
+        void writeFluxData(const std::string& label);
+        void refreshStaleBands();
+        void reportProgress(size_t stage, size_t stage_count) const;
+        void storeResultGeometry(BandResult& result) const;
+        void reduceByGroup(const BandResult& result, const std::vector<uint32_t>& result_groups, size_t group_count,
+                           std::vector<double>& power, std::vector<double>& area) const;
+        CameraShading prepareCameraShading(const std::vector<std::string>& camera_labels) const;
+        CameraView makeCameraView(const std::string& label, const CameraShading& shading) const;
+        void shadeCameraPixel(const CameraView& view, const CameraShading& shading, uint i, uint j, float* value) const;
+        std::vector<ScenePrimitiveOptics> readOptics(const BandGroup& group);
+        std::vector<helios::vec2> readSpectrum(const std::string& label) const;
+        const SpectralTable& spectralTable(const std::string& spectrum_label, const std::string& weight_label);
+        void validateSpectralTables();
+        std::string bandWeightSpectrum() const;
+        void traceDirect(const BandGroup& group, uint64_t seed, std::vector<double>& incident) const;
+        bool lookupSunlitFraction(const helios::vec3& direction, uint32_t index[2], float weight[2]) const;
+        void traceSkyDiffuse(const BandGroup& group, uint64_t seed, std::vector<double>& incident) const;
+        void distribute(const BandGroup& group, const std::vector<double>& outgoing, std::vector<double>& incident, uint64_t pass, uint64_t seed) const;
+        void buildViewFactorOperator(size_t ray_count);
+        void applyViewFactorOperator(const BandGroup& group, const std::vector<double>& outgoing, std::vector<double>& incident) const;
+        //! True if the group solves diffuse exchange with the operator (never for adaptive bands)
+        bool usesViewFactors(const BandGroup& group) const;
+        helios::vec3 samplePoint(const ScenePrimitive& primitive, RandomStream& rng) const;
+
+        //! Closest hit along a ray, wrapping around periodic boundaries; t_hit is the distance traveled
+        bool traceRay(helios::vec3 origin, const helios::vec3& direction, float tmax, float& t_hit, uint32_t& triangle, uint32_t ignore_primitive) const;
+        bool occludedRay(const helios::vec3& origin, const helios::vec3& direction, float tmax, uint32_t ignore_primitive) const;
+
+        helios::Context* context;
+        bool message_flag = true;
+        unsigned int thread_count = 0;
+        uint64_t random_seed = 0;
+
+        //! Created on first use with the configured thread count; replaced by setThreadCount
+        mutable std::mutex worker_pool_mutex;
+        mutable std::shared_ptr<CPUWorkerPool> worker_pool;
+
+        std::map<std::string, CPURadiationBand> bands;
+        std::vector<CPURadiationSource> sources;
+
+        //! Spectral integration cache keyed by (spectrum label, weighting spectrum label); lookups trust it until validateSpectralTables
+        std::map<std::pair<std::string, std::string>, SpectralTable> spectral_tables;
+
+        // Geometry captured by updateGeometry
+        bool geometry_ready = false;
+        bool geometry_subset = false;
+        std::vector<uint> geometry_scope;   //!< Sorted UUIDs passed to updateGeometry(uuids)
+        std::shared_ptr<const GeometryBVH> bvh;
+        uint64_t synced_revision = 0;  //!< Revision the scene last synced with; ahead of bvh->revision if only out-of-scope primitives changed
+        std::vector<uint8_t> primitive_mask;  //!< Per BVH primitive index: 1 if in scope
+        std::vector<ScenePrimitive> primitives;
+        std::vector<uint32_t> scene_index;      //!< Per BVH primitive index: index into primitives, or NO_PRIMITIVE
+        std::vector<uint32_t> scene_triangles;  //!< BVH triangle indices grouped by scene primitive
+        std::vector<float> triangle_cdf;        //!< Cumulative area fraction within each primitive, parallel to scene_triangles
+        helios::vec3 scene_min;                 //!< Bounding box of the primitives in scope
+        helios::vec3 scene_max;
+
+        bool periodic_x = false;
+        bool periodic_y = false;
+
+        CPURadiationRunMonitor* run_monitor = nullptr;
+        double progress_begin = 0.0;  //!< Share of the monitored run before and after the current traversal
+        double progress_end = 1.0;
+
+        std::map<std::string, CPURadiationCamera> cameras;
+
+        std::map<std::string, BandResult> results;
+        std::map<std::string, CPURadiationBandStats> band_stats;
+
+        bool flux_superposition = false;
+
+        bool view_factor_enabled = false;
+        float view_factor_tolerance = 0.f;
+        size_t view_factor_max_bytes = 0;
+        bool view_factor_ready = false;
+        ViewFactorOperator view_factors;
+        SunlitFractionCache sunlit;
+        std::map<std::string, BandResponse> responses;
+        std::set<std::string> stale_bands;  //!< Bands with cached responses whose fluxes changed since results were computed
+    };
+
+    struct CPURadiationModel::PreparedRun {
+        std::vector<BandGroup> groups;
+        std::vector<std::vector<ScenePrimitiveOptics>> optics;  //!< Per group, read from the Context by prepareRun
+        std::vector<std::string> observing;                     //!< Cameras rendered after the traversal
+        std::vector<std::string> traced;                        //!< Bands with new results, written by writeRunFluxData
+    };
+
+} // namespace pyhelios
+
+#endif // PYHELIOS_CPU_RADIATION_H
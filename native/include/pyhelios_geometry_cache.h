@@ -0,0 +1,172 @@
+/**
+ * @file pyhelios_geometry_cache.h
+ * @brief Shared CPU acceleration structure cache for PyHelios wrapper modules
+ *
+ * Wrapper modules that trace rays on the CPU acquire a reference-counted BVH over the
+ * Context geometry from this cache instead of building their own. The cache is keyed on
+ * the Context pointer and a geometry revision: the revision advances whenever the set of
+ * primitives or any vertex position changes (or markGeometryDirty is called through the
+ * wrapper). When only vertex positions change, the existing tree topology is refit rather
+ * than rebuilt. The Context dirty flag is never trusted, since native code may clear it after
+ * moving vertices; revision queries always hash the geometry in place (no copy is made unless
+ * the BVH has to be built or refit).
+ *
+ * The same module tracks per-primitive changes (added / modified / deleted UUIDs) against
+ * baselines kept per observer, so consumers can update only what changed.
+ *
+ * This is an internal C++ interface; it is not part of the exported C API.
+ */
+
+#ifndef PYHELIOS_GEOMETRY_CACHE_H
+#define PYHELIOS_GEOMETRY_CACHE_H
+
+#include "Context.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace pyhelios {
+
+    //! Triangle stored as origin vertex plus two edges (Moller-Trumbore layout)
+    struct BVHTriangle {
+        helios::vec3 v0, e1, e2;
+    };
+
+    //! Sentinel for "no primitive" in ray queries
+    const uint32_t NO_PRIMITIVE = 0xFFFFFFFFu;
+
+    //! Flattened BVH node; the left child of an inner node is always stored at index+1
+    struct BVHNode {
+        helios::vec3 bmin, bmax;
+        uint32_t first;  //!< First triangle (leaf) or right child index (inner node)
+        uint32_t count;  //!< Number of triangles, 0 for inner nodes
+    };
+
+    /**
+     * @brief Immutable BVH over the triangles and patches of a Context
+     *
+     * Patches are split into two triangles; voxels are not included. Instances are shared
+     * between callers via std::shared_ptr and never modified after construction, so they
+     * may be traversed concurrently from any number of threads.
+     */
+    class GeometryBVH {
+    public:
+        std::vector<BVHTriangle> triangles;
+        std::vector<uint32_t> triangle_sources;  //!< Index of the source primitive (in getAllUUIDs order) of each triangle
+        std::vector<uint8_t> triangle_parts;     //!< 0 for the first triangle of a primitive, 1 for the second half of a patch
+        std::vector<BVHNode> nodes;
+        std::vector<uint> primitive_uuids;       //!< UUIDs of all Context primitives (including voxels) in getAllUUIDs order
+        uint64_t revision = 0;
+
+        /**
+         * @brief Any-hit occlusion query
+         * @param origin Ray origin
+         * @param direction Unit ray direction
+         * @param tmax Maximum hit distance
+         * @param primitive_mask Optional per-primitive flags (getAllUUIDs order); primitives with flag 0 are transparent
+         * @param ignore_primitive Primitive index that never occludes (typically the primitive the ray starts on)
+         * @return true if any triangle is hit in (epsilon, tmax)
+         */
+        bool occluded(const helios::vec3& origin, const helios::vec3& direction, float tmax, const uint8_t* primitive_mask = nullptr, uint32_t ignore_primitive = NO_PRIMITIVE) const;
+
+        /**
+         * @brief Closest-hit query
+         * @param origin Ray origin
+         * @param direction Unit ray direction
+         * @param tmax Maximum hit distance
+         * @param t_hit Output: distance to the closest hit
+         * @param triangle Output: index of the hit triangle in triangles
+         * @param primitive_mask Optional per-primitive flags (getAllUUIDs order); primitives with flag 0 are transparent
+         * @param ignore_primitive Primitive index that is never hit
+         * @return true if a triangle is hit in (epsilon, tmax)
+         */
+        bool intersect(const helios::vec3& origin, const helios::vec3& direction, float tmax, float& t_hit, uint32_t& triangle, const uint8_t* primitive_mask = nullptr, uint32_t ignore_primitive = NO_PRIMITIVE) const;
+    };
+
+    //! SplitMix64 stream keyed on (seed, index) so a work item draws the same samples no matter which thread evaluates it
+    struct RandomStream {
+        uint64_t state;
+        RandomStream(uint64_t seed, uint64_t index) : state(seed * 0x9E3779B97F4A7C15ULL ^ (index + 0x632BE59BD9B4E019ULL)) {
+        }
+        uint64_t next() {
+            uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+        //! Uniform float in [0, 1)
+        float uniform() {
+            return static_cast<float>(next() >> 40) * (1.f / 16777216.f);
+        }
+    };
+
+    /**
+     * @brief Get the geometry revision of a Context
+     * @param context Context pointer
+     * @return Revision counter; unchanged as long as the primitive set and vertex positions are unchanged
+     * @note Computing the revision reads every primitive's vertices (linear in primitive count)
+     */
+    uint64_t getGeometryRevision(helios::Context* context);
+
+    /**
+     * @brief Acquire the shared BVH for the current Context geometry
+     * @param context Context pointer
+     * @return BVH matching the current geometry revision; rebuilt or refit only if the revision changed
+     */
+    std::shared_ptr<const GeometryBVH> acquireGeometryBVH(helios::Context* context);
+
+    /**
+     * @brief Force the next revision query for a Context to advance
+     * @param context Context pointer
+     */
+    void invalidateGeometryCache(helios::Context* context);
+
+    /**
+     * @brief Drop all cached state for a Context (called when the Context is destroyed)
+     * @param context Context pointer
+     */
+    void releaseGeometryCache(helios::Context* context);
+
+    //! Primitives added, modified (type or vertices changed) or deleted since an observer last marked them clean
+    struct PrimitiveChangeSet {
+        std::vector<uint> added;
+        std::vector<uint> modified;
+        std::vector<uint> deleted;
+        bool has_baseline = false;  //!< false if the observer never marked clean (every primitive is reported as added)
+
+        bool empty() const {
+            return added.empty() && modified.empty() && deleted.empty();
+        }
+    };
+
+    /**
+     * @brief Get the per-primitive changes since an observer last marked the Context clean
+     *
+     * Each observer (a RadiationModel, a CPURadiationModel, ...) keeps its own baseline so that one
+     * consumer marking primitives clean does not hide changes from another. The baseline hashes every
+     * primitive, so it is only built for observers that ask; Context::markGeometryClean() never touches it.
+     * @param context Context pointer
+     * @param observer Key identifying the consumer of the change set
+     * @param mark_clean If true, the current geometry becomes the observer's new baseline
+     * @return Sorted UUID lists of added, modified and deleted primitives
+     */
+    PrimitiveChangeSet getPrimitiveChanges(helios::Context* context, const void* observer, bool mark_clean);
+
+    /**
+     * @brief Drop the change-tracking baseline of one observer
+     * @param context Context pointer
+     * @param observer Key identifying the consumer
+     */
+    void releasePrimitiveObserver(helios::Context* context, const void* observer);
+
+    /**
+     * @brief Get cache counters for a Context
+     * @param context Context pointer
+     * @param builds Output: number of full BVH builds
+     * @param refits Output: number of vertex-only refits
+     */
+    void getGeometryCacheCounts(helios::Context* context, uint64_t& builds, uint64_t& refits);
+
+} // namespace pyhelios
+
+#endif // PYHELIOS_GEOMETRY_CACHE_H
@@ -4,6 +4,11 @@
  * 
  * This header provides Context creation, geometry management, primitive operations,
  * compound geometry functions, file loading, and primitive data functions.
+ *
+ * Functions that return a pointer to an array hand out thread-local wrapper storage. The data
+ * stays valid until the same function is called again on the same thread, so independent
+ * Contexts can be used concurrently from different threads. The *ToBuffer variants write into
+ * caller-provided storage instead.
  */
 
 #ifndef PYHELIOS_WRAPPER_CONTEXT_H
@@ -39,6 +44,7 @@ PYHELIOS_API void destroyContext(helios::Context* context);
 /**
  * @brief Mark geometry as clean
  * @param context Pointer to the Context
+ * @note Also clears the Context's per-primitive dirty flags and deleted-UUID list
  */
 PYHELIOS_API void markGeometryClean(helios::Context* context);
 
@@ -55,6 +61,43 @@ PYHELIOS_API void markGeometryDirty(helios::Context* context);
  */
 PYHELIOS_API bool isGeometryDirty(helios::Context* context);
 
+/**
+ * @brief Get the geometry revision counter
+ * @param context Pointer to the Context
+ * @return Revision number; advances whenever primitives are added or deleted, any vertex moves,
+ *         or markGeometryDirty() is called. Wrapper modules reuse their shared CPU BVH while it is unchanged.
+ * @note Computing the revision reads all primitive vertices (linear in primitive count)
+ */
+PYHELIOS_API unsigned long long getGeometryRevision(helios::Context* context);
+
+/**
+ * @brief Get UUIDs of primitives added or modified since the last markGeometryClean()
+ * @param context Pointer to the Context
+ * @param out Caller-provided buffer (may be NULL to query the count)
+ * @param capacity Capacity of out in elements
+ * @return Number of dirty primitives; out is only written if capacity is sufficient
+ * @note Read from the Context's own per-primitive dirty flags (constant work per dirty primitive, no vertex
+ *       hashing). Any change Helios tracks on a primitive marks it dirty. UUIDs are sorted.
+ */
+PYHELIOS_API size_t getDirtyPrimitiveUUIDs(helios::Context* context, unsigned int* out, size_t capacity);
+
+/**
+ * @brief Get UUIDs of primitives deleted since the last markGeometryClean()
+ * @param context Pointer to the Context
+ * @param out Caller-provided buffer (may be NULL to query the count)
+ * @param capacity Capacity of out in elements
+ * @return Number of deleted primitives; out is only written if capacity is sufficient
+ */
+PYHELIOS_API size_t getDeletedPrimitiveUUIDs(helios::Context* context, unsigned int* out, size_t capacity);
+
+/**
+ * @brief Get shared BVH cache counters for a Context
+ * @param context Pointer to the Context
+ * @param builds Output: number of full BVH builds so far
+ * @param refits Output: number of vertex-only refits so far
+ */
+PYHELIOS_API void getGeometryCacheStats(helios::Context* context, unsigned long long* builds, unsigned long long* refits);
+
 /**
  * @brief Add a default patch to the context
  * @param context Pointer to the Context
@@ -149,6 +192,20 @@ PYHELIOS_API unsigned int addTriangleWithColorRGBA(helios::Context* context, flo
  */
 PYHELIOS_API unsigned int addTriangleWithTexture(helios::Context* context, float* vertex0, float* vertex1, float* vertex2, const char* texture_file, float* uv0, float* uv1, float* uv2);
 
+/**
+ * @brief Add an indexed triangle mesh to the context in a single call
+ * @param context Pointer to the Context
+ * @param vertices Array of nverts*3 floats [x0, y0, z0, x1, y1, z1, ...]
+ * @param nverts Number of vertices
+ * @param faces Array of nfaces*3 vertex indices [i0, j0, k0, i1, j1, k1, ...]
+ * @param nfaces Number of triangles
+ * @param colors Optional array of nfaces*3 floats [r, g, b] per triangle (may be NULL)
+ * @param out_uuids Caller-provided buffer of at least nfaces entries that receives the triangle UUIDs
+ * @return Number of triangles created (0 on error)
+ * @note All face indices are validated before any primitive is created
+ */
+PYHELIOS_API unsigned int addTrianglesBulk(helios::Context* context, const float* vertices, size_t nverts, const unsigned int* faces, size_t nfaces, const float* colors, unsigned int* out_uuids);
+
 //=============================================================================
 // Compound Geometry Functions
 //=============================================================================
@@ -306,6 +363,23 @@ PYHELIOS_API float* getPrimitiveColorRGB(helios::Context* context, unsigned int
  */
 PYHELIOS_API float* getPrimitiveColorRGBA(helios::Context* context, unsigned int uuid);
 
+/**
+ * @brief Export geometry for many primitives into caller-provided structure-of-arrays buffers
+ * @param context Pointer to the Context
+ * @param uuids Array of primitive UUIDs
+ * @param n Number of UUIDs in the array
+ * @param vertex_offsets Buffer of n+1 entries; vertices of primitive i are [vertex_offsets[i], vertex_offsets[i+1])
+ * @param vertices Buffer of vertex_capacity*3 floats for packed [x, y, z] vertices, or NULL to query the required size
+ * @param vertex_capacity Number of vertices the vertex buffer can hold
+ * @param normals Optional buffer of n*3 floats for primitive normals (may be NULL)
+ * @param areas Optional buffer of n floats for primitive areas (may be NULL)
+ * @param types Optional buffer of n primitive types (may be NULL)
+ * @param colors Optional buffer of n*4 floats for RGBA colors (may be NULL)
+ * @return Total number of vertices for the UUID list (0 on error)
+ * @note Call once with vertices == NULL to fill vertex_offsets and obtain the vertex count, then again with allocated buffers.
+ */
+PYHELIOS_API size_t getPrimitiveGeometryBulk(helios::Context* context, const unsigned int* uuids, size_t n, unsigned int* vertex_offsets, float* vertices, size_t vertex_capacity, float* normals, float* areas, unsigned int* types, float* colors);
+
 /**
  * @brief Get the total number of primitives in the context
  * @param context Pointer to the Context
@@ -345,6 +419,77 @@ PYHELIOS_API unsigned int* getAllObjectIDs(helios::Context* context, unsigned in
  */
 PYHELIOS_API unsigned int* getObjectPrimitiveUUIDs(helios::Context* context, unsigned int objectID, unsigned int* size);
 
+/**
+ * @brief Copy all primitive UUIDs into a caller-provided buffer
+ * @param context Pointer to the Context
+ * @param out Output buffer, or NULL to query the required size
+ * @param capacity Number of elements the output buffer can hold
+ * @return Number of UUIDs in the context; the buffer is only written if capacity is large enough
+ * @note Unlike getAllUUIDs(), no wrapper-owned storage is involved, so this is safe to call concurrently on separate Contexts
+ */
+PYHELIOS_API size_t getAllUUIDsToBuffer(helios::Context* context, unsigned int* out, size_t capacity);
+
+/**
+ * @brief Copy all object IDs into a caller-provided buffer
+ * @param context Pointer to the Context
+ * @param out Output buffer, or NULL to query the required size
+ * @param capacity Number of elements the output buffer can hold
+ * @return Number of objects in the context; the buffer is only written if capacity is large enough
+ */
+PYHELIOS_API size_t getAllObjectIDsToBuffer(helios::Context* context, unsigned int* out, size_t capacity);
+
+/**
+ * @brief Copy the primitive UUIDs of an object into a caller-provided buffer
+ * @param context Pointer to the Context
+ * @param object_id ID of the object
+ * @param out Output buffer, or NULL to query the required size
+ * @param capacity Number of elements the output buffer can hold
+ * @return Number of primitives in the object; the buffer is only written if capacity is large enough
+ */
+PYHELIOS_API size_t getObjectPrimitiveUUIDsToBuffer(helios::Context* context, unsigned int object_id, unsigned int* out, size_t capacity);
+
+/**
+ * @brief Copy the vertex coordinates of a primitive into a caller-provided buffer
+ * @param context Pointer to the Context
+ * @param uuid UUID of the primitive
+ * @param out Output buffer of x, y, z triplets, or NULL to query the required size
+ * @param capacity Number of floats the output buffer can hold
+ * @return Number of floats (3 per vertex); the buffer is only written if capacity is large enough
+ */
+PYHELIOS_API size_t getPrimitiveVerticesToBuffer(helios::Context* context, unsigned int uuid, float* out, size_t capacity);
+
+/**
+ * @brief Copy the normal vector of a primitive into a caller-provided buffer
+ * @param context Pointer to the Context
+ * @param uuid UUID of the primitive
+ * @param out Output buffer of 3 floats [x, y, z]
+ */
+PYHELIOS_API void getPrimitiveNormalToBuffer(helios::Context* context, unsigned int uuid, float* out);
+
+/**
+ * @brief Copy the color of a primitive into a caller-provided buffer
+ * @param context Pointer to the Context
+ * @param uuid UUID of the primitive
+ * @param out Output buffer of 3 floats [r, g, b]
+ */
+PYHELIOS_API void getPrimitiveColorToBuffer(helios::Context* context, unsigned int uuid, float* out);
+
+/**
+ * @brief Copy the RGB color of a primitive into a caller-provided buffer
+ * @param context Pointer to the Context
+ * @param uuid UUID of the primitive
+ * @param out Output buffer of 3 floats [r, g, b]
+ */
+PYHELIOS_API void getPrimitiveColorRGBToBuffer(helios::Context* context, unsigned int uuid, float* out);
+
+/**
+ * @brief Copy the RGBA color of a primitive into a caller-provided buffer
+ * @param context Pointer to the Context
+ * @param uuid UUID of the primitive
+ * @param out Output buffer of 4 floats [r, g, b, a]
+ */
+PYHELIOS_API void getPrimitiveColorRGBAToBuffer(helios::Context* context, unsigned int uuid, float* out);
+
 /**
  * @brief Load PLY file with origin, height and upaxis parameters
  * @param context Pointer to the Context
@@ -791,6 +936,33 @@ PYHELIOS_API void getPrimitiveDataInt4(helios::Context* context, unsigned int uu
  */
 PYHELIOS_API int getPrimitiveDataGeneric(helios::Context* context, unsigned int uuid, const char* label, void* result_buffer, int max_buffer_size);
 
+/**
+ * @brief Get one primitive data label for many primitives as a packed column
+ * @param context Pointer to the Context
+ * @param uuids Array of primitive UUIDs
+ * @param n Number of UUIDs in the array
+ * @param label Name/label of the data
+ * @param out Caller-provided buffer of n values; vector types are packed as consecutive components (e.g. vec3 as 3 floats)
+ * @param expected_type Data type (HeliosDataType) the caller allocated for; must match the stored type
+ * @return Number of values written, or -1 on error
+ * @note String data is not supported. All UUIDs are checked before any value is written.
+ */
+PYHELIOS_API int getPrimitiveDataColumn(helios::Context* context, const unsigned int* uuids, size_t n, const char* label, void* out, int expected_type);
+
+/**
+ * @brief Set one primitive data label for many primitives from a packed column
+ * @param context Pointer to the Context
+ * @param uuids Array of primitive UUIDs
+ * @param n Number of UUIDs in the array
+ * @param label Name/label of the data
+ * @param data_type Data type (HeliosDataType) of the values; string data is not supported
+ * @param values Packed buffer of n values (vector types as consecutive components), or a single value if broadcast is true
+ * @param broadcast If true, the single value in the buffer is written to every UUID
+ * @return Number of primitives written, or -1 on error
+ * @note All UUIDs are checked before any value is written.
+ */
+PYHELIOS_API int setPrimitiveDataColumn(helios::Context* context, const unsigned int* uuids, size_t n, const char* label, int data_type, const void* values, bool broadcast);
+
 /**
  * @brief Color primitives based on pseudocolor mapping of primitive data values
  * @param context Pointer to the Context
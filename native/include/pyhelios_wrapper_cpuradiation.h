@@ -0,0 +1,421 @@
+/**
+ * @file pyhelios_wrapper_cpuradiation.h
+ * @brief CPU radiation backend functions for PyHelios C wrapper
+ *
+ * Runs radiation bands without CUDA/OptiX by ray tracing on the CPU (see pyhelios_cpu_radiation.h).
+ * These functions are always compiled, independent of the radiation plugin. The model supports
+ * collimated, sphere and sun-sphere sources, diffuse sky flux, emission and scattering. Radiation
+ * cameras render the surface exitance of the last run of their bands; image files are not written.
+ */
+
+#ifndef PYHELIOS_WRAPPER_CPURADIATION_H
+#define PYHELIOS_WRAPPER_CPURADIATION_H
+
+#include "pyhelios_wrapper_common.h"
+#include <stddef.h>
+
+// Forward declarations for CPURadiationModel interface
+namespace pyhelios {
+    class CPURadiationModel;
+}
+
+//! Opaque handle of a radiation run executing on a background thread
+struct CPURadiationJob;
+namespace helios {
+    class Context;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//=============================================================================
+// CPURadiationModel Functions
+//=============================================================================
+
+/**
+ * @brief Create a new CPU radiation model
+ * @param context Pointer to the Helios context
+ * @return Pointer to the created model, or nullptr on error
+ */
+PYHELIOS_API pyhelios::CPURadiationModel* createCPURadiationModel(helios::Context* context);
+
+/**
+ * @brief Destroy a CPU radiation model
+ * @param radiation_model Pointer to the model to destroy
+ */
+PYHELIOS_API void destroyCPURadiationModel(pyhelios::CPURadiationModel* radiation_model);
+
+// Message control
+PYHELIOS_API void disableCPURadiationMessages(pyhelios::CPURadiationModel* radiation_model);
+PYHELIOS_API void enableCPURadiationMessages(pyhelios::CPURadiationModel* radiation_model);
+
+/**
+ * @brief Set the number of worker threads
+ * @param radiation_model Pointer to the model
+ * @param num_threads Number of threads (0 = hardware concurrency)
+ */
+PYHELIOS_API void setCPURadiationThreadCount(pyhelios::CPURadiationModel* radiation_model, int num_threads);
+
+/**
+ * @brief Set the random seed used for ray sampling
+ * @param radiation_model Pointer to the model
+ * @param seed Random seed
+ */
+PYHELIOS_API void setCPURadiationSeed(pyhelios::CPURadiationModel* radiation_model, unsigned int seed);
+
+// Band management
+PYHELIOS_API void addCPURadiationBand(pyhelios::CPURadiationModel* radiation_model, const char* label);
+
+/**
+ * @brief Add a band whose optical properties may be integrated from "reflectivity_spectrum" / "transmissivity_spectrum" data
+ * @param radiation_model Pointer to the model
+ * @param label Band label
+ * @param wavelength_min Lower band edge (nm)
+ * @param wavelength_max Upper band edge (nm)
+ */
+PYHELIOS_API void addCPURadiationBandWithWavelengths(pyhelios::CPURadiationModel* radiation_model, const char* label, float wavelength_min, float wavelength_max);
+PYHELIOS_API void copyCPURadiationBand(pyhelios::CPURadiationModel* radiation_model, const char* old_label, const char* new_label);
+
+// Source management
+PYHELIOS_API unsigned int addCPUCollimatedRadiationSource(pyhelios::CPURadiationModel* radiation_model, float x, float y, float z);
+PYHELIOS_API unsigned int addCPUSphereRadiationSource(pyhelios::CPURadiationModel* radiation_model, float x, float y, float z, float radius);
+
+/**
+ * @brief Add a sun sphere source
+ * The sun is traced as a collimated beam jittered over the solar disk; radius and position_scaling
+ * only affect the OptiX backend and are accepted for signature compatibility.
+ * @param radiation_model Pointer to the model
+ * @param zenith Solar zenith angle (degrees)
+ * @param azimuth Solar azimuth angle, clockwise from +y (degrees)
+ * @param angular_width Angular diameter of the solar disk (degrees)
+ * @param flux_scaling Flux scaling factor
+ * @return Source ID
+ */
+PYHELIOS_API unsigned int addCPUSunSphereRadiationSource(pyhelios::CPURadiationModel* radiation_model, float zenith, float azimuth, float angular_width, float flux_scaling);
+
+// Flux and ray configuration
+PYHELIOS_API void setCPUSourceFlux(pyhelios::CPURadiationModel* radiation_model, unsigned int source_id, const char* label, float flux);
+PYHELIOS_API void setCPUSourceFluxMultiple(pyhelios::CPURadiationModel* radiation_model, const unsigned int* source_ids, size_t count, const char* label, float flux);
+PYHELIOS_API float getCPUSourceFlux(pyhelios::CPURadiationModel* radiation_model, unsigned int source_id, const char* label);
+
+/**
+ * @brief Weight spectral property averages by a source spectrum
+ * @param radiation_model Pointer to the model
+ * @param source_id Source ID
+ * @param spectrum_label Context global data label of a vec2 (wavelength in nm, value) spectrum, or "" for a flat spectrum
+ */
+PYHELIOS_API void setCPUSourceSpectrum(pyhelios::CPURadiationModel* radiation_model, unsigned int source_id, const char* spectrum_label);
+PYHELIOS_API void setCPUDiffuseRadiationFlux(pyhelios::CPURadiationModel* radiation_model, const char* label, float flux);
+PYHELIOS_API void setCPUDirectRayCount(pyhelios::CPURadiationModel* radiation_model, const char* label, size_t count);
+PYHELIOS_API void setCPUDiffuseRayCount(pyhelios::CPURadiationModel* radiation_model, const char* label, size_t count);
+PYHELIOS_API void setCPUScatteringDepth(pyhelios::CPURadiationModel* radiation_model, const char* label, unsigned int depth);
+PYHELIOS_API void setCPUMinScatterEnergy(pyhelios::CPURadiationModel* radiation_model, const char* label, float energy);
+
+/**
+ * @brief Make rays leaving the scene through its lateral sides re-enter from the opposite side
+ * The period along each axis is the extent of the geometry's bounding box. Camera rays do not wrap.
+ * @param radiation_model Pointer to the model
+ * @param boundary "x", "y", "xy", or "" to disable
+ */
+PYHELIOS_API void enforceCPUPeriodicBoundary(pyhelios::CPURadiationModel* radiation_model, const char* boundary);
+
+/**
+ * @brief Stop scattering a band early once little energy is left to scatter
+ * After each pass, scattering ends if the power reflected or transmitted in that pass is at most
+ * tolerance times the power injected by sources, sky and emission. setScatteringDepth remains the upper bound.
+ * @param radiation_model Pointer to the model
+ * @param label Band label
+ * @param tolerance Relative residual tolerance (0 = always run to the scattering depth)
+ */
+PYHELIOS_API void setCPUScatteringTolerance(pyhelios::CPURadiationModel* radiation_model, const char* label, float tolerance);
+PYHELIOS_API void disableCPUEmission(pyhelios::CPURadiationModel* radiation_model, const char* label);
+PYHELIOS_API void enableCPUEmission(pyhelios::CPURadiationModel* radiation_model, const char* label);
+
+/**
+ * @brief Trace a band in rounds until a target accuracy or a ray budget is reached
+ * Each round traces the band's direct and diffuse ray counts with independent samples; the result is
+ * the mean over rounds. Tracing stops once the area-weighted relative standard error of the absorbed
+ * flux is at most target_error (after at least two rounds), or when the next round would exceed
+ * max_ray_count direct or diffuse rays per primitive.
+ * @param radiation_model Pointer to the model
+ * @param label Band label
+ * @param target_error Target relative error (0 disables adaptive tracing)
+ * @param max_ray_count Ray budget per primitive summed over rounds (must be positive if target_error > 0)
+ */
+PYHELIOS_API void setCPUAdaptiveRayCount(pyhelios::CPURadiationModel* radiation_model, const char* label, float target_error, size_t max_ray_count);
+
+/**
+ * @brief Cache per-source unit-flux responses on the next run
+ * After runCPURadiationBand, changing source or diffuse flux updates the absorbed flux by linear
+ * superposition without re-tracing. Geometry, optical property and temperature changes still
+ * require a new run.
+ * @param radiation_model Pointer to the model
+ */
+PYHELIOS_API void enableCPUFluxSuperposition(pyhelios::CPURadiationModel* radiation_model);
+
+/**
+ * @brief Stop caching unit-flux responses and drop the cached ones
+ * @param radiation_model Pointer to the model
+ */
+PYHELIOS_API void disableCPUFluxSuperposition(pyhelios::CPURadiationModel* radiation_model);
+
+/**
+ * @brief Build a sparse face-to-face exchange operator on the next run and reuse it for later runs
+ * Sky diffuse and scattering/emission passes are then solved by sparse mat-vec products instead of
+ * ray tracing. The operator is dropped when geometry is updated. Adaptive bands keep tracing diffuse radiation.
+ * @param radiation_model Pointer to the model
+ * @param tolerance Exchange fractions below this are not stored
+ * @param max_bytes Memory cap in bytes, enforced while building; only the largest fractions are kept (0 = no cap)
+ */
+PYHELIOS_API void enableCPUViewFactorOperator(pyhelios::CPURadiationModel* radiation_model, float tolerance, size_t max_bytes);
+PYHELIOS_API void disableCPUViewFactorOperator(pyhelios::CPURadiationModel* radiation_model);
+
+// View factor operator memory report (0 if no operator has been built)
+PYHELIOS_API size_t getCPUViewFactorOperatorBytes(pyhelios::CPURadiationModel* radiation_model);
+PYHELIOS_API size_t getCPUViewFactorOperatorNonzeros(pyhelios::CPURadiationModel* radiation_model);
+
+/**
+ * @brief Precompute per-primitive sunlit fractions for a set of sun directions in one batched trace
+ * Later runs serve collimated sources within max_angle of a cached direction from the cache instead of
+ * tracing them. The cache is dropped when geometry is updated.
+ * @param radiation_model Pointer to the model
+ * @param directions Sun directions as x, y, z triplets (pointing toward the sun)
+ * @param direction_count Number of directions
+ * @param ray_count Sample points per primitive
+ * @param max_angle Largest angle between a source and a cached direction served from the cache (radians)
+ */
+PYHELIOS_API void precomputeCPUSunlitFractions(pyhelios::CPURadiationModel* radiation_model, const float* directions, size_t direction_count,
+                                               size_t ray_count, float max_angle);
+PYHELIOS_API void clearCPUSunlitFractions(pyhelios::CPURadiationModel* radiation_model);
+
+// Sunlit fraction cache memory report (0 if no cache has been built)
+PYHELIOS_API size_t getCPUSunlitFractionBytes(pyhelios::CPURadiationModel* radiation_model);
+
+// Geometry
+PYHELIOS_API void updateCPURadiationGeometry(pyhelios::CPURadiationModel* radiation_model);
+PYHELIOS_API void updateCPURadiationGeometryUUIDs(pyhelios::CPURadiationModel* radiation_model, const unsigned int* uuids, size_t count);
+
+/**
+ * @brief Update geometry only if primitives in the current scope changed since the last geometry update
+ * @param radiation_model Pointer to the model
+ * @return Number of changed primitives that triggered the update (0 if skipped)
+ */
+PYHELIOS_API size_t updateCPURadiationGeometryDirty(pyhelios::CPURadiationModel* radiation_model);
+
+// Simulation
+PYHELIOS_API void runCPURadiationBand(pyhelios::CPURadiationModel* radiation_model, const char* label);
+PYHELIOS_API void runCPURadiationBandMultiple(pyhelios::CPURadiationModel* radiation_model, const char** labels, size_t count);
+
+/**
+ * @brief Start runCPURadiationBandMultiple on a background thread and return immediately
+ * Optical properties and temperatures are read from the Context before this returns (unknown bands fail
+ * here); the background thread never touches the Context, which stays usable on the calling thread.
+ * Only one run per model may be in progress. Until the job has been waited for (waitCPURadiationJob
+ * returned 1) or destroyed, every other function on the model fails with PYHELIOS_ERROR_RUNTIME.
+ * destroyCPURadiationModel cancels and waits for a running job.
+ * @param radiation_model Pointer to the model
+ * @param labels Array of band labels
+ * @param count Number of labels
+ * @return Job handle (release with destroyCPURadiationJob), or NULL on error
+ */
+PYHELIOS_API CPURadiationJob* runCPURadiationBandAsync(pyhelios::CPURadiationModel* radiation_model, const char** labels, size_t count);
+
+/**
+ * @brief Check whether a job has finished, without blocking
+ * @return 1 if finished (successfully, with an error, or cancelled), 0 if still running
+ */
+PYHELIOS_API int pollCPURadiationJob(CPURadiationJob* job);
+
+/**
+ * @brief Wait for a job to finish
+ * When the job has finished, the first wait writes "radiation_flux_<band>" primitive data of the traced
+ * bands into the Context on the calling thread (skipping primitives deleted meanwhile), and the error
+ * state of the run (getLastErrorCode / getLastErrorMessage) is set, exactly as if
+ * runCPURadiationBandMultiple had been called on this thread.
+ * @param job Job handle
+ * @param timeout_seconds Longest time to wait; negative waits until the job finishes
+ * @return 1 if the job has finished, 0 if the timeout expired first
+ */
+PYHELIOS_API int waitCPURadiationJob(CPURadiationJob* job, double timeout_seconds);
+
+/**
+ * @brief Fraction of a job completed, from 0 to 1
+ * Advances after each tracing stage (direct, sky diffuse, scattering pass) of each band group.
+ */
+PYHELIOS_API float getCPURadiationJobProgress(CPURadiationJob* job);
+
+/**
+ * @brief Ask a job to stop at its next tracing stage
+ * The job then finishes with a "Radiation run was cancelled" runtime error. Bands whose traversal
+ * finished before that keep their new results.
+ */
+PYHELIOS_API void cancelCPURadiationJob(CPURadiationJob* job);
+
+/**
+ * @brief Release a job handle, cancelling the job and waiting for it if it is still running
+ * Results of a job that was never waited for stay in the model but are not written into the Context.
+ */
+PYHELIOS_API void destroyCPURadiationJob(CPURadiationJob* job);
+
+/**
+ * @brief Copy statistics of the last run of a band into a caller-provided buffer
+ * Values in order: rounds, direct rays per primitive and source, diffuse rays per primitive face,
+ * achieved relative error (-1 if fewer than two rounds were traced), scattering/emission passes,
+ * scattering residual (power scattered but not traced further, relative to the injected power).
+ * @param radiation_model Pointer to the model
+ * @param label Band label
+ * @param out Output buffer (may be NULL for a size query)
+ * @param capacity Number of floats available in out
+ * @return Number of statistics; out is only written if capacity is at least this large
+ */
+PYHELIOS_API size_t getCPURadiationBandStats(pyhelios::CPURadiationModel* radiation_model, const char* label, float* out, size_t capacity);
+
+/**
+ * @brief Copy the absorbed flux summed over bands into a caller-provided buffer
+ * @param radiation_model Pointer to the model
+ * @param out Output buffer (may be NULL for a size query)
+ * @param capacity Number of floats available in out
+ * @return Number of primitives; out is only written if capacity is at least this large
+ */
+PYHELIOS_API size_t getCPUTotalAbsorbedFluxToBuffer(pyhelios::CPURadiationModel* radiation_model, float* out, size_t capacity);
+
+/**
+ * @brief Copy per-band absorbed flux as a row-major [band x primitive] array
+ * @param radiation_model Pointer to the model
+ * @param band_labels Array of band labels
+ * @param band_count Number of band labels
+ * @param out Output buffer (may be NULL for a size query)
+ * @param capacity Number of floats available in out
+ * @return Number of primitives per band; out is only written if capacity >= band_count * primitives
+ */
+PYHELIOS_API size_t getCPUAbsorbedFluxBands(pyhelios::CPURadiationModel* radiation_model, const char** band_labels, size_t band_count, float* out, size_t capacity);
+
+/**
+ * @brief Sum absorbed power and area of one band per group of primitives
+ * Primitives not listed, or without flux from the last run of the band, are left out. The
+ * area-weighted mean flux of group g is power[g] / area[g].
+ * @param radiation_model Pointer to the model
+ * @param label Band label
+ * @param uuids Primitives to aggregate
+ * @param groups Group index of each primitive, smaller than group_count
+ * @param count Number of entries in uuids and groups
+ * @param group_count Number of groups
+ * @param power Output: group_count sums of flux times area (W)
+ * @param area Output: group_count summed areas (m^2)
+ */
+PYHELIOS_API void aggregateCPUAbsorbedFlux(pyhelios::CPURadiationModel* radiation_model, const char* label, const unsigned int* uuids, const unsigned int* groups,
+                                           size_t count, size_t group_count, double* power, double* area);
+
+/**
+ * @brief Sum absorbed power and area of one band per parent Context object
+ * @param radiation_model Pointer to the model
+ * @param label Band label
+ * @param object_ids Output: object IDs in ascending order (may be NULL for a size query)
+ * @param power Output: sum of flux times area per object (W)
+ * @param area Output: summed area per object (m^2)
+ * @param capacity Number of entries available in each output buffer
+ * @return Number of objects; the outputs are only written if capacity is large enough
+ */
+PYHELIOS_API size_t aggregateCPUAbsorbedFluxByObject(pyhelios::CPURadiationModel* radiation_model, const char* label, unsigned int* object_ids,
+                                                     double* power, double* area, size_t capacity);
+
+/**
+ * @brief Add a radiation camera looking at a point
+ * Cameras observing a band are rendered at the end of each runCPURadiationBand that includes it.
+ * @param radiation_model Pointer to the model
+ * @param camera_label Camera label (an existing camera with this label is replaced)
+ * @param band_labels Array of band labels the camera observes
+ * @param band_count Number of band labels
+ * @param position_x Camera position x
+ * @param position_y Camera position y
+ * @param position_z Camera position z
+ * @param lookat_x Look-at point x
+ * @param lookat_y Look-at point y
+ * @param lookat_z Look-at point z
+ * @param camera_properties [resolution_x, resolution_y, focal_distance, lens_diameter, HFOV, FOV_aspect_ratio]
+ * @param antialiasing_samples Rays per pixel
+ */
+PYHELIOS_API void addCPURadiationCameraVec3(pyhelios::CPURadiationModel* radiation_model, const char* camera_label,
+                                            const char** band_labels, size_t band_count,
+                                            float position_x, float position_y, float position_z,
+                                            float lookat_x, float lookat_y, float lookat_z,
+                                            const float* camera_properties, unsigned int antialiasing_samples);
+
+/**
+ * @brief Add a radiation camera with a spherical viewing direction (elevation and azimuth in radians)
+ */
+PYHELIOS_API void addCPURadiationCameraSpherical(pyhelios::CPURadiationModel* radiation_model, const char* camera_label,
+                                                 const char** band_labels, size_t band_count,
+                                                 float position_x, float position_y, float position_z,
+                                                 float radius, float elevation, float azimuth,
+                                                 const float* camera_properties, unsigned int antialiasing_samples);
+
+/**
+ * @brief Render several cameras in one batch from the last run of their bands
+ * Primary rays of all cameras share one work list on the thread pool, and each ray shades every
+ * band of its camera.
+ * @param radiation_model Pointer to the model
+ * @param camera_labels Array of camera labels (may be NULL if count is 0)
+ * @param count Number of camera labels (0 = all cameras except tiled-only ones)
+ */
+PYHELIOS_API void renderCPURadiationCameras(pyhelios::CPURadiationModel* radiation_model, const char** camera_labels, size_t count);
+
+/**
+ * @brief Restrict a camera to streamed rendering through renderCPUCameraTiles
+ * Runs and batch renders skip a tiled-only camera, so its full frame is never allocated. Enabling
+ * the flag drops pixels rendered earlier; replacing the camera keeps the flag.
+ * @param radiation_model Pointer to the model
+ * @param camera Camera label
+ * @param tiled_only Non-zero to render the camera only in tiles
+ */
+PYHELIOS_API void setCPUCameraTiledOnly(pyhelios::CPURadiationModel* radiation_model, const char* camera, int tiled_only);
+
+/**
+ * @brief Copy the pixel data of one camera band into a caller-provided buffer
+ * Pixels are row-major from the top-left pixel, in W/m^2 (see pyhelios_cpu_radiation.h).
+ * @param radiation_model Pointer to the model
+ * @param camera Camera label
+ * @param band Band label
+ * @param out Output buffer (may be NULL for a size query)
+ * @param capacity Number of floats available in out
+ * @param width Output: image width in pixels (may be NULL)
+ * @param height Output: image height in pixels (may be NULL)
+ * @return Number of pixels; out is only written if capacity is at least this large
+ */
+PYHELIOS_API size_t getCPUCameraImageBuffer(pyhelios::CPURadiationModel* radiation_model, const char* camera, const char* band,
+                                            float* out, size_t capacity, int* width, int* height);
+
+/**
+ * @brief Receives one band of a finished camera tile
+ * @param user_data Pointer passed to renderCPUCameraTiles
+ * @param band Band label
+ * @param x0 Column of the tile's top-left pixel
+ * @param y0 Row of the tile's top-left pixel
+ * @param width Tile width in pixels
+ * @param height Tile height in pixels
+ * @param pixels Row-major tile pixels, valid only during the call
+ * @return 0 to continue, nonzero to stop rendering
+ */
+typedef int (*CPUCameraTileCallback)(void* user_data, const char* band, int x0, int y0, int width, int height, const float* pixels);
+
+/**
+ * @brief Render one camera tile by tile, streaming each finished tile to a callback
+ * Tiles are rendered in parallel and delivered in row-major tile order on the calling thread. The
+ * frame is not stored, so peak memory scales with the tile size rather than the camera resolution.
+ * @param radiation_model Pointer to the model
+ * @param camera Camera label
+ * @param tile_width Tile width in pixels (edge tiles are clipped to the frame)
+ * @param tile_height Tile height in pixels
+ * @param callback Called once per tile and band
+ * @param user_data Passed through to callback (may be NULL)
+ */
+PYHELIOS_API void renderCPUCameraTiles(pyhelios::CPURadiationModel* radiation_model, const char* camera,
+                                       unsigned int tile_width, unsigned int tile_height,
+                                       CPUCameraTileCallback callback, void* user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PYHELIOS_WRAPPER_CPURADIATION_H
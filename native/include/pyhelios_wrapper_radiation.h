@@ -66,6 +66,14 @@ PYHELIOS_API void addRadiationBand(RadiationModel* radiation_model, const char*
  */
 PYHELIOS_API void addRadiationBandWithWavelengths(RadiationModel* radiation_model, const char* label, float wavelength_min, float wavelength_max);
 
+/**
+ * @brief Set the spectrum of a radiation source used to weight spectral optical properties
+ * @param radiation_model Pointer to the RadiationModel
+ * @param source_id Source ID
+ * @param spectrum_label Context global data label of a vec2 (wavelength in nm, value) spectrum
+ */
+PYHELIOS_API void setSourceSpectrum(RadiationModel* radiation_model, unsigned int source_id, const char* spectrum_label);
+
 /**
  * @brief Add a collimated radiation source with default direction
  * @param radiation_model Pointer to the RadiationModel
@@ -93,6 +101,27 @@ PYHELIOS_API unsigned int addCollimatedRadiationSourceVec3(RadiationModel* radia
  */
 PYHELIOS_API unsigned int addCollimatedRadiationSourceSpherical(RadiationModel* radiation_model, float elevation, float azimuth, float radius);
 
+/**
+ * @brief Re-upload radiation geometry only if primitives changed since the model's last geometry update
+ *
+ * The wrapper keeps a per-model baseline of primitive vertices (taken at every updateGeometry call)
+ * and compares it against the Context. If no primitive in the model's scope was added, modified or
+ * deleted, the update is skipped entirely. Otherwise the whole scope is re-uploaded, since the plugin
+ * has no partial update: the saving applies only to calls where nothing changed. If the model was
+ * last updated with an explicit UUID list, that list (minus deleted primitives) remains the scope.
+ * @param radiation_model Pointer to the RadiationModel
+ * @return true if the geometry was re-uploaded, false if the update was skipped
+ * @note Detecting changes reads all primitive vertices, which is far cheaper than a geometry upload
+ */
+PYHELIOS_API bool updateRadiationGeometryIfChanged(RadiationModel* radiation_model);
+
+/**
+ * @brief Make rays leaving the domain through its lateral sides re-enter from the opposite side
+ * @param radiation_model Pointer to the RadiationModel
+ * @param boundary "x", "y" or "xy"
+ */
+PYHELIOS_API void enforcePeriodicBoundary(RadiationModel* radiation_model, const char* boundary);
+
 /**
  * @brief Run radiation simulation for a specific band
  * @param radiation_model Pointer to the RadiationModel
@@ -100,6 +129,58 @@ PYHELIOS_API unsigned int addCollimatedRadiationSourceSpherical(RadiationModel*
  */
 PYHELIOS_API void runBand(RadiationModel* radiation_model, const char* label);
 
+/**
+ * @brief Copy the total absorbed flux of every primitive into a caller-provided buffer
+ * @param radiation_model Pointer to the RadiationModel
+ * @param out Output buffer, or NULL to query the required size
+ * @param capacity Number of floats the output buffer can hold
+ * @return Number of primitives; the buffer is only written if capacity is large enough
+ */
+PYHELIOS_API size_t getTotalAbsorbedFluxToBuffer(RadiationModel* radiation_model, float* out, size_t capacity);
+
+/**
+ * @brief Get absorbed flux for several bands as a row-major [band x primitive] array
+ * @param radiation_model Pointer to the RadiationModel
+ * @param context Pointer to the Context the model was created with
+ * @param band_labels Array of band labels
+ * @param band_count Number of band labels
+ * @param out Output buffer of band_count * primitive_count floats, or NULL to query the primitive count
+ * @param capacity Number of floats the output buffer can hold
+ * @return Number of primitives per band (columns), in getAllUUIDs() order; 0 on error
+ * @note Primitives without "radiation_flux_<band>" data (e.g. added after the last run) report 0
+ */
+PYHELIOS_API size_t getAbsorbedFluxBands(RadiationModel* radiation_model, helios::Context* context, const char** band_labels, size_t band_count, float* out, size_t capacity);
+
+/**
+ * @brief Sum absorbed power and area of one band per group of primitives
+ * @param radiation_model Pointer to the RadiationModel
+ * @param context Pointer to the Context the model was created with
+ * @param label Band label
+ * @param uuids Primitives to aggregate
+ * @param groups Group index of each primitive, smaller than group_count
+ * @param count Number of entries in uuids and groups
+ * @param group_count Number of groups
+ * @param power Output: group_count sums of flux times area (W)
+ * @param area Output: group_count summed areas (m^2)
+ * @note Primitives without "radiation_flux_<band>" data are left out; the mean flux of group g is power[g] / area[g]
+ */
+PYHELIOS_API void aggregateAbsorbedFlux(RadiationModel* radiation_model, helios::Context* context, const char* label, const unsigned int* uuids,
+                                        const unsigned int* groups, size_t count, size_t group_count, double* power, double* area);
+
+/**
+ * @brief Sum absorbed power and area of one band per parent Context object
+ * @param radiation_model Pointer to the RadiationModel
+ * @param context Pointer to the Context the model was created with
+ * @param label Band label
+ * @param object_ids Output: object IDs in ascending order (may be NULL for a size query)
+ * @param power Output: sum of flux times area per object (W)
+ * @param area Output: summed area per object (m^2)
+ * @param capacity Number of entries available in each output buffer
+ * @return Number of objects; the outputs are only written if capacity is large enough
+ */
+PYHELIOS_API size_t aggregateAbsorbedFluxByObject(RadiationModel* radiation_model, helios::Context* context, const char* label,
+                                                  unsigned int* object_ids, double* power, double* area, size_t capacity);
+
 //=============================================================================
 // Camera and Image Functions (v1.3.47)
 //=============================================================================
@@ -148,6 +229,89 @@ PYHELIOS_API const char* writeNormCameraImage(RadiationModel* radiation_model, c
 PYHELIOS_API void writeCameraImageData(RadiationModel* radiation_model, const char* camera, const char* band,
                                        const char* imagefile_base, const char* image_path, int frame);
 
+/**
+ * @brief Copy the pixel data of one camera band into a caller-provided buffer
+ * Pixels are row-major with x fastest, in the order of RadiationModel::getCameraPixelData.
+ * @param radiation_model Pointer to the RadiationModel
+ * @param camera Camera label
+ * @param band Band label
+ * @param out Output buffer (may be NULL for a size query, answered from the camera resolution without reading pixels)
+ * @param capacity Number of floats available in out
+ * @param width Output: image width in pixels (may be NULL)
+ * @param height Output: image height in pixels (may be NULL)
+ * @return Number of pixels; out is only written if capacity is at least this large
+ */
+PYHELIOS_API size_t getCameraImageBuffer(RadiationModel* radiation_model, const char* camera, const char* band,
+                                         float* out, size_t capacity, int* width, int* height);
+
+/**
+ * @brief Copy an RGB composite of three camera bands into a caller-provided buffer
+ * Values are interleaved RGB in [0, 1]: pixel data times flux_to_pixel_conversion (as in writeCameraImage),
+ * or divided by the maximum over the three bands if normalize is non-zero (as in writeNormCameraImage).
+ * @param radiation_model Pointer to the RadiationModel
+ * @param camera Camera label
+ * @param red_band Band label for the red channel
+ * @param green_band Band label for the green channel
+ * @param blue_band Band label for the blue channel
+ * @param flux_to_pixel_conversion Conversion factor (ignored if normalize is non-zero)
+ * @param normalize Non-zero to normalize by the maximum pixel value
+ * @param out Output buffer (may be NULL for a size query, answered from the camera resolution without reading pixels)
+ * @param capacity Number of floats available in out
+ * @param width Output: image width in pixels (may be NULL)
+ * @param height Output: image height in pixels (may be NULL)
+ * @return Number of values (3 per pixel); out is only written if capacity is at least this large
+ */
+PYHELIOS_API size_t getCameraImageRGBBuffer(RadiationModel* radiation_model, const char* camera,
+                                            const char* red_band, const char* green_band, const char* blue_band,
+                                            float flux_to_pixel_conversion, int normalize,
+                                            float* out, size_t capacity, int* width, int* height);
+
+/**
+ * @brief Same as getCameraImageRGBBuffer with values quantized to 8 bits (0-255)
+ */
+PYHELIOS_API size_t getCameraImageRGB8Buffer(RadiationModel* radiation_model, const char* camera,
+                                             const char* red_band, const char* green_band, const char* blue_band,
+                                             float flux_to_pixel_conversion, int normalize,
+                                             unsigned char* out, size_t capacity, int* width, int* height);
+
+/**
+ * @brief Copy the bounding boxes of labelled instances seen by a camera into a caller-provided buffer
+ * Each distinct value of an int or uint data label is one instance. Per instance, 6 values in order:
+ * data value, x min, y min, x max, y max (inclusive pixel coordinates, in the pixel order of
+ * getCameraImageBuffer) and pixel count. Instances are sorted by data value.
+ * @param radiation_model Pointer to the RadiationModel
+ * @param camera_label Camera label (a band must have been run with the camera)
+ * @param data_label Primitive data label, or object data label if object_data is non-zero
+ * @param object_data Non-zero to read the data from the parent object of each primitive
+ * @param out Output buffer (may be NULL for a size query)
+ * @param capacity Number of values available in out
+ * @param width Output: image width in pixels (may be NULL)
+ * @param height Output: image height in pixels (may be NULL)
+ * @return Number of values (6 per instance); out is only written if capacity is at least this large
+ */
+PYHELIOS_API size_t getImageBoundingBoxesBuffer(RadiationModel* radiation_model, const char* camera_label,
+                                                const char* data_label, int object_data,
+                                                unsigned int* out, size_t capacity, int* width, int* height);
+
+/**
+ * @brief Copy run-length encoded segmentation masks of labelled instances seen by a camera
+ * Instances are defined as in getImageBoundingBoxesBuffer. Per instance: data value, run count n,
+ * then n run lengths in COCO uncompressed RLE order (column-major, alternating background and
+ * foreground, starting with background; the runs sum to width * height).
+ * @param radiation_model Pointer to the RadiationModel
+ * @param camera_label Camera label (a band must have been run with the camera)
+ * @param data_label Primitive data label, or object data label if object_data is non-zero
+ * @param object_data Non-zero to read the data from the parent object of each primitive
+ * @param out Output buffer (may be NULL for a size query)
+ * @param capacity Number of values available in out
+ * @param width Output: image width in pixels (may be NULL)
+ * @param height Output: image height in pixels (may be NULL)
+ * @return Number of values; out is only written if capacity is at least this large
+ */
+PYHELIOS_API size_t getImageSegmentationMasksRLE(RadiationModel* radiation_model, const char* camera_label,
+                                                 const char* data_label, int object_data,
+                                                 unsigned int* out, size_t capacity, int* width, int* height);
+
 /**
  * @brief Write image bounding boxes (single primitive data label)
  * @param radiation_model Pointer to the RadiationModel
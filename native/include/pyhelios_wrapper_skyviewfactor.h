@@ -18,6 +18,14 @@ namespace helios {
     class Context;
 }
 
+/**
+ * Progress callback for chunked sky view factor calculation
+ * @param points_done Number of points completed so far
+ * @param total_points Total number of points requested
+ * @return 0 to continue, non-zero to stop after the current chunk
+ */
+typedef int (*SkyViewFactorProgressCallback)(size_t points_done, size_t total_points);
+
 // SkyViewFactorModel C interface functions
 
 /**
@@ -52,9 +60,39 @@ PYHELIOS_API float calculateSkyViewFactorCPU(SkyViewFactorModel* skyviewfactor_m
 // Multiple points calculation
 PYHELIOS_API void calculateSkyViewFactors(SkyViewFactorModel* skyviewfactor_model, float* points, size_t num_points, float* results, int num_threads);
 
+/**
+ * Calculate sky view factors for a large point cloud in bounded-memory chunks
+ * Only chunk_size points are converted and held by the model at a time; results are written
+ * directly into the caller's array as each chunk completes.
+ * @param skyviewfactor_model Pointer to SkyViewFactorModel instance
+ * @param points Flat array of num_points * 3 coordinates
+ * @param num_points Number of sample points
+ * @param results Output array of num_points sky view factors
+ * @param chunk_size Number of points evaluated per chunk (must be > 0)
+ * @param progress_cb Optional callback invoked after each chunk (may be NULL)
+ * @param num_threads Number of OpenMP threads per chunk (0 = auto)
+ * @return Number of points processed (less than num_points if cancelled by the callback)
+ */
+PYHELIOS_API size_t calculateSkyViewFactorsChunked(SkyViewFactorModel* skyviewfactor_model, const float* points, size_t num_points, float* results, size_t chunk_size, SkyViewFactorProgressCallback progress_cb, int num_threads);
+
 // Primitive centers calculation
 PYHELIOS_API size_t calculateSkyViewFactorsForPrimitives(SkyViewFactorModel* skyviewfactor_model, float* results, uint* primitive_ids, size_t num_primitives, int num_threads);
 
+/**
+ * Calculate sky view factors for many points on the CPU using all available cores
+ * Traces against the shared geometry BVH (rebuilt only when the Context geometry revision
+ * changes), distributing points over a thread pool. Each point draws its rays from its own random stream keyed on (seed, point index),
+ * so results are identical for a given seed regardless of num_threads.
+ * @param skyviewfactor_model Pointer to SkyViewFactorModel instance (supplies ray count and max ray length)
+ * @param context Helios context containing the occluding geometry
+ * @param points Flat array of num_points * 3 coordinates
+ * @param num_points Number of sample points
+ * @param results Output array of num_points sky view factors
+ * @param num_threads Number of worker threads (0 = hardware concurrency)
+ * @param seed Random seed for ray directions
+ */
+PYHELIOS_API void calculateSkyViewFactorsParallelCPU(SkyViewFactorModel* skyviewfactor_model, helios::Context* context, const float* points, size_t num_points, float* results, int num_threads, unsigned int seed);
+
 // Export/Import functionality
 PYHELIOS_API bool exportSkyViewFactors(SkyViewFactorModel* skyviewfactor_model, const char* filename);
 PYHELIOS_API bool loadSkyViewFactors(SkyViewFactorModel* skyviewfactor_model, const char* filename);
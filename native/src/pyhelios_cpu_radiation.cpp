@@ -0,0 +1,2355 @@
+// PyHelios CPU radiation engine
+// Traces direct, sky diffuse, emitted and scattered radiation against the shared geometry BVH on a thread pool
+
+#include "../include/pyhelios_cpu_radiation.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+namespace pyhelios {
+
+    class CPUWorkerPool {
+    public:
+        explicit CPUWorkerPool(unsigned int size) {
+            for (unsigned int w = 1; w < size; ++w) {
+                threads.emplace_back(&CPUWorkerPool::loop, this, w);
+            }
+        }
+
+        ~CPUWorkerPool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            start_condition.notify_all();
+            for (std::thread& t : threads) {
+                t.join();
+            }
+        }
+
+        //! Run worker(w) for w in [0, num_threads); worker 0 runs on the calling thread
+        void run(unsigned int num_threads, const std::function<void(unsigned int)>& worker) {
+            // A loop started while another one owns the threads (or from inside one) runs serially
+            std::unique_lock<std::mutex> busy(run_mutex, std::try_to_lock);
+            const unsigned int helpers = busy.owns_lock() ? std::min<unsigned int>(num_threads - 1, static_cast<unsigned int>(threads.size())) : 0;
+            if (helpers == 0) {
+                worker(0);
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                job = &worker;
+                job_helpers = helpers;
+                pending = helpers;
+                error = nullptr;
+                generation++;
+            }
+            start_condition.notify_all();
+
+            std::exception_ptr caller_error;
+            try {
+                worker(0);
+            } catch (...) {
+                caller_error = std::current_exception();
+            }
+
+            std::unique_lock<std::mutex> lock(mutex);
+            done_condition.wait(lock, [&] { return pending == 0; });
+            job = nullptr;
+            if (caller_error) {
+                std::rethrow_exception(caller_error);
+            }
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+    private:
+        void loop(unsigned int w) {
+            uint64_t seen = 0;
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true) {
+                start_condition.wait(lock, [&] { return stopping || generation != seen; });
+                if (stopping) {
+                    return;
+                }
+                seen = generation;
+                if (w > job_helpers) {
+                    continue;
+                }
+                const std::function<void(unsigned int)>* current = job;
+                lock.unlock();
+                std::exception_ptr failure;
+                try {
+                    (*current)(w);
+                } catch (...) {
+                    failure = std::current_exception();
+                }
+                lock.lock();
+                if (failure && !error) {
+                    error = failure;
+                }
+                if (--pending == 0) {
+                    done_condition.notify_one();
+                }
+            }
+        }
+
+        std::vector<std::thread> threads;
+        std::mutex run_mutex;
+        std::mutex mutex;
+        std::condition_variable start_condition;
+        std::condition_variable done_condition;
+        const std::function<void(unsigned int)>* job = nullptr;
+        unsigned int job_helpers = 0;
+        unsigned int pending = 0;
+        uint64_t generation = 0;
+        bool stopping = false;
+        std::exception_ptr error;
+    };
+
+    namespace {
+
+        const float STEFAN_BOLTZMANN = 5.670374419e-8f;
+        const float NO_HIT_DISTANCE = 1e30f;
+        const size_t PRIMITIVES_PER_TASK = 64;
+
+        // Every (phase, primitive, face or source) draws from its own random stream, so a run
+        // samples the same rays no matter how primitives are distributed over threads
+        const uint64_t PHASE_DIRECT = 1;
+        const uint64_t PHASE_DIFFUSE = 2;
+        const uint64_t PHASE_SCATTER = 3;
+        const uint64_t PHASE_VIEW_FACTOR = 4;
+        const uint64_t PHASE_CAMERA = 5;
+        const uint64_t PHASE_SUNLIT = 6;
+
+        // Rays crossing periodic boundaries more often than this are treated as escaping
+        const uint MAX_PERIODIC_WRAPS = 64;
+
+        // Camera pixels are traced in square tiles so neighbouring rays traverse the same BVH nodes
+        const uint CAMERA_TILE_SIZE = 8;
+
+        inline uint64_t streamKey(uint64_t phase, uint64_t primitive, uint64_t sub) {
+            return (phase << 58) ^ (sub << 32) ^ primitive;
+        }
+
+        // Dynamic scheduling of fixed-size ranges of work items; fn(begin, end, worker) runs on the pool's threads
+        template <typename Fn>
+        void parallelFor(CPUWorkerPool& pool, size_t count, unsigned int num_threads, Fn fn, size_t items_per_task = PRIMITIVES_PER_TASK) {
+            const size_t tasks = (count + items_per_task - 1) / items_per_task;
+            std::atomic<size_t> next_task(0);
+            auto worker = [&](unsigned int w) {
+                for (size_t t = next_task++; t < tasks; t = next_task++) {
+                    fn(t * items_per_task, std::min(count, (t + 1) * items_per_task), w);
+                }
+            };
+            if (num_threads <= 1) {
+                worker(0);
+                return;
+            }
+            pool.run(num_threads, worker);
+        }
+
+        inline helios::vec3 normalized(const helios::vec3& v) {
+            float m = std::sqrt(v * v);
+            return m > 0.f ? v / m : v;
+        }
+
+        // Orthonormal tangents (t, b) completing the unit vector n
+        inline void makeBasis(const helios::vec3& n, helios::vec3& t, helios::vec3& b) {
+            t = normalized(cross(n, std::fabs(n.x) > 0.9f ? helios::make_vec3(0.f, 1.f, 0.f) : helios::make_vec3(1.f, 0.f, 0.f)));
+            b = cross(n, t);
+        }
+
+        inline helios::vec3 sampleCosineHemisphere(const helios::vec3& n, const helios::vec3& t, const helios::vec3& b, RandomStream& rng) {
+            float u1 = rng.uniform();
+            float u2 = rng.uniform();
+            float r = std::sqrt(u1);
+            float phi = 2.f * float(M_PI) * u2;
+            return t * (r * std::cos(phi)) + b * (r * std::sin(phi)) + n * std::sqrt(std::max(0.f, 1.f - u1));
+        }
+
+        // Uniform direction inside a cone of the given half angle around the unit vector axis
+        inline helios::vec3 sampleCone(const helios::vec3& axis, float half_angle, RandomStream& rng) {
+            if (half_angle <= 0.f) {
+                return axis;
+            }
+            helios::vec3 t, b;
+            makeBasis(axis, t, b);
+            float cos_theta = 1.f - rng.uniform() * (1.f - std::cos(half_angle));
+            float sin_theta = std::sqrt(std::max(0.f, 1.f - cos_theta * cos_theta));
+            float phi = 2.f * float(M_PI) * rng.uniform();
+            return t * (sin_theta * std::cos(phi)) + b * (sin_theta * std::sin(phi)) + axis * cos_theta;
+        }
+
+        inline helios::vec3 sampleSphere(RandomStream& rng) {
+            float z = 1.f - 2.f * rng.uniform();
+            float r = std::sqrt(std::max(0.f, 1.f - z * z));
+            float phi = 2.f * float(M_PI) * rng.uniform();
+            return helios::make_vec3(r * std::cos(phi), r * std::sin(phi), z);
+        }
+
+        float getPrimitiveFloat(helios::Context* context, uint uuid, const std::string& label, float default_value) {
+            if (!context->doesPrimitiveDataExist(uuid, label.c_str())) {
+                return default_value;
+            }
+            float value;
+            context->getPrimitiveData(uuid, label.c_str(), value);
+            return value;
+        }
+
+        // Spectrum value at a wavelength: linear between samples, constant beyond the ends, 1 for a flat (empty) spectrum
+        float interpolateSpectrum(const std::vector<helios::vec2>& spectrum, float wavelength) {
+            if (spectrum.empty()) {
+                return 1.f;
+            }
+            if (wavelength <= spectrum.front().x) {
+                return spectrum.front().y;
+            }
+            if (wavelength >= spectrum.back().x) {
+                return spectrum.back().y;
+            }
+            auto it = std::upper_bound(spectrum.begin(), spectrum.end(), wavelength, [](float w, const helios::vec2& sample) {
+                return w < sample.x;
+            });
+            const helios::vec2& hi = *it;
+            const helios::vec2& lo = *(it - 1);
+            float t = hi.x > lo.x ? (wavelength - lo.x) / (hi.x - lo.x) : 0.f;
+            return lo.y + t * (hi.y - lo.y);
+        }
+
+        // Integral of the product of two functions that are linear on [a, b] (Simpson's rule is exact for the quadratic product)
+        inline double productIntegral(double a, double b, double s0, double s1, double w0, double w1) {
+            return (b - a) / 6.0 * (s0 * w0 + (s0 + s1) * (w0 + w1) + s1 * w1);
+        }
+
+    } // namespace
+
+    CPURadiationModel::CPURadiationModel(helios::Context* context) : context(context) {
+        if (!context) {
+            throw std::runtime_error("Context pointer is null");
+        }
+    }
+
+    CPURadiationModel::~CPURadiationModel() {
+        releasePrimitiveObserver(context, this);
+    }
+
+    void CPURadiationModel::setThreadCount(int num_threads) {
+        if (num_threads < 0) {
+            throw std::runtime_error("Thread count must be non-negative");
+        }
+        thread_count = static_cast<unsigned int>(num_threads);
+        std::lock_guard<std::mutex> lock(worker_pool_mutex);
+        worker_pool.reset();  // loops still running keep the old pool alive until they finish
+    }
+
+    std::shared_ptr<CPUWorkerPool> CPURadiationModel::workerPool() const {
+        std::lock_guard<std::mutex> lock(worker_pool_mutex);
+        if (!worker_pool) {
+            unsigned int n = thread_count > 0 ? thread_count : std::thread::hardware_concurrency();
+            worker_pool = std::make_shared<CPUWorkerPool>(std::max(1u, n));
+        }
+        return worker_pool;
+    }
+
+    unsigned int CPURadiationModel::workerCount(size_t work_items) const {
+        unsigned int n = thread_count > 0 ? thread_count : std::thread::hardware_concurrency();
+        size_t tasks = (work_items + PRIMITIVES_PER_TASK - 1) / PRIMITIVES_PER_TASK;
+        return static_cast<unsigned int>(std::max<size_t>(1, std::min<size_t>(n > 0 ? n : 1, tasks)));
+    }
+
+    void CPURadiationModel::addBand(const std::string& label) {
+        if (label.empty()) {
+            throw std::runtime_error("Band label is empty");
+        }
+        if (bands.count(label)) {
+            throw std::runtime_error("Radiation band '" + label + "' already exists");
+        }
+        bands[label] = CPURadiationBand();
+    }
+
+    void CPURadiationModel::addBand(const std::string& label, float wavelength_min, float wavelength_max) {
+        if (!(wavelength_min > 0.f) || !(wavelength_max > wavelength_min)) {
+            throw std::runtime_error("Band wavelength range must satisfy 0 < min < max, got " + std::to_string(wavelength_min) + " to " + std::to_string(wavelength_max));
+        }
+        addBand(label);
+        bands[label].wavelength_min = wavelength_min;
+        bands[label].wavelength_max = wavelength_max;
+    }
+
+    void CPURadiationModel::copyBand(const std::string& old_label, const std::string& new_label) {
+        const CPURadiationBand band = getBand(old_label);
+        addBand(new_label);
+        bands[new_label] = band;
+        for (CPURadiationSource& source : sources) {
+            auto it = source.fluxes.find(old_label);
+            if (it != source.fluxes.end()) {
+                source.fluxes[new_label] = it->second;
+            }
+        }
+    }
+
+    bool CPURadiationModel::doesBandExist(const std::string& label) const {
+        return bands.count(label) > 0;
+    }
+
+    CPURadiationBand& CPURadiationModel::getBand(const std::string& label) {
+        auto it = bands.find(label);
+        if (it == bands.end()) {
+            throw std::runtime_error("Radiation band '" + label + "' does not exist");
+        }
+        return it->second;
+    }
+
+    const CPURadiationBand& CPURadiationModel::getBand(const std::string& label) const {
+        auto it = bands.find(label);
+        if (it == bands.end()) {
+            throw std::runtime_error("Radiation band '" + label + "' does not exist");
+        }
+        return it->second;
+    }
+
+    uint CPURadiationModel::addCollimatedSource(const helios::vec3& direction) {
+        if (direction * direction <= 0.f) {
+            throw std::runtime_error("Collimated source direction must be non-zero");
+        }
+        CPURadiationSource source;
+        source.type = CPURadiationSourceType::COLLIMATED;
+        source.direction = normalized(direction);
+        sources.push_back(source);
+        return static_cast<uint>(sources.size() - 1);
+    }
+
+    uint CPURadiationModel::addSphereSource(const helios::vec3& position, float radius) {
+        if (radius <= 0.f) {
+            throw std::runtime_error("Sphere source radius must be positive");
+        }
+        CPURadiationSource source;
+        source.type = CPURadiationSourceType::SPHERE;
+        source.position = position;
+        source.radius = radius;
+        sources.push_back(source);
+        return static_cast<uint>(sources.size() - 1);
+    }
+
+    uint CPURadiationModel::addSunSphereSource(float zenith, float azimuth, float angular_width, float flux_scaling) {
+        const float deg = float(M_PI) / 180.f;
+        CPURadiationSource source;
+        source.type = CPURadiationSourceType::SUN_SPHERE;
+        source.direction = helios::make_vec3(std::sin(zenith * deg) * std::sin(azimuth * deg), std::sin(zenith * deg) * std::cos(azimuth * deg), std::cos(zenith * deg));
+        source.half_angle = 0.5f * std::max(0.f, angular_width) * deg;
+        source.flux_scaling = flux_scaling;
+        sources.push_back(source);
+        return static_cast<uint>(sources.size() - 1);
+    }
+
+    void CPURadiationModel::setSourceFlux(uint source_id, const std::string& band_label, float flux) {
+        if (source_id >= sources.size()) {
+            throw std::runtime_error("Radiation source " + std::to_string(source_id) + " does not exist");
+        }
+        getBand(band_label);
+        sources[source_id].fluxes[band_label] = flux;
+        if (responses.count(band_label)) {
+            stale_bands.insert(band_label);
+        }
+    }
+
+    float CPURadiationModel::getSourceFlux(uint source_id, const std::string& band_label) const {
+        if (source_id >= sources.size()) {
+            throw std::runtime_error("Radiation source " + std::to_string(source_id) + " does not exist");
+        }
+        getBand(band_label);
+        auto it = sources[source_id].fluxes.find(band_label);
+        return it != sources[source_id].fluxes.end() ? it->second : 0.f;
+    }
+
+    void CPURadiationModel::setSourceSpectrum(uint source_id, const std::string& spectrum_label) {
+        if (source_id >= sources.size()) {
+            throw std::runtime_error("Radiation source " + std::to_string(source_id) + " does not exist");
+        }
+        if (!spectrum_label.empty()) {
+            readSpectrum(spectrum_label);
+        }
+        sources[source_id].spectrum = spectrum_label;
+    }
+
+    std::vector<helios::vec2> CPURadiationModel::readSpectrum(const std::string& label) const {
+        if (label.empty()) {
+            return {};
+        }
+        if (!context->doesGlobalDataExist(label.c_str())) {
+            throw std::runtime_error("Spectrum '" + label + "' does not exist in the Context global data");
+        }
+        std::vector<helios::vec2> spectrum;
+        context->getGlobalData(label.c_str(), spectrum);
+        if (spectrum.empty()) {
+            throw std::runtime_error("Spectrum '" + label + "' is empty");
+        }
+        for (size_t i = 1; i < spectrum.size(); ++i) {
+            if (spectrum[i].x < spectrum[i - 1].x) {
+                throw std::runtime_error("Spectrum '" + label + "' wavelengths must be in ascending order");
+            }
+        }
+        return spectrum;
+    }
+
+    void CPURadiationModel::validateSpectralTables() {
+        auto same = [](const std::vector<helios::vec2>& a, const std::vector<helios::vec2>& b) {
+            return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](const helios::vec2& p, const helios::vec2& q) {
+                return p.x == q.x && p.y == q.y;
+            });
+        };
+        // Tables whose global data changed or disappeared are dropped and rebuilt (or reported) on next use
+        for (auto it = spectral_tables.begin(); it != spectral_tables.end();) {
+            bool valid;
+            try {
+                valid = same(it->second.spectrum, readSpectrum(it->first.first)) && same(it->second.weight, readSpectrum(it->first.second));
+            } catch (const std::runtime_error&) {
+                valid = false;
+            }
+            it = valid ? std::next(it) : spectral_tables.erase(it);
+        }
+    }
+
+    const CPURadiationModel::SpectralTable& CPURadiationModel::spectralTable(const std::string& spectrum_label, const std::string& weight_label) {
+        const auto key = std::make_pair(spectrum_label, weight_label);
+        auto cached = spectral_tables.find(key);
+        if (cached != spectral_tables.end()) {
+            return cached->second;
+        }
+
+        // Both spectra are linear between the merged samples, so each interval integrates exactly
+        SpectralTable table;
+        table.spectrum = readSpectrum(spectrum_label);
+        table.weight = readSpectrum(weight_label);
+        table.wavelengths.clear();
+        for (const helios::vec2& sample : table.spectrum) {
+            table.wavelengths.push_back(sample.x);
+        }
+        for (const helios::vec2& sample : table.weight) {
+            table.wavelengths.push_back(sample.x);
+        }
+        std::sort(table.wavelengths.begin(), table.wavelengths.end());
+        table.wavelengths.erase(std::unique(table.wavelengths.begin(), table.wavelengths.end()), table.wavelengths.end());
+        const size_t n = table.wavelengths.size();
+        table.spectrum_values.resize(n);
+        table.weight_values.resize(n);
+        table.prefix.assign(n, 0.0);
+        for (size_t i = 0; i < n; ++i) {
+            table.spectrum_values[i] = interpolateSpectrum(table.spectrum, table.wavelengths[i]);
+            table.weight_values[i] = interpolateSpectrum(table.weight, table.wavelengths[i]);
+            if (i > 0) {
+                table.prefix[i] = table.prefix[i - 1] + productIntegral(table.wavelengths[i - 1], table.wavelengths[i], table.spectrum_values[i - 1], table.spectrum_values[i],
+                                                                        table.weight_values[i - 1], table.weight_values[i]);
+            }
+        }
+        return spectral_tables.emplace(key, std::move(table)).first->second;
+    }
+
+    float CPURadiationModel::averageSpectrum(const std::string& spectrum_label, const std::string& weight_label, float wavelength_min, float wavelength_max) {
+        if (spectrum_label.empty()) {
+            throw std::runtime_error("Spectrum label is empty");
+        }
+        if (!(wavelength_max > wavelength_min)) {
+            throw std::runtime_error("Wavelength range must satisfy min < max");
+        }
+
+        // Integral from the first merged wavelength to x; values are held constant outside the samples
+        auto cumulative = [](const SpectralTable& table, float x) {
+            const std::vector<float>& w = table.wavelengths;
+            const size_t n = w.size();
+            if (x <= w.front()) {
+                return (double(x) - w.front()) * table.spectrum_values.front() * table.weight_values.front();
+            }
+            if (x >= w.back()) {
+                return table.prefix.back() + (double(x) - w.back()) * table.spectrum_values.back() * table.weight_values.back();
+            }
+            size_t k = static_cast<size_t>(std::upper_bound(w.begin(), w.end(), x) - w.begin()) - 1;
+            k = std::min(k, n - 2);
+            double t = (double(x) - w[k]) / (double(w[k + 1]) - w[k]);
+            double s = table.spectrum_values[k] + t * (table.spectrum_values[k + 1] - table.spectrum_values[k]);
+            double g = table.weight_values[k] + t * (table.weight_values[k + 1] - table.weight_values[k]);
+            return table.prefix[k] + productIntegral(w[k], x, table.spectrum_values[k], s, table.weight_values[k], g);
+        };
+
+        const SpectralTable& product = spectralTable(spectrum_label, weight_label);
+        const double numerator = cumulative(product, wavelength_max) - cumulative(product, wavelength_min);
+        if (weight_label.empty()) {
+            return static_cast<float>(numerator / (double(wavelength_max) - wavelength_min));
+        }
+        const SpectralTable& normalization = spectralTable("", weight_label);
+        const double denominator = cumulative(normalization, wavelength_max) - cumulative(normalization, wavelength_min);
+        return denominator > 0.0 ? static_cast<float>(numerator / denominator) : 0.f;
+    }
+
+    size_t CPURadiationModel::getSpectralCacheSize() const {
+        return spectral_tables.size();
+    }
+
+    std::string CPURadiationModel::bandWeightSpectrum() const {
+        for (const CPURadiationSource& source : sources) {
+            if (!source.spectrum.empty()) {
+                return source.spectrum;
+            }
+        }
+        return "";
+    }
+
+    void CPURadiationModel::setDiffuseFlux(const std::string& band_label, float flux) {
+        getBand(band_label).diffuse_flux = flux;
+        if (responses.count(band_label)) {
+            stale_bands.insert(band_label);
+        }
+    }
+
+    void CPURadiationModel::setFluxSuperposition(bool enable) {
+        if (!enable) {
+            refreshStaleBands();
+            responses.clear();
+        }
+        flux_superposition = enable;
+    }
+
+    void CPURadiationModel::enableViewFactorOperator(float tolerance, size_t max_bytes) {
+        if (tolerance < 0.f) {
+            throw std::runtime_error("View factor tolerance must be non-negative");
+        }
+        if (!view_factor_enabled || tolerance != view_factor_tolerance || max_bytes != view_factor_max_bytes) {
+            disableViewFactorOperator();
+        }
+        view_factor_enabled = true;
+        view_factor_tolerance = tolerance;
+        view_factor_max_bytes = max_bytes;
+    }
+
+    void CPURadiationModel::disableViewFactorOperator() {
+        view_factor_enabled = false;
+        view_factor_ready = false;
+        view_factors = ViewFactorOperator();
+    }
+
+    size_t CPURadiationModel::getViewFactorOperatorBytes() const {
+        return view_factor_ready ? view_factors.bytes() : 0;
+    }
+
+    size_t CPURadiationModel::getViewFactorOperatorNonzeros() const {
+        return view_factor_ready ? view_factors.values.size() : 0;
+    }
+
+    void CPURadiationModel::precomputeSunlitFractions(const std::vector<helios::vec3>& directions, size_t ray_count, float max_angle) {
+        auto start = std::chrono::steady_clock::now();
+        requireGeometry();
+        if (directions.empty()) {
+            throw std::runtime_error("At least one sun direction is required");
+        }
+        if (ray_count == 0) {
+            throw std::runtime_error("Sunlit fraction ray count must be positive");
+        }
+        if (!(max_angle >= 0.f)) {
+            throw std::runtime_error("Sunlit fraction max angle must be non-negative");
+        }
+        SunlitFractionCache cache;
+        cache.max_angle = max_angle;
+        for (const helios::vec3& direction : directions) {
+            if (direction * direction == 0.f) {
+                throw std::runtime_error("Sun direction cannot be a zero vector");
+            }
+            cache.directions.push_back(normalized(direction));
+        }
+        const size_t D = cache.directions.size();
+        cache.fractions.assign(primitives.size() * D, 0);
+
+        // Each sample point is tested against every direction, so the points are drawn once per primitive
+        parallelFor(*workerPool(), primitives.size(), workerCount(primitives.size()), [&](size_t begin, size_t end, unsigned int) {
+            std::vector<helios::vec3> points(ray_count);
+            std::vector<uint32_t> lit(D);
+            for (size_t i = begin; i < end; ++i) {
+                const ScenePrimitive& primitive = primitives[i];
+                RandomStream rng(random_seed, streamKey(PHASE_SUNLIT, i, 0));
+                for (helios::vec3& point : points) {
+                    point = samplePoint(primitive, rng);
+                }
+                std::fill(lit.begin(), lit.end(), 0u);
+                for (const helios::vec3& point : points) {
+                    for (size_t d = 0; d < D; ++d) {
+                        if (!occludedRay(point, cache.directions[d], NO_HIT_DISTANCE, primitive.index)) {
+                            lit[d]++;
+                        }
+                    }
+                }
+                for (size_t d = 0; d < D; ++d) {
+                    cache.fractions[i * D + d] = static_cast<uint8_t>(std::lround(255.0 * lit[d] / double(ray_count)));
+                }
+            }
+        });
+        sunlit = std::move(cache);
+
+        if (message_flag) {
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "CPU radiation sunlit fractions: " << D << " direction" << (D > 1 ? "s, " : ", ") << primitives.size() << " primitives, " << seconds << " s" << std::endl;
+        }
+    }
+
+    void CPURadiationModel::clearSunlitFractions() {
+        sunlit = SunlitFractionCache();
+    }
+
+    size_t CPURadiationModel::getSunlitFractionBytes() const {
+        return sunlit.fractions.size() * sizeof(uint8_t) + sunlit.directions.size() * sizeof(helios::vec3);
+    }
+
+    bool CPURadiationModel::lookupSunlitFraction(const helios::vec3& direction, uint32_t index[2], float weight[2]) const {
+        if (sunlit.directions.empty()) {
+            return false;
+        }
+        const helios::vec3 dir = normalized(direction);
+        float angle[2] = {NO_HIT_DISTANCE, NO_HIT_DISTANCE};
+        index[0] = index[1] = 0;
+        for (size_t d = 0; d < sunlit.directions.size(); ++d) {
+            float a = std::acos(std::max(-1.f, std::min(1.f, dir * sunlit.directions[d])));
+            if (a < angle[0]) {
+                angle[1] = angle[0];
+                index[1] = index[0];
+                angle[0] = a;
+                index[0] = static_cast<uint32_t>(d);
+            } else if (a < angle[1]) {
+                angle[1] = a;
+                index[1] = static_cast<uint32_t>(d);
+            }
+        }
+        if (angle[0] > sunlit.max_angle) {
+            return false;
+        }
+        // Inverse-angle weights between the two nearest directions; an exact match uses one entry
+        if (angle[1] > sunlit.max_angle || angle[0] < 1e-6f) {
+            weight[0] = 1.f;
+            weight[1] = 0.f;
+        } else {
+            weight[0] = angle[1] / (angle[0] + angle[1]);
+            weight[1] = angle[0] / (angle[0] + angle[1]);
+        }
+        return true;
+    }
+
+    void CPURadiationModel::updateGeometry() {
+        geometry_subset = false;
+        geometry_scope.clear();
+        buildScene();
+    }
+
+    void CPURadiationModel::updateGeometry(const std::vector<uint>& uuids) {
+        geometry_subset = true;
+        geometry_scope = uuids;
+        std::sort(geometry_scope.begin(), geometry_scope.end());
+        geometry_scope.erase(std::unique(geometry_scope.begin(), geometry_scope.end()), geometry_scope.end());
+        buildScene();
+    }
+
+    size_t CPURadiationModel::updateGeometryDirty() {
+        // Unchanged revision: nothing moved since the scene was last synced, so skip the per-primitive diff
+        const uint64_t revision = getGeometryRevision(context);
+        if (geometry_ready && revision == synced_revision) {
+            return 0;
+        }
+        PrimitiveChangeSet changes = getPrimitiveChanges(context, this, geometry_ready);
+
+        auto in_scope = [&](uint uuid) {
+            return !geometry_subset || std::binary_search(geometry_scope.begin(), geometry_scope.end(), uuid);
+        };
+        size_t changed = 0;
+        for (uint uuid : changes.modified) changed += in_scope(uuid) ? 1 : 0;
+        for (uint uuid : changes.deleted) changed += in_scope(uuid) ? 1 : 0;
+        if (!geometry_subset) changed += changes.added.size();
+
+        if (!geometry_ready || !changes.has_baseline) {
+            if (geometry_subset) {
+                updateGeometry(std::vector<uint>(geometry_scope));
+            } else {
+                updateGeometry();
+            }
+            return changes.added.size();
+        }
+        if (changed == 0) {
+            synced_revision = revision;  // out-of-scope primitives are transparent in the current BVH
+            return 0;
+        }
+
+        if (geometry_subset) {
+            geometry_scope.erase(std::remove_if(geometry_scope.begin(), geometry_scope.end(), [&](uint uuid) {
+                return std::binary_search(changes.deleted.begin(), changes.deleted.end(), uuid);
+            }), geometry_scope.end());
+        }
+
+        try {
+            // Pending responses are applied while the primitives they were traced on are still current
+            refreshStaleBands();
+            std::shared_ptr<const GeometryBVH> previous = bvh;
+            bvh = acquireGeometryBVH(context);
+
+            if (bvh->primitive_uuids == previous->primitive_uuids && bvh->triangle_sources == previous->triangle_sources) {
+                // Refit: the triangle order is unchanged, so only the modified primitives are re-measured
+                for (ScenePrimitive& primitive : primitives) {
+                    if (std::binary_search(changes.modified.begin(), changes.modified.end(), primitive.uuid)) {
+                        measurePrimitive(primitive);
+                    }
+                }
+                updateSceneBounds();
+            } else {
+                std::vector<std::pair<uint, uint>> known_parents;
+                known_parents.reserve(primitives.size());
+                for (const ScenePrimitive& primitive : primitives) {
+                    known_parents.emplace_back(primitive.uuid, primitive.parent_object);
+                }
+                std::sort(known_parents.begin(), known_parents.end());
+                layoutScene(known_parents);
+            }
+        } catch (...) {
+            // The scene may be half updated: require a full update instead of diffing against the new baseline
+            geometry_ready = false;
+            releasePrimitiveObserver(context, this);
+            throw;
+        }
+        resetSceneCaches();
+        synced_revision = bvh->revision;
+        return changed;
+    }
+
+    void CPURadiationModel::enforcePeriodicBoundary(const std::string& boundary) {
+        bool x = false, y = false;
+        if (boundary == "x") {
+            x = true;
+        } else if (boundary == "y") {
+            y = true;
+        } else if (boundary == "xy" || boundary == "yx") {
+            x = y = true;
+        } else if (!boundary.empty()) {
+            throw std::runtime_error("Periodic boundary must be \"x\", \"y\", \"xy\" or empty, got \"" + boundary + "\"");
+        }
+        if (x == periodic_x && y == periodic_y) {
+            return;
+        }
+        periodic_x = x;
+        periodic_y = y;
+
+        // Cached responses, the exchange operator and sunlit fractions were traced with the old boundaries
+        refreshStaleBands();
+        responses.clear();
+        view_factor_ready = false;
+        view_factors = ViewFactorOperator();
+        sunlit = SunlitFractionCache();
+    }
+
+    bool CPURadiationModel::traceRay(helios::vec3 origin, const helios::vec3& direction, float tmax, float& t_hit, uint32_t& triangle, uint32_t ignore_primitive) const {
+        const uint8_t* mask = primitive_mask.data();
+        const bool wrap_x = periodic_x && scene_max.x > scene_min.x;
+        const bool wrap_y = periodic_y && scene_max.y > scene_min.y;
+        if (!wrap_x && !wrap_y) {
+            return bvh->intersect(origin, direction, tmax, t_hit, triangle, mask, ignore_primitive);
+        }
+
+        // A ray that leaves the scene through a periodic side re-enters through the opposite side. The scene
+        // lies inside its bounding box, so a miss means no hit before the ray leaves the box.
+        float traveled = 0.f;
+        for (uint wrap = 0; wrap <= MAX_PERIODIC_WRAPS; ++wrap) {
+            if (bvh->intersect(origin, direction, tmax - traveled, t_hit, triangle, mask, wrap == 0 ? ignore_primitive : NO_PRIMITIVE)) {
+                t_hit += traveled;
+                return true;
+            }
+            float t_side = NO_HIT_DISTANCE;
+            int axis = -1;
+            if (wrap_x && direction.x != 0.f) {
+                float t = ((direction.x > 0.f ? scene_max.x : scene_min.x) - origin.x) / direction.x;
+                if (t < t_side) {
+                    t_side = t;
+                    axis = 0;
+                }
+            }
+            if (wrap_y && direction.y != 0.f) {
+                float t = ((direction.y > 0.f ? scene_max.y : scene_min.y) - origin.y) / direction.y;
+                if (t < t_side) {
+                    t_side = t;
+                    axis = 1;
+                }
+            }
+            t_side = std::max(0.f, t_side);
+            // Distance to the first non-periodic face of the box the ray leaves through
+            float t_escape = NO_HIT_DISTANCE;
+            for (int a = 0; a < 3; ++a) {
+                const float d = a == 0 ? direction.x : (a == 1 ? direction.y : direction.z);
+                if (d == 0.f || (a == 0 && wrap_x) || (a == 1 && wrap_y)) {
+                    continue;
+                }
+                const float o = a == 0 ? origin.x : (a == 1 ? origin.y : origin.z);
+                const float bound = d > 0.f ? (a == 0 ? scene_max.x : (a == 1 ? scene_max.y : scene_max.z)) : (a == 0 ? scene_min.x : (a == 1 ? scene_min.y : scene_min.z));
+                t_escape = std::min(t_escape, (bound - o) / d);
+            }
+            if (axis < 0 || t_escape <= t_side || traveled + t_side >= tmax) {
+                return false;  // leaves through a non-periodic face, or reaches its end first
+            }
+            origin = origin + direction * t_side;
+            if (axis == 0) {
+                origin.x += direction.x > 0.f ? scene_min.x - scene_max.x : scene_max.x - scene_min.x;
+            } else {
+                origin.y += direction.y > 0.f ? scene_min.y - scene_max.y : scene_max.y - scene_min.y;
+            }
+            traveled += t_side;
+        }
+        return false;
+    }
+
+    bool CPURadiationModel::occludedRay(const helios::vec3& origin, const helios::vec3& direction, float tmax, uint32_t ignore_primitive) const {
+        if (!periodic_x && !periodic_y) {
+            return bvh->occluded(origin, direction, tmax, primitive_mask.data(), ignore_primitive);
+        }
+        float t_hit;
+        uint32_t triangle;
+        return traceRay(origin, direction, tmax, t_hit, triangle, ignore_primitive);
+    }
+
+    void CPURadiationModel::buildScene() {
+        // Pending responses are applied while the primitives they were traced on are still current
+        refreshStaleBands();
+
+        bvh = acquireGeometryBVH(context);
+        layoutScene({});
+        resetSceneCaches();
+
+        geometry_ready = true;
+        synced_revision = bvh->revision;
+        getPrimitiveChanges(context, this, true);
+    }
+
+    void CPURadiationModel::layoutScene(const std::vector<std::pair<uint, uint>>& known_parents) {
+        const size_t primitive_count = bvh->primitive_uuids.size();
+
+        std::vector<uint32_t> triangle_counts(primitive_count, 0);
+        for (uint32_t source : bvh->triangle_sources) {
+            triangle_counts[source]++;
+        }
+
+        primitives.clear();
+        primitive_mask.assign(primitive_count, 0);
+        scene_index.assign(primitive_count, NO_PRIMITIVE);
+        uint32_t triangle_offset = 0;
+        for (uint32_t p = 0; p < primitive_count; ++p) {
+            uint uuid = bvh->primitive_uuids[p];
+            if (triangle_counts[p] == 0) {
+                continue;  // voxels and degenerate primitives
+            }
+            if (geometry_subset && !std::binary_search(geometry_scope.begin(), geometry_scope.end(), uuid)) {
+                continue;
+            }
+            ScenePrimitive primitive;
+            primitive.uuid = uuid;
+            primitive.index = p;
+            primitive.area = 0.f;
+            auto known = std::lower_bound(known_parents.begin(), known_parents.end(), std::make_pair(uuid, 0u));
+            primitive.parent_object = known != known_parents.end() && known->first == uuid ? known->second : context->getPrimitiveParentObjectID(uuid);
+            primitive.first_triangle = triangle_offset;
+            primitive.triangle_count = 0;
+            triangle_offset += triangle_counts[p];
+            scene_index[p] = static_cast<uint32_t>(primitives.size());
+            primitives.push_back(primitive);
+        }
+
+        // Group BVH triangles by primitive, then measure each primitive and the scene bounds
+        scene_triangles.assign(triangle_offset, 0);
+        triangle_cdf.assign(triangle_offset, 0.f);
+        for (uint32_t i = 0; i < bvh->triangles.size(); ++i) {
+            uint32_t s = scene_index[bvh->triangle_sources[i]];
+            if (s != NO_PRIMITIVE) {
+                ScenePrimitive& primitive = primitives[s];
+                scene_triangles[primitive.first_triangle + primitive.triangle_count++] = i;
+            }
+        }
+        for (ScenePrimitive& primitive : primitives) {
+            measurePrimitive(primitive);
+        }
+        updateSceneBounds();
+    }
+
+    void CPURadiationModel::measurePrimitive(ScenePrimitive& primitive) {
+        primitive.area = 0.f;
+        for (uint32_t k = 0; k < primitive.triangle_count; ++k) {
+            const BVHTriangle& tri = bvh->triangles[scene_triangles[primitive.first_triangle + k]];
+            helios::vec3 n = cross(tri.e1, tri.e2);
+            if (k == 0) {
+                primitive.normal = normalized(n);  // both halves of a patch share the same winding
+            }
+            primitive.area += 0.5f * std::sqrt(n * n);
+            triangle_cdf[primitive.first_triangle + k] = primitive.area;
+        }
+        for (uint32_t k = 0; k < primitive.triangle_count; ++k) {
+            triangle_cdf[primitive.first_triangle + k] = primitive.area > 0.f ? triangle_cdf[primitive.first_triangle + k] / primitive.area : 1.f;
+        }
+        primitive_mask[primitive.index] = primitive.area > 0.f ? 1 : 0;
+    }
+
+    void CPURadiationModel::updateSceneBounds() {
+        scene_min = helios::make_vec3(NO_HIT_DISTANCE, NO_HIT_DISTANCE, NO_HIT_DISTANCE);
+        scene_max = helios::make_vec3(-NO_HIT_DISTANCE, -NO_HIT_DISTANCE, -NO_HIT_DISTANCE);
+        for (uint32_t triangle : scene_triangles) {
+            const BVHTriangle& tri = bvh->triangles[triangle];
+            for (const helios::vec3& v : {tri.v0, tri.v0 + tri.e1, tri.v0 + tri.e2}) {
+                scene_min = helios::make_vec3(std::min(scene_min.x, v.x), std::min(scene_min.y, v.y), std::min(scene_min.z, v.z));
+                scene_max = helios::make_vec3(std::max(scene_max.x, v.x), std::max(scene_max.y, v.y), std::max(scene_max.z, v.z));
+            }
+        }
+    }
+
+    void CPURadiationModel::resetSceneCaches() {
+        // Cached responses, the exchange operator and sunlit fractions belong to the previous scene
+        responses.clear();
+        view_factor_ready = false;
+        view_factors = ViewFactorOperator();
+        sunlit = SunlitFractionCache();
+    }
+
+    void CPURadiationModel::requireGeometry() const {
+        if (!geometry_ready) {
+            throw std::runtime_error("Geometry has not been added to the radiation model. Call updateGeometry() before runBand().");
+        }
+    }
+
+    helios::vec3 CPURadiationModel::samplePoint(const ScenePrimitive& primitive, RandomStream& rng) const {
+        uint32_t k = 0;
+        if (primitive.triangle_count > 1) {
+            float u = rng.uniform();
+            while (k + 1 < primitive.triangle_count && triangle_cdf[primitive.first_triangle + k] < u) {
+                ++k;
+            }
+        }
+        const BVHTriangle& tri = bvh->triangles[scene_triangles[primitive.first_triangle + k]];
+        float su = std::sqrt(rng.uniform());
+        float v = rng.uniform();
+        return tri.v0 + tri.e1 * (su * (1.f - v)) + tri.e2 * (su * v);
+    }
+
+    std::vector<CPURadiationModel::ScenePrimitiveOptics> CPURadiationModel::readOptics(const BandGroup& group) {
+        const size_t K = group.size();
+        const std::string weight_label = bandWeightSpectrum();
+        validateSpectralTables();
+
+        // Context data access is not thread-safe, so properties are gathered up front
+        std::vector<ScenePrimitiveOptics> optics(primitives.size() * K);
+        for (size_t k = 0; k < K; ++k) {
+            const BandChannel& channel = group.channels[k];
+            const bool shared = k > 0 && group.channels[k - 1].label == channel.label;  // components of one band are adjacent
+            const bool emitting = channel.band->emission && (channel.kind == ChannelKind::BAND || channel.kind == ChannelKind::EMISSION);
+            const std::string reflectivity_label = "reflectivity_" + channel.label;
+            const std::string transmissivity_label = "transmissivity_" + channel.label;
+            const std::string emissivity_label = "emissivity_" + channel.label;
+
+            // Band averages of the spectra used in this band, integrated once per spectrum from the cache
+            const bool spectral = channel.band->wavelength_max > 0.f;
+            std::map<std::string, float> band_averages;
+            auto spectralProperty = [&](uint uuid, const std::string& band_data, const char* spectrum_data, float default_value) {
+                if (!spectral || context->doesPrimitiveDataExist(uuid, band_data.c_str()) || !context->doesPrimitiveDataExist(uuid, spectrum_data)) {
+                    return getPrimitiveFloat(context, uuid, band_data, default_value);
+                }
+                std::string spectrum_label;
+                context->getPrimitiveData(uuid, spectrum_data, spectrum_label);
+                auto it = band_averages.find(spectrum_label);
+                if (it == band_averages.end()) {
+                    float value = averageSpectrum(spectrum_label, weight_label, channel.band->wavelength_min, channel.band->wavelength_max);
+                    it = band_averages.emplace(spectrum_label, value).first;
+                }
+                return it->second;
+            };
+
+            for (size_t i = 0; i < primitives.size(); ++i) {
+                uint uuid = primitives[i].uuid;
+                ScenePrimitiveOptics& o = optics[i * K + k];
+                if (shared) {
+                    o = optics[i * K + k - 1];
+                } else {
+                    o.reflectivity = spectralProperty(uuid, reflectivity_label, "reflectivity_spectrum", 0.f);
+                    o.transmissivity = spectralProperty(uuid, transmissivity_label, "transmissivity_spectrum", 0.f);
+                    o.absorptivity = std::max(0.f, 1.f - o.reflectivity - o.transmissivity);
+                }
+                o.emitted = 0.f;
+                if (emitting) {
+                    float emissivity = getPrimitiveFloat(context, uuid, emissivity_label, 1.f);
+                    float temperature = getPrimitiveFloat(context, uuid, "temperature", 300.f);
+                    o.emitted = emissivity * STEFAN_BOLTZMANN * temperature * temperature * temperature * temperature;
+                }
+            }
+        }
+        return optics;
+    }
+
+    void CPURadiationModel::traceDirect(const BandGroup& group, uint64_t seed, std::vector<double>& incident) const {
+        const size_t K = group.size();
+        std::vector<size_t> active;
+        std::vector<float> source_flux(sources.size() * K, 0.f);
+        for (size_t s = 0; s < sources.size(); ++s) {
+            bool any = false;
+            for (size_t k = 0; k < K; ++k) {
+                const BandChannel& channel = group.channels[k];
+                float flux = 0.f;
+                if (channel.kind == ChannelKind::BAND) {
+                    auto it = sources[s].fluxes.find(channel.label);
+                    flux = it != sources[s].fluxes.end() ? it->second * sources[s].flux_scaling : 0.f;
+                } else if (channel.kind == ChannelKind::UNIT_SOURCE && channel.source == s) {
+                    flux = sources[s].flux_scaling;
+                }
+                if (flux > 0.f) {
+                    source_flux[s * K + k] = flux;
+                    any = true;
+                }
+            }
+            if (any) {
+                active.push_back(s);
+            }
+        }
+        const size_t ray_count = group.channels.front().band->direct_ray_count;
+        if (active.empty() || ray_count == 0) {
+            return;
+        }
+
+        // Collimated sources near a cached sun direction are served from the sunlit fraction cache
+        const size_t D = sunlit.directions.size();
+        std::vector<uint8_t> cached(sources.size(), 0);
+        std::vector<uint32_t> cached_index(2 * sources.size());
+        std::vector<float> cached_weight(2 * sources.size());
+        for (size_t s : active) {
+            if (sources[s].type == CPURadiationSourceType::COLLIMATED) {
+                cached[s] = lookupSunlitFraction(sources[s].direction, &cached_index[2 * s], &cached_weight[2 * s]) ? 1 : 0;
+            }
+        }
+
+        parallelFor(*workerPool(), primitives.size(), workerCount(primitives.size()), [&](size_t begin, size_t end, unsigned int) {
+            std::vector<double> top(K), bottom(K);
+            for (size_t i = begin; i < end; ++i) {
+                const ScenePrimitive& primitive = primitives[i];
+                for (size_t s : active) {
+                    const CPURadiationSource& source = sources[s];
+                    const float* flux = &source_flux[s * K];
+                    if (cached[s]) {
+                        const uint8_t* fractions = &sunlit.fractions[i * D];
+                        float fraction = (cached_weight[2 * s] * fractions[cached_index[2 * s]] + cached_weight[2 * s + 1] * fractions[cached_index[2 * s + 1]]) / 255.f;
+                        float cos_incidence = primitive.normal * source.direction;
+                        size_t face = cos_incidence > 0.f ? 2 * i : 2 * i + 1;
+                        for (size_t k = 0; k < K; ++k) {
+                            incident[face * K + k] += double(flux[k]) * fraction * std::fabs(cos_incidence);
+                        }
+                        continue;
+                    }
+                    RandomStream rng(seed, streamKey(PHASE_DIRECT, i, s));
+                    std::fill(top.begin(), top.end(), 0.0);
+                    std::fill(bottom.begin(), bottom.end(), 0.0);
+                    for (size_t r = 0; r < ray_count; ++r) {
+                        helios::vec3 origin = samplePoint(primitive, rng);
+                        helios::vec3 dir;
+                        float tmax = NO_HIT_DISTANCE;
+                        float attenuation = 1.f;
+                        if (source.type == CPURadiationSourceType::SPHERE) {
+                            helios::vec3 to_center = source.position - origin;
+                            float d2 = to_center * to_center;
+                            if (d2 <= source.radius * source.radius) {
+                                continue;
+                            }
+                            helios::vec3 to_target = to_center + sampleSphere(rng) * source.radius;
+                            tmax = std::sqrt(to_target * to_target);
+                            dir = to_target / tmax;
+                            attenuation = source.radius * source.radius / d2;
+                        } else {
+                            dir = sampleCone(source.direction, source.half_angle, rng);
+                        }
+                        float cos_incidence = primitive.normal * dir;
+                        if (cos_incidence == 0.f || occludedRay(origin, dir, tmax, primitive.index)) {
+                            continue;
+                        }
+                        std::vector<double>& face = cos_incidence > 0.f ? top : bottom;
+                        for (size_t k = 0; k < K; ++k) {
+                            face[k] += flux[k] * attenuation * std::fabs(cos_incidence);
+                        }
+                    }
+                    for (size_t k = 0; k < K; ++k) {
+                        incident[2 * i * K + k] += top[k] / double(ray_count);
+                        incident[(2 * i + 1) * K + k] += bottom[k] / double(ray_count);
+                    }
+                }
+            }
+        });
+    }
+
+    bool CPURadiationModel::usesViewFactors(const BandGroup& group) const {
+        // Adaptive rounds must draw independent diffuse samples, or their error estimate would miss the
+        // operator's sampling noise and truncation
+        return view_factor_ready && group.channels.front().band->target_error <= 0.f;
+    }
+
+    void CPURadiationModel::traceSkyDiffuse(const BandGroup& group, uint64_t seed, std::vector<double>& incident) const {
+        const size_t K = group.size();
+        const size_t ray_count = group.channels.front().band->diffuse_ray_count;
+        std::vector<float> sky_flux(K, 0.f);
+        bool any = false;
+        for (size_t k = 0; k < K; ++k) {
+            const BandChannel& channel = group.channels[k];
+            sky_flux[k] = channel.kind == ChannelKind::BAND ? channel.band->diffuse_flux : (channel.kind == ChannelKind::UNIT_DIFFUSE ? 1.f : 0.f);
+            any = any || sky_flux[k] > 0.f;
+        }
+        if (!any) {
+            return;
+        }
+        if (usesViewFactors(group)) {
+            for (size_t f = 0; f < view_factors.sky.size(); ++f) {
+                for (size_t k = 0; k < K; ++k) {
+                    if (sky_flux[k] > 0.f) {
+                        incident[f * K + k] += double(sky_flux[k]) * double(view_factors.sky[f]);
+                    }
+                }
+            }
+            return;
+        }
+        if (ray_count == 0) {
+            return;
+        }
+        parallelFor(*workerPool(), primitives.size(), workerCount(primitives.size()), [&](size_t begin, size_t end, unsigned int) {
+            for (size_t i = begin; i < end; ++i) {
+                const ScenePrimitive& primitive = primitives[i];
+                for (int face = 0; face < 2; ++face) {
+                    helios::vec3 n = face == 0 ? primitive.normal : primitive.normal * -1.f;
+                    helios::vec3 t, b;
+                    makeBasis(n, t, b);
+                    RandomStream rng(seed, streamKey(PHASE_DIFFUSE, i, face));
+                    size_t sky = 0;
+                    for (size_t r = 0; r < ray_count; ++r) {
+                        helios::vec3 origin = samplePoint(primitive, rng);
+                        helios::vec3 dir = sampleCosineHemisphere(n, t, b, rng);
+                        // Isotropic sky over the upper hemisphere: the cosine-weighted fraction of rays escaping upward
+                        if (dir.z > 0.f && !occludedRay(origin, dir, NO_HIT_DISTANCE, primitive.index)) {
+                            ++sky;
+                        }
+                    }
+                    for (size_t k = 0; k < K; ++k) {
+                        if (sky_flux[k] > 0.f) {
+                            incident[(2 * i + face) * K + k] += double(sky_flux[k]) * double(sky) / double(ray_count);
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+    void CPURadiationModel::distribute(const BandGroup& group, const std::vector<double>& outgoing, std::vector<double>& incident, uint64_t pass, uint64_t seed) const {
+        const size_t K = group.size();
+        const size_t face_count = 2 * primitives.size();
+        std::fill(incident.begin(), incident.end(), 0.0);
+        if (usesViewFactors(group)) {
+            applyViewFactorOperator(group, outgoing, incident);
+            return;
+        }
+        const size_t ray_count = group.channels.front().band->diffuse_ray_count;
+        if (ray_count == 0) {
+            return;
+        }
+
+        // The scattering cutoff is not linear in flux, so cached unit responses are traced without it
+        std::vector<double> threshold(K, 0.0);
+        for (size_t k = 0; k < K; ++k) {
+            if (group.channels[k].kind == ChannelKind::BAND) {
+                threshold[k] = std::max(0.f, group.channels[k].band->min_scatter_energy);
+            }
+        }
+        const unsigned int workers = workerCount(primitives.size());
+        std::vector<std::vector<double>> received(workers, std::vector<double>(face_count * K, 0.0));
+
+        parallelFor(*workerPool(), primitives.size(), workers, [&](size_t begin, size_t end, unsigned int w) {
+            std::vector<double>& power = received[w];
+            std::vector<double> ray_power(K);
+            for (size_t i = begin; i < end; ++i) {
+                const ScenePrimitive& primitive = primitives[i];
+                for (int face = 0; face < 2; ++face) {
+                    // A face is traced if any band still has energy to send; bands below their threshold carry zero
+                    bool any = false;
+                    for (size_t k = 0; k < K; ++k) {
+                        double exitance = outgoing[(2 * i + face) * K + k];
+                        bool live = exitance > 0.0 && exitance >= threshold[k];
+                        ray_power[k] = live ? exitance * primitive.area / double(ray_count) : 0.0;
+                        any = any || live;
+                    }
+                    if (!any) {
+                        continue;
+                    }
+                    helios::vec3 n = face == 0 ? primitive.normal : primitive.normal * -1.f;
+                    helios::vec3 t, b;
+                    makeBasis(n, t, b);
+                    RandomStream rng(seed, streamKey(PHASE_SCATTER, i, 2 * pass + face));
+                    for (size_t r = 0; r < ray_count; ++r) {
+                        helios::vec3 origin = samplePoint(primitive, rng);
+                        helios::vec3 dir = sampleCosineHemisphere(n, t, b, rng);
+                        float t_hit;
+                        uint32_t triangle;
+                        if (!traceRay(origin, dir, NO_HIT_DISTANCE, t_hit, triangle, primitive.index)) {
+                            continue;
+                        }
+                        uint32_t j = scene_index[bvh->triangle_sources[triangle]];
+                        int hit_face = dir * primitives[j].normal < 0.f ? 0 : 1;
+                        double* hit = &power[(2 * j + hit_face) * K];
+                        for (size_t k = 0; k < K; ++k) {
+                            hit[k] += ray_power[k];
+                        }
+                    }
+                }
+            }
+        });
+
+        for (const std::vector<double>& power : received) {
+            for (size_t f = 0; f < face_count * K; ++f) {
+                incident[f] += power[f];
+            }
+        }
+        for (size_t f = 0; f < face_count * K; ++f) {
+            float area = primitives[f / (2 * K)].area;
+            incident[f] = area > 0.f ? incident[f] / area : 0.0;
+        }
+    }
+
+    void CPURadiationModel::buildViewFactorOperator(size_t ray_count) {
+        auto start = std::chrono::steady_clock::now();
+        const size_t face_count = 2 * primitives.size();
+
+        // Entries the memory cap leaves room for once row offsets and sky views are stored
+        const size_t fixed_bytes = (face_count + 1) * sizeof(uint64_t) + face_count * sizeof(float);
+        const size_t entry_bytes = sizeof(uint32_t) + sizeof(float);
+        if (view_factor_max_bytes > 0 && view_factor_max_bytes <= fixed_bytes) {
+            if (message_flag) {
+                std::cout << "CPU radiation: view factor operator memory cap (" << view_factor_max_bytes << " bytes) is below the " << fixed_bytes << " bytes needed for " << face_count << " faces; tracing diffuse radiation instead" << std::endl;
+            }
+            view_factor_enabled = false;
+            return;
+        }
+        const size_t allowed = view_factor_max_bytes > 0 ? (view_factor_max_bytes - fixed_bytes) / entry_bytes : std::numeric_limits<size_t>::max();
+        const size_t slack = std::max(allowed / 4, face_count);
+        const size_t prune_at = allowed > std::numeric_limits<size_t>::max() - slack ? allowed : allowed + slack;
+
+        // Every entry is a hit count out of ray_count. The cap keeps the `allowed` entries with the highest
+        // counts, ties going to lower emitting faces and then lower receiving faces. That order is tracked
+        // as a running threshold: rows are published without the entries it rejects, and once stored
+        // entries pass prune_at the threshold rises to the last entry that still fits and stored rows are
+        // pruned. An entry outside the top `allowed` of the rows seen so far stays outside it as more rows
+        // arrive, so the result is the same as truncating the complete operator, whatever the thread timing.
+        struct CapThreshold {
+            uint32_t count = 0;     // Entries with more hits are kept
+            uint32_t face = 0;      // Entries with exactly `count` hits are kept from lower emitting faces...
+            uint32_t receiver = 0;  // ...and from this face up to (excluding) this receiving face
+            bool keeps(uint32_t emitter, const std::pair<uint32_t, uint32_t>& entry) const {
+                return entry.second > count || (entry.second == count && (emitter < face || (emitter == face && entry.first < receiver)));
+            }
+        };
+        std::vector<std::vector<std::pair<uint32_t, uint32_t>>> emitted_rows(face_count);
+        std::vector<uint32_t> stored_rows;  // Emitting faces with at least one stored entry
+        std::vector<size_t> count_histogram(ray_count + 1, 0);
+        std::vector<uint32_t> tied_entries;  // Per emitting face, stored entries at the cutoff count (sized on first prune)
+        size_t stored = 0;
+        CapThreshold threshold;
+        std::mutex rows_mutex;
+        auto prune = [&]() {
+            uint32_t count = static_cast<uint32_t>(ray_count);
+            size_t above = 0;
+            while (above + count_histogram[count] <= allowed) {
+                above += count_histogram[count--];
+            }
+            const size_t tied_room = allowed - above;  // Fewer than the entries tied at `count`
+
+            tied_entries.assign(face_count, 0);
+            for (uint32_t f : stored_rows) {
+                for (const auto& entry : emitted_rows[f]) {
+                    tied_entries[f] += entry.second == count ? 1 : 0;
+                }
+            }
+            size_t room = tied_room;
+            uint32_t face = 0;
+            while (room >= tied_entries[face]) {
+                room -= tied_entries[face++];
+            }
+            uint32_t receiver = 0;
+            for (const auto& entry : emitted_rows[face]) {
+                if (entry.second == count && room-- == 0) {
+                    receiver = entry.first;
+                    break;
+                }
+            }
+            threshold = {count, face, receiver};
+
+            std::fill(count_histogram.begin(), count_histogram.begin() + count, 0);
+            count_histogram[count] = tied_room;
+            size_t live = 0;
+            for (uint32_t f : stored_rows) {
+                std::vector<std::pair<uint32_t, uint32_t>>& row = emitted_rows[f];
+                auto end = std::remove_if(row.begin(), row.end(), [&](const std::pair<uint32_t, uint32_t>& entry) { return !threshold.keeps(f, entry); });
+                std::vector<std::pair<uint32_t, uint32_t>>(row.begin(), end).swap(row);  // Release the dropped entries
+                if (!row.empty()) {
+                    stored_rows[live++] = f;
+                }
+            }
+            stored_rows.resize(live);
+            stored = allowed;
+        };
+
+        // Trace each face once and keep, per emitting face, the number of rays reaching every other face
+        std::vector<float> sky(face_count, 0.f);
+        parallelFor(*workerPool(), primitives.size(), workerCount(primitives.size()), [&](size_t begin, size_t end, unsigned int) {
+            std::vector<uint32_t> hits;
+            hits.reserve(ray_count);
+            std::vector<std::pair<uint32_t, uint32_t>> row;
+            for (size_t i = begin; i < end; ++i) {
+                const ScenePrimitive& primitive = primitives[i];
+                for (int face = 0; face < 2; ++face) {
+                    helios::vec3 n = face == 0 ? primitive.normal : primitive.normal * -1.f;
+                    helios::vec3 t, b;
+                    makeBasis(n, t, b);
+                    RandomStream rng(random_seed, streamKey(PHASE_VIEW_FACTOR, i, face));
+                    hits.clear();
+                    size_t sky_rays = 0;
+                    for (size_t r = 0; r < ray_count; ++r) {
+                        helios::vec3 origin = samplePoint(primitive, rng);
+                        helios::vec3 dir = sampleCosineHemisphere(n, t, b, rng);
+                        float t_hit;
+                        uint32_t triangle;
+                        if (!traceRay(origin, dir, NO_HIT_DISTANCE, t_hit, triangle, primitive.index)) {
+                            sky_rays += dir.z > 0.f ? 1 : 0;
+                            continue;
+                        }
+                        uint32_t j = scene_index[bvh->triangle_sources[triangle]];
+                        hits.push_back(static_cast<uint32_t>(2 * j + (dir * primitives[j].normal < 0.f ? 0 : 1)));
+                    }
+                    sky[2 * i + face] = float(sky_rays) / float(ray_count);
+
+                    std::sort(hits.begin(), hits.end());
+                    row.clear();
+                    for (size_t h = 0; h < hits.size();) {
+                        size_t run = h;
+                        while (run < hits.size() && hits[run] == hits[h]) {
+                            ++run;
+                        }
+                        if (float(run - h) / float(ray_count) >= view_factor_tolerance) {
+                            row.emplace_back(hits[h], static_cast<uint32_t>(run - h));
+                        }
+                        h = run;
+                    }
+
+                    std::lock_guard<std::mutex> lock(rows_mutex);
+                    std::vector<std::pair<uint32_t, uint32_t>>& published = emitted_rows[2 * i + face];
+                    for (const auto& entry : row) {
+                        if (threshold.keeps(static_cast<uint32_t>(2 * i + face), entry)) {
+                            published.push_back(entry);
+                            count_histogram[entry.second]++;
+                        }
+                    }
+                    if (!published.empty()) {
+                        published.shrink_to_fit();
+                        stored_rows.push_back(static_cast<uint32_t>(2 * i + face));
+                        stored += published.size();
+                        if (stored > prune_at) {
+                            prune();
+                        }
+                    }
+                }
+            }
+        });
+        if (stored > allowed) {
+            prune();
+        }
+        const size_t nonzeros = stored;
+
+        // Transpose to rows per receiving face so passes gather without write conflicts
+        ViewFactorOperator op;
+        op.row_offsets.assign(face_count + 1, 0);
+        for (const auto& row : emitted_rows) {
+            for (const auto& entry : row) {
+                op.row_offsets[entry.first + 1]++;
+            }
+        }
+        for (size_t f = 0; f < face_count; ++f) {
+            op.row_offsets[f + 1] += op.row_offsets[f];
+        }
+        op.columns.resize(nonzeros);
+        op.values.resize(nonzeros);
+        std::vector<uint64_t> fill(op.row_offsets.begin(), op.row_offsets.end() - 1);
+        for (size_t f = 0; f < face_count; ++f) {
+            for (const auto& entry : emitted_rows[f]) {
+                uint64_t e = fill[entry.first]++;
+                op.columns[e] = static_cast<uint32_t>(f);
+                op.values[e] = float(entry.second) / float(ray_count);
+            }
+            std::vector<std::pair<uint32_t, uint32_t>>().swap(emitted_rows[f]);
+        }
+        op.sky = std::move(sky);
+
+        view_factors = std::move(op);
+        view_factor_ready = true;
+
+        if (message_flag) {
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "CPU radiation: built view factor operator with " << nonzeros << " entries (" << view_factors.bytes() / 1048576.0 << " MB) in " << seconds << " s" << std::endl;
+        }
+    }
+
+    void CPURadiationModel::applyViewFactorOperator(const BandGroup& group, const std::vector<double>& outgoing, std::vector<double>& incident) const {
+        const size_t K = group.size();
+        const size_t face_count = 2 * primitives.size();
+
+        // Power leaving each face per channel, zero where the channel is below its scattering cutoff
+        std::vector<double> power(face_count * K, 0.0);
+        for (size_t k = 0; k < K; ++k) {
+            const BandChannel& channel = group.channels[k];
+            const double threshold = channel.kind == ChannelKind::BAND ? std::max(0.f, channel.band->min_scatter_energy) : 0.0;
+            for (size_t f = 0; f < face_count; ++f) {
+                double exitance = outgoing[f * K + k];
+                if (exitance > 0.0 && exitance >= threshold) {
+                    power[f * K + k] = exitance * primitives[f / 2].area;
+                }
+            }
+        }
+
+        parallelFor(*workerPool(), primitives.size(), workerCount(primitives.size()), [&](size_t begin, size_t end, unsigned int) {
+            for (size_t g = 2 * begin; g < 2 * end; ++g) {
+                double* received = &incident[g * K];
+                for (uint64_t e = view_factors.row_offsets[g]; e < view_factors.row_offsets[g + 1]; ++e) {
+                    const double* sent = &power[size_t(view_factors.columns[e]) * K];
+                    const double fraction = view_factors.values[e];
+                    for (size_t k = 0; k < K; ++k) {
+                        received[k] += sent[k] * fraction;
+                    }
+                }
+                float area = primitives[g / 2].area;
+                for (size_t k = 0; k < K; ++k) {
+                    received[k] = area > 0.f ? received[k] / area : 0.0;
+                }
+            }
+        });
+    }
+
+    CPURadiationModel::TraceResult CPURadiationModel::traceGroup(const BandGroup& group, const std::vector<ScenePrimitiveOptics>& optics, uint64_t seed, TraceConvergence& convergence) const {
+        const size_t K = group.size();
+        const size_t face_count = 2 * primitives.size();
+
+        // Faces are interleaved: 2*i is the top (normal side) of primitive i, 2*i+1 the bottom;
+        // each face holds one energy per band of the group
+        std::vector<double> incident(face_count * K, 0.0);
+        uint passes = 0;
+        for (size_t k = 0; k < K; ++k) {
+            passes = std::max(passes, std::max<uint>(group.channels[k].band->scattering_depth, group.channels[k].band->emission ? 1u : 0u));
+        }
+        const size_t stages = 2 + passes;
+        traceDirect(group, seed, incident);
+        reportProgress(1, stages);
+        traceSkyDiffuse(group, seed, incident);
+        reportProgress(2, stages);
+
+        std::vector<double> absorbed(face_count * K, 0.0);
+        std::vector<double> outgoing(face_count * K, 0.0);
+        std::vector<double> exitance(face_count * K, 0.0);  // everything leaving a face, traced further or not
+        std::vector<uint8_t> done(K, 0);
+        std::vector<double> scattered(K);  // power reflected or transmitted by the last absorbAndScatter, kept or not
+        auto absorbAndScatter = [&](uint pass) {
+            std::fill(scattered.begin(), scattered.end(), 0.0);
+            for (size_t i = 0; i < primitives.size(); ++i) {
+                for (size_t k = 0; k < K; ++k) {
+                    const ScenePrimitiveOptics& o = optics[i * K + k];
+                    const bool scatter = !done[k] && pass < group.channels[k].band->scattering_depth;
+                    const size_t t = 2 * i * K + k, b = (2 * i + 1) * K + k;
+                    double top = incident[t], bottom = incident[b];
+                    absorbed[t] += o.absorptivity * top;
+                    absorbed[b] += o.absorptivity * bottom;
+                    // Reflection leaves the face it arrived on; transmission leaves the opposite face
+                    double out_top = o.reflectivity * top + o.transmissivity * bottom;
+                    double out_bottom = o.reflectivity * bottom + o.transmissivity * top;
+                    scattered[k] += (out_top + out_bottom) * primitives[i].area;
+                    exitance[t] += out_top;
+                    exitance[b] += out_bottom;
+                    outgoing[t] = scatter ? out_top : 0.0;
+                    outgoing[b] = scatter ? out_bottom : 0.0;
+                }
+            }
+        };
+
+        // Energy injected by sources, sky and emission, the reference for the scattering residual
+        std::vector<double> injected(K, 0.0);
+        for (size_t f = 0; f < face_count; ++f) {
+            for (size_t k = 0; k < K; ++k) {
+                injected[k] += incident[f * K + k] * primitives[f / 2].area;
+            }
+        }
+
+        absorbAndScatter(0);
+        std::vector<uint8_t> emitting(K, 0);
+        for (size_t i = 0; i < primitives.size(); ++i) {
+            for (size_t k = 0; k < K; ++k) {
+                float emitted = optics[i * K + k].emitted;
+                if (emitted > 0.f) {
+                    outgoing[2 * i * K + k] += emitted;
+                    outgoing[(2 * i + 1) * K + k] += emitted;
+                    exitance[2 * i * K + k] += emitted;
+                    exitance[(2 * i + 1) * K + k] += emitted;
+                    injected[k] += 2.0 * emitted * primitives[i].area;
+                    emitting[k] = 1;
+                }
+            }
+        }
+
+        // Pass 1 carries emission and first-order scattering; further passes carry higher scattering orders.
+        // A band whose own passes are done has zero outgoing energy and rides along without contributing.
+        passes = 0;
+        for (size_t k = 0; k < K; ++k) {
+            passes = std::max(passes, std::max<uint>(group.channels[k].band->scattering_depth, emitting[k] ? 1u : 0u));
+        }
+        convergence.passes.assign(K, 0);
+        convergence.residual.assign(K, 0.0);
+        convergence.injected = injected;
+        for (size_t k = 0; k < K; ++k) {
+            convergence.residual[k] = group.channels[k].band->scattering_depth == 0 ? scattered[k] : 0.0;
+        }
+        for (uint pass = 1; pass <= passes; ++pass) {
+            bool any = false;
+            for (size_t k = 0; k < K; ++k) {
+                if (!done[k] && pass <= std::max<uint>(group.channels[k].band->scattering_depth, emitting[k] ? 1u : 0u)) {
+                    convergence.passes[k]++;
+                    any = true;
+                }
+            }
+            if (!any) {
+                break;
+            }
+            distribute(group, outgoing, incident, pass, seed);
+            absorbAndScatter(pass);
+            reportProgress(2 + pass, stages);
+
+            // Stop scattering a band once the energy still to be scattered is a small fraction of what was injected
+            for (size_t k = 0; k < K; ++k) {
+                if (done[k] || convergence.passes[k] < pass) {
+                    continue;
+                }
+                convergence.residual[k] = scattered[k];
+                const float tolerance = group.channels[k].band->scattering_tolerance;
+                if (tolerance > 0.f && scattered[k] <= tolerance * injected[k]) {
+                    done[k] = 1;
+                    for (size_t f = 0; f < face_count; ++f) {
+                        outgoing[f * K + k] = 0.0;
+                    }
+                }
+            }
+        }
+
+        reportProgress(stages, stages);
+
+        TraceResult result;
+        result.flux.assign(K, std::vector<double>(primitives.size()));
+        for (size_t k = 0; k < K; ++k) {
+            for (size_t i = 0; i < primitives.size(); ++i) {
+                result.flux[k][i] = absorbed[2 * i * K + k] + absorbed[(2 * i + 1) * K + k];
+            }
+        }
+        result.exitance = std::move(exitance);
+        return result;
+    }
+
+    void CPURadiationModel::runBandGroup(const BandGroup& group, const std::vector<ScenePrimitiveOptics>& optics) {
+        auto start = std::chrono::steady_clock::now();
+        const size_t K = group.size();
+        const size_t N = primitives.size();
+        const CPURadiationBand& settings = *group.channels.front().band;
+        if (view_factor_enabled && !view_factor_ready && settings.diffuse_ray_count > 0 && settings.target_error <= 0.f) {
+            buildViewFactorOperator(settings.diffuse_ray_count);
+        }
+
+        std::vector<std::string> labels;
+        std::vector<size_t> channel_band(K);
+        for (size_t k = 0; k < K; ++k) {
+            if (labels.empty() || labels.back() != group.channels[k].label) {
+                labels.push_back(group.channels[k].label);
+            }
+            channel_band[k] = labels.size() - 1;
+        }
+
+        // Weight of each channel in its band's absorbed flux (components of a band sum linearly)
+        std::vector<double> weight(K, 1.0);
+        for (size_t k = 0; k < K; ++k) {
+            const BandChannel& channel = group.channels[k];
+            if (channel.kind == ChannelKind::UNIT_SOURCE) {
+                auto it = sources[channel.source].fluxes.find(channel.label);
+                weight[k] = it != sources[channel.source].fluxes.end() ? it->second : 0.0;
+            } else if (channel.kind == ChannelKind::UNIT_DIFFUSE) {
+                weight[k] = channel.band->diffuse_flux;
+            }
+        }
+
+        // Adaptive bands trace in rounds with independent samples until the area-weighted relative
+        // standard error of the round mean meets the target or the ray budget is spent
+        const bool adaptive = settings.target_error > 0.f;
+        const size_t rays_per_round = std::max<size_t>(1, std::max(settings.direct_ray_count, settings.diffuse_ray_count));
+        const size_t max_rounds = adaptive ? std::max<size_t>(1, settings.max_ray_count / rays_per_round) : 1;
+
+        std::vector<std::vector<double>> sum(K, std::vector<double>(N, 0.0));
+        std::vector<double> exitance_sum(2 * N * K, 0.0);
+        std::vector<std::vector<double>> band_mean(labels.size(), std::vector<double>(N, 0.0));
+        std::vector<std::vector<double>> band_m2(labels.size(), std::vector<double>(N, 0.0));
+        std::vector<float> band_error(labels.size(), -1.f);
+        std::vector<double> estimate(N);
+        size_t rounds = 0;
+        TraceConvergence convergence;
+        const double group_begin = progress_begin, group_end = progress_end;
+        while (rounds < max_rounds) {
+            const uint64_t seed = rounds == 0 ? random_seed : RandomStream(random_seed, rounds).next();
+            progress_begin = group_begin + (group_end - group_begin) * double(rounds) / double(max_rounds);
+            progress_end = group_begin + (group_end - group_begin) * double(rounds + 1) / double(max_rounds);
+            TraceResult trace = traceGroup(group, optics, seed, convergence);
+            const std::vector<std::vector<double>>& flux = trace.flux;
+            ++rounds;
+            for (size_t k = 0; k < K; ++k) {
+                for (size_t i = 0; i < N; ++i) {
+                    sum[k][i] += flux[k][i];
+                }
+            }
+            for (size_t f = 0; f < exitance_sum.size(); ++f) {
+                exitance_sum[f] += trace.exitance[f];
+            }
+            if (!adaptive) {
+                break;
+            }
+
+            bool converged = true;
+            for (size_t b = 0; b < labels.size(); ++b) {
+                std::fill(estimate.begin(), estimate.end(), 0.0);
+                for (size_t k = 0; k < K; ++k) {
+                    if (channel_band[k] == b) {
+                        for (size_t i = 0; i < N; ++i) {
+                            estimate[i] += weight[k] * flux[k][i];
+                        }
+                    }
+                }
+                // Welford update of the per-primitive mean and variance across rounds
+                double weighted_error = 0.0, weighted_flux = 0.0;
+                for (size_t i = 0; i < N; ++i) {
+                    double delta = estimate[i] - band_mean[b][i];
+                    band_mean[b][i] += delta / double(rounds);
+                    band_m2[b][i] += delta * (estimate[i] - band_mean[b][i]);
+                    if (rounds > 1) {
+                        double standard_error = std::sqrt(band_m2[b][i] / double(rounds - 1) / double(rounds));
+                        weighted_error += primitives[i].area * standard_error;
+                        weighted_flux += primitives[i].area * std::fabs(band_mean[b][i]);
+                    }
+                }
+                if (rounds > 1) {
+                    band_error[b] = weighted_flux > 0.0 ? static_cast<float>(weighted_error / weighted_flux) : 0.f;
+                }
+                converged = converged && band_error[b] >= 0.f && band_error[b] <= settings.target_error;
+            }
+            if (converged) {
+                break;
+            }
+        }
+
+        std::vector<uint> uuids(N);
+        for (size_t i = 0; i < N; ++i) {
+            uuids[i] = primitives[i].uuid;
+        }
+        for (size_t k = 0; k < K; ++k) {
+            const BandChannel& channel = group.channels[k];
+            std::vector<float> flux(N);
+            for (size_t i = 0; i < N; ++i) {
+                flux[i] = static_cast<float>(sum[k][i] / double(rounds));
+            }
+            std::vector<float> exitance(2 * N);
+            for (size_t f = 0; f < 2 * N; ++f) {
+                exitance[f] = static_cast<float>(exitance_sum[f * K + k] / double(rounds));
+            }
+
+            if (channel.kind == ChannelKind::BAND) {
+                BandResult& result = results[channel.label];
+                result.uuids = uuids;
+                result.flux = std::move(flux);
+                result.exitance = std::move(exitance);
+                storeResultGeometry(result);
+                continue;
+            }
+
+            BandResponse& response = responses[channel.label];
+            response.uuids = uuids;
+            response.sources.resize(sources.size());
+            ResponseComponent& component = channel.kind == ChannelKind::UNIT_SOURCE ? response.sources[channel.source] :
+                                           (channel.kind == ChannelKind::UNIT_DIFFUSE ? response.diffuse : response.emission);
+            component.flux = std::move(flux);
+            component.exitance = std::move(exitance);
+        }
+        for (size_t b = 0; b < labels.size(); ++b) {
+            if (responses.count(labels[b])) {
+                applyResponse(labels[b]);
+            }
+            CPURadiationBandStats& stats = band_stats[labels[b]];
+            stats.rounds = rounds;
+            stats.direct_rays = rounds * settings.direct_ray_count;
+            stats.diffuse_rays = rounds * settings.diffuse_ray_count;
+            stats.relative_error = band_error[b];
+
+            // Scattering convergence of the last round, combining the band's components with their weights
+            double residual = 0.0, injected = 0.0;
+            stats.scattering_passes = 0;
+            for (size_t k = 0; k < K; ++k) {
+                if (channel_band[k] == b) {
+                    residual += std::fabs(weight[k]) * convergence.residual[k];
+                    injected += std::fabs(weight[k]) * convergence.injected[k];
+                    stats.scattering_passes = std::max(stats.scattering_passes, convergence.passes[k]);
+                }
+            }
+            stats.scattering_residual = injected > 0.0 ? static_cast<float>(residual / injected) : 0.f;
+        }
+
+        if (message_flag) {
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            std::string names;
+            for (const std::string& label : labels) {
+                names += (names.empty() ? "" : ", ") + label;
+            }
+            uint passes = 0;
+            for (uint p : convergence.passes) {
+                passes = std::max(passes, p);
+            }
+            std::cout << "CPU radiation band" << (labels.size() > 1 ? "s " : " ") << names << ": " << N << " primitives, " << passes << " scattering/emission passes";
+            if (adaptive) {
+                std::cout << ", " << rounds << " rounds";
+            }
+            std::cout << ", " << seconds << " s" << std::endl;
+        }
+    }
+
+    void CPURadiationModel::runBands(const std::vector<std::string>& labels) {
+        std::unique_ptr<PreparedRun> run = prepareRun(labels);
+        try {
+            traceRun(*run);
+        } catch (...) {
+            writeRunFluxData(*run);
+            throw;
+        }
+        writeRunFluxData(*run);
+    }
+
+    std::unique_ptr<CPURadiationModel::PreparedRun> CPURadiationModel::prepareRun(const std::vector<std::string>& labels) {
+        requireGeometry();
+        for (const std::string& label : labels) {
+            getBand(label);
+        }
+
+        // Bands that draw the same rays (and stop adaptive tracing on the same terms) share one traversal
+        std::unique_ptr<PreparedRun> run(new PreparedRun());
+        std::vector<BandGroup>& groups = run->groups;
+        for (size_t l = 0; l < labels.size(); ++l) {
+            const std::string& label = labels[l];
+            if (std::find(labels.begin(), labels.begin() + l, label) != labels.begin() + l) {
+                continue;  // repeated label
+            }
+            const CPURadiationBand& band = getBand(label);
+            BandGroup* target = nullptr;
+            for (BandGroup& group : groups) {
+                const CPURadiationBand& first = *group.channels.front().band;
+                if (first.direct_ray_count == band.direct_ray_count && first.diffuse_ray_count == band.diffuse_ray_count &&
+                    first.target_error == band.target_error && first.max_ray_count == band.max_ray_count) {
+                    target = &group;
+                    break;
+                }
+            }
+            if (!target) {
+                groups.emplace_back();
+                target = &groups.back();
+            }
+
+            stale_bands.erase(label);
+            responses.erase(label);
+            if (flux_superposition) {
+                for (uint s = 0; s < sources.size(); ++s) {
+                    target->channels.push_back({label, &band, ChannelKind::UNIT_SOURCE, s});
+                }
+                target->channels.push_back({label, &band, ChannelKind::UNIT_DIFFUSE, 0});
+                target->channels.push_back({label, &band, ChannelKind::EMISSION, 0});
+            } else {
+                target->channels.push_back({label, &band, ChannelKind::BAND, 0});
+            }
+        }
+        // Responses of the other bands are brought up to date now, so tracing never writes to the Context
+        refreshStaleBands();
+        for (const BandGroup& group : groups) {
+            run->optics.push_back(readOptics(group));
+        }
+
+        // Tiled-only cameras are streamed by renderCameraTiles and never rendered into memory here
+        std::vector<std::string>& observing = run->observing;
+        for (const auto& entry : cameras) {
+            if (entry.second.tiled_only) {
+                continue;
+            }
+            for (const std::string& band_label : entry.second.band_labels) {
+                if (std::find(labels.begin(), labels.end(), band_label) != labels.end()) {
+                    observing.push_back(entry.first);
+                    break;
+                }
+            }
+        }
+        return run;
+    }
+
+    void CPURadiationModel::traceRun(PreparedRun& run) {
+        const std::vector<BandGroup>& groups = run.groups;
+        for (size_t g = 0; g < groups.size(); ++g) {
+            // Cameras are rendered in the last share of a monitored run
+            const double share = run.observing.empty() ? 1.0 : 0.95;
+            progress_begin = share * double(g) / double(groups.size());
+            progress_end = share * double(g + 1) / double(groups.size());
+            reportProgress(0, 1);
+            runBandGroup(groups[g], run.optics[g]);
+            for (const BandChannel& channel : groups[g].channels) {
+                if (run.traced.empty() || run.traced.back() != channel.label) {
+                    run.traced.push_back(channel.label);
+                }
+            }
+        }
+
+        if (!run.observing.empty()) {
+            renderCameras(run.observing);
+        }
+        if (run_monitor) {
+            run_monitor->progress = 1.f;
+        }
+    }
+
+    void CPURadiationModel::writeRunFluxData(const PreparedRun& run) {
+        for (const std::string& label : run.traced) {
+            writeFluxData(label);
+        }
+    }
+
+    void CPURadiationModel::addCamera(const std::string& label, const CPURadiationCamera& camera) {
+        if (camera.width == 0 || camera.height == 0) {
+            throw std::runtime_error("Camera resolution must be positive");
+        }
+        if (camera.band_labels.empty()) {
+            throw std::runtime_error("Camera must observe at least one band");
+        }
+        for (const std::string& band_label : camera.band_labels) {
+            getBand(band_label);
+        }
+        if (!(camera.HFOV > 0.f && camera.HFOV < 180.f) || !(camera.FOV_aspect_ratio > 0.f)) {
+            throw std::runtime_error("Camera field of view must be between 0 and 180 degrees with a positive aspect ratio");
+        }
+        helios::vec3 view = camera.lookat - camera.position;
+        if (view * view == 0.f) {
+            throw std::runtime_error("Camera position and lookat point coincide");
+        }
+        auto existing = cameras.find(label);
+        const bool tiled_only = camera.tiled_only || (existing != cameras.end() && existing->second.tiled_only);
+        CPURadiationCamera& stored = cameras[label];
+        stored = camera;
+        stored.antialiasing_samples = std::max(1u, camera.antialiasing_samples);
+        stored.tiled_only = tiled_only;  // moving a camera keeps it tiled-only
+        stored.pixels.clear();
+    }
+
+    void CPURadiationModel::setCameraTiledOnly(const std::string& label, bool tiled_only) {
+        getCamera(label);
+        CPURadiationCamera& camera = cameras.at(label);
+        camera.tiled_only = tiled_only;
+        if (tiled_only) {
+            camera.pixels.clear();
+        }
+    }
+
+    bool CPURadiationModel::doesCameraExist(const std::string& label) const {
+        return cameras.find(label) != cameras.end();
+    }
+
+    const CPURadiationCamera& CPURadiationModel::getCamera(const std::string& label) const {
+        auto it = cameras.find(label);
+        if (it == cameras.end()) {
+            throw std::runtime_error("Camera '" + label + "' does not exist");
+        }
+        return it->second;
+    }
+
+    CPURadiationModel::CameraShading CPURadiationModel::prepareCameraShading(const std::vector<std::string>& camera_labels) const {
+        // Bands whose last run matches the current scene; their face exitance is interleaved as
+        // [face * B + band] so a hit reads every band of a camera from one block
+        std::vector<uint> uuids(primitives.size());
+        for (size_t i = 0; i < primitives.size(); ++i) {
+            uuids[i] = primitives[i].uuid;
+        }
+        CameraShading shading;
+        for (const std::string& label : camera_labels) {
+            for (const std::string& band_label : getCamera(label).band_labels) {
+                auto it = results.find(band_label);
+                if (it != results.end() && it->second.uuids == uuids && std::find(shading.bands.begin(), shading.bands.end(), band_label) == shading.bands.end()) {
+                    shading.bands.push_back(band_label);
+                }
+            }
+        }
+        const size_t B = shading.bands.size();
+        shading.face_values.resize(2 * primitives.size() * B);
+        shading.sky.resize(B);
+        for (size_t b = 0; b < B; ++b) {
+            const BandResult& result = results.at(shading.bands[b]);
+            for (size_t f = 0; f < 2 * primitives.size(); ++f) {
+                shading.face_values[f * B + b] = result.exitance[f];
+            }
+            shading.sky[b] = getBand(shading.bands[b]).diffuse_flux;
+        }
+        return shading;
+    }
+
+    CPURadiationModel::CameraView CPURadiationModel::makeCameraView(const std::string& label, const CameraShading& shading) const {
+        const CPURadiationCamera& camera = getCamera(label);
+        CameraView view;
+        view.camera = &camera;
+        for (const std::string& band_label : camera.band_labels) {
+            auto b = std::find(shading.bands.begin(), shading.bands.end(), band_label);
+            if (b != shading.bands.end()) {
+                view.band_labels.push_back(band_label);
+                view.bands.push_back(static_cast<uint32_t>(b - shading.bands.begin()));
+            }
+        }
+        view.forward = normalized(camera.lookat - camera.position);
+        view.right = cross(view.forward, helios::make_vec3(0.f, 0.f, 1.f));
+        if (view.right * view.right < 1e-12f) {
+            view.right = cross(view.forward, helios::make_vec3(0.f, 1.f, 0.f));  // looking straight up or down
+        }
+        view.right = normalized(view.right);
+        view.up = cross(view.right, view.forward);
+        const float hfov = camera.HFOV * float(M_PI) / 180.f;
+        view.tan_x = std::tan(0.5f * hfov);
+        view.tan_y = std::tan(0.5f * hfov / camera.FOV_aspect_ratio);
+        view.seed = random_seed ^ std::hash<std::string>()(label);
+        return view;
+    }
+
+    // Mean over the pixel's samples of the exitance (or sky) seen by each band of the view
+    void CPURadiationModel::shadeCameraPixel(const CameraView& view, const CameraShading& shading, uint i, uint j, float* value) const {
+        const CPURadiationCamera& camera = *view.camera;
+        const size_t B = shading.bands.size();
+        const uint samples = camera.antialiasing_samples;
+        const bool jitter = samples > 1 || camera.lens_diameter > 0.f;
+        RandomStream rng(view.seed, streamKey(PHASE_CAMERA, size_t(j) * camera.width + i, 0));
+        std::fill(value, value + view.bands.size(), 0.f);
+        for (uint s = 0; s < samples; ++s) {
+            float u = jitter ? rng.uniform() : 0.5f;
+            float w = jitter ? rng.uniform() : 0.5f;
+            float x = (2.f * (float(i) + u) / float(camera.width) - 1.f) * view.tan_x;
+            float y = (1.f - 2.f * (float(j) + w) / float(camera.height)) * view.tan_y;
+            helios::vec3 dir = normalized(view.forward + view.right * x + view.up * y);
+            helios::vec3 origin = camera.position;
+            if (camera.lens_diameter > 0.f) {
+                helios::vec3 focus = camera.position + dir * (camera.focal_plane_distance / (dir * view.forward));
+                float r = 0.5f * camera.lens_diameter * std::sqrt(rng.uniform());
+                float phi = 2.f * float(M_PI) * rng.uniform();
+                origin = camera.position + view.right * (r * std::cos(phi)) + view.up * (r * std::sin(phi));
+                dir = normalized(focus - origin);
+            }
+            float t_hit;
+            uint32_t triangle;
+            if (bvh->intersect(origin, dir, NO_HIT_DISTANCE, t_hit, triangle, primitive_mask.data(), NO_PRIMITIVE)) {
+                uint32_t h = scene_index[bvh->triangle_sources[triangle]];
+                int face = dir * primitives[h].normal < 0.f ? 0 : 1;
+                const float* exitance = &shading.face_values[(2 * size_t(h) + face) * B];
+                for (size_t b = 0; b < view.bands.size(); ++b) {
+                    value[b] += exitance[view.bands[b]];
+                }
+            } else if (dir.z > 0.f) {
+                for (size_t b = 0; b < view.bands.size(); ++b) {
+                    value[b] += shading.sky[view.bands[b]];
+                }
+            }
+        }
+        for (size_t b = 0; b < view.bands.size(); ++b) {
+            value[b] /= float(samples);
+        }
+    }
+
+    void CPURadiationModel::renderCameras(const std::vector<std::string>& labels) {
+        auto start = std::chrono::steady_clock::now();
+        requireGeometry();
+        refreshStaleBands();
+
+        std::vector<std::string> selected = labels;
+        if (selected.empty()) {
+            for (const auto& entry : cameras) {
+                if (!entry.second.tiled_only) {
+                    selected.push_back(entry.first);
+                }
+            }
+        }
+        for (const std::string& label : selected) {
+            if (getCamera(label).tiled_only) {
+                throw std::runtime_error("Camera '" + label + "' is tiled-only; render it with renderCameraTiles");
+            }
+        }
+        std::sort(selected.begin(), selected.end());
+        selected.erase(std::unique(selected.begin(), selected.end()), selected.end());
+
+        const CameraShading shading = prepareCameraShading(selected);
+
+        struct CameraBatchEntry {
+            CameraView view;
+            std::vector<float*> pixels;  //!< Output per band of the view
+            uint tiles_x;
+            size_t first_tile;           //!< Offset of the camera's first tile in the batch
+        };
+        std::vector<CameraBatchEntry> entries;
+        size_t total_pixels = 0, total_tiles = 0;
+        for (const std::string& label : selected) {
+            CPURadiationCamera& camera = cameras.at(label);
+            CameraBatchEntry entry;
+            entry.view = makeCameraView(label, shading);
+            for (const std::string& band_label : camera.band_labels) {
+                if (std::find(entry.view.band_labels.begin(), entry.view.band_labels.end(), band_label) == entry.view.band_labels.end()) {
+                    camera.pixels.erase(band_label);
+                }
+            }
+            if (entry.view.band_labels.empty()) {
+                continue;
+            }
+            for (const std::string& band_label : entry.view.band_labels) {
+                std::vector<float>& pixels = camera.pixels[band_label];
+                pixels.assign(size_t(camera.width) * camera.height, 0.f);
+                entry.pixels.push_back(pixels.data());
+            }
+            entry.tiles_x = (camera.width + CAMERA_TILE_SIZE - 1) / CAMERA_TILE_SIZE;
+            entry.first_tile = total_tiles;
+            total_tiles += size_t(entry.tiles_x) * ((camera.height + CAMERA_TILE_SIZE - 1) / CAMERA_TILE_SIZE);
+            total_pixels += size_t(camera.width) * camera.height;
+            entries.push_back(std::move(entry));
+        }
+        if (entries.empty()) {
+            return;
+        }
+
+        // Tiles of all cameras form one work list, so threads stay busy across camera boundaries
+        parallelFor(*workerPool(), total_tiles, workerCount(total_pixels), [&](size_t begin, size_t end, unsigned int) {
+            std::vector<float> value(shading.bands.size());
+            for (size_t t = begin; t < end; ++t) {
+                size_t e = std::upper_bound(entries.begin(), entries.end(), t, [](size_t tile, const CameraBatchEntry& entry) {
+                    return tile < entry.first_tile;
+                }) - entries.begin() - 1;
+                const CameraBatchEntry& entry = entries[e];
+                const CPURadiationCamera& camera = *entry.view.camera;
+                const uint tile_x = uint((t - entry.first_tile) % entry.tiles_x) * CAMERA_TILE_SIZE;
+                const uint tile_y = uint((t - entry.first_tile) / entry.tiles_x) * CAMERA_TILE_SIZE;
+                for (uint j = tile_y; j < std::min(tile_y + CAMERA_TILE_SIZE, camera.height); ++j) {
+                    for (uint i = tile_x; i < std::min(tile_x + CAMERA_TILE_SIZE, camera.width); ++i) {
+                        shadeCameraPixel(entry.view, shading, i, j, value.data());
+                        for (size_t b = 0; b < entry.pixels.size(); ++b) {
+                            entry.pixels[b][size_t(j) * camera.width + i] = value[b];
+                        }
+                    }
+                }
+            }
+        }, 1);
+
+        if (message_flag) {
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "CPU radiation cameras: " << entries.size() << " camera" << (entries.size() > 1 ? "s, " : ", ") << total_pixels << " pixels, " << seconds << " s" << std::endl;
+        }
+    }
+
+    void CPURadiationModel::renderCameraTiles(const std::string& label, uint tile_width, uint tile_height, const CameraTileWriter& writer) {
+        auto start = std::chrono::steady_clock::now();
+        if (tile_width == 0 || tile_height == 0) {
+            throw std::runtime_error("Tile size must be positive");
+        }
+        if (!writer) {
+            throw std::runtime_error("Tile writer is empty");
+        }
+        const CPURadiationCamera& camera = getCamera(label);
+        requireGeometry();
+        refreshStaleBands();
+
+        const CameraShading shading = prepareCameraShading({label});
+        const CameraView view = makeCameraView(label, shading);
+        if (view.band_labels.empty()) {
+            throw std::runtime_error("No band of camera '" + label + "' has been run since the last geometry update");
+        }
+        const size_t nb = view.bands.size();
+        tile_width = std::min(tile_width, camera.width);
+        tile_height = std::min(tile_height, camera.height);
+        const uint tiles_x = (camera.width + tile_width - 1) / tile_width;
+        const size_t tile_count = size_t(tiles_x) * ((camera.height + tile_height - 1) / tile_height);
+        const size_t tile_pixels = size_t(tile_width) * tile_height;
+
+        // A wave holds two tiles per worker; its buffers are reused for every wave, band-major per tile
+        const unsigned int num_threads = workerCount(size_t(camera.width) * camera.height);
+        const size_t wave_size = std::min(tile_count, size_t(2) * num_threads);
+        std::vector<float> wave(wave_size * nb * tile_pixels);
+
+        for (size_t first = 0; first < tile_count; first += wave_size) {
+            const size_t count = std::min(wave_size, tile_count - first);
+            parallelFor(*workerPool(), count, std::min<size_t>(num_threads, count), [&](size_t begin, size_t end, unsigned int) {
+                std::vector<float> value(nb);
+                for (size_t k = begin; k < end; ++k) {
+                    const size_t t = first + k;
+                    const uint x0 = uint(t % tiles_x) * tile_width;
+                    const uint y0 = uint(t / tiles_x) * tile_height;
+                    const uint w = std::min(tile_width, camera.width - x0);
+                    const uint h = std::min(tile_height, camera.height - y0);
+                    float* tile = &wave[k * nb * tile_pixels];
+                    for (uint j = 0; j < h; ++j) {
+                        for (uint i = 0; i < w; ++i) {
+                            shadeCameraPixel(view, shading, x0 + i, y0 + j, value.data());
+                            for (size_t b = 0; b < nb; ++b) {
+                                tile[b * tile_pixels + size_t(j) * w + i] = value[b];
+                            }
+                        }
+                    }
+                }
+            }, 1);
+            for (size_t k = 0; k < count; ++k) {
+                const size_t t = first + k;
+                const uint x0 = uint(t % tiles_x) * tile_width;
+                const uint y0 = uint(t / tiles_x) * tile_height;
+                const uint w = std::min(tile_width, camera.width - x0);
+                const uint h = std::min(tile_height, camera.height - y0);
+                for (size_t b = 0; b < nb; ++b) {
+                    writer(view.band_labels[b], x0, y0, w, h, &wave[(k * nb + b) * tile_pixels]);
+                }
+            }
+        }
+
+        if (message_flag) {
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "CPU radiation camera '" << label << "': " << tile_count << " tiles of " << tile_width << "x" << tile_height << ", " << seconds << " s" << std::endl;
+        }
+    }
+
+    const std::vector<float>& CPURadiationModel::getCameraPixelData(const std::string& camera, const std::string& band_label) const {
+        const CPURadiationCamera& stored = getCamera(camera);
+        auto it = stored.pixels.find(band_label);
+        if (it == stored.pixels.end()) {
+            throw std::runtime_error("Camera '" + camera + "' has no pixel data for band '" + band_label + "'. Run the band with the camera first.");
+        }
+        return it->second;
+    }
+
+    const CPURadiationBandStats& CPURadiationModel::getBandStats(const std::string& label) const {
+        getBand(label);
+        auto it = band_stats.find(label);
+        if (it == band_stats.end()) {
+            throw std::runtime_error("Radiation band '" + label + "' has not been run");
+        }
+        return it->second;
+    }
+
+    void CPURadiationModel::applyResponse(const std::string& label) {
+        const BandResponse& response = responses.at(label);
+        const CPURadiationBand& band = getBand(label);
+        BandResult& result = results[label];
+        result.uuids = response.uuids;
+        result.flux = response.emission.flux;
+        result.flux.resize(response.uuids.size(), 0.f);
+        result.exitance = response.emission.exitance;
+        result.exitance.resize(2 * response.uuids.size(), 0.f);
+        storeResultGeometry(result);
+        auto addComponent = [&](const ResponseComponent& component, float weight) {
+            if (weight == 0.f || component.flux.empty()) {
+                return;
+            }
+            for (size_t i = 0; i < result.flux.size(); ++i) {
+                result.flux[i] += weight * component.flux[i];
+            }
+            for (size_t f = 0; f < result.exitance.size(); ++f) {
+                result.exitance[f] += weight * component.exitance[f];
+            }
+        };
+        addComponent(response.diffuse, band.diffuse_flux);
+        for (size_t s = 0; s < response.sources.size(); ++s) {
+            auto it = sources[s].fluxes.find(label);
+            if (it != sources[s].fluxes.end()) {
+                addComponent(response.sources[s], it->second);
+            }
+        }
+
+        stale_bands.erase(label);
+    }
+
+    void CPURadiationModel::writeFluxData(const std::string& label) {
+        const BandResult& result = results.at(label);
+        const std::string flux_label = "radiation_flux_" + label;
+        for (size_t i = 0; i < result.uuids.size(); ++i) {
+            // Primitives deleted since the run (e.g. while it traced in the background) are skipped
+            if (context->doesPrimitiveExist(result.uuids[i])) {
+                context->setPrimitiveData(result.uuids[i], flux_label.c_str(), result.flux[i]);
+            }
+        }
+    }
+
+    void CPURadiationModel::reportProgress(size_t stage, size_t stage_count) const {
+        if (!run_monitor) {
+            return;
+        }
+        if (run_monitor->cancel) {
+            throw std::runtime_error("Radiation run was cancelled");
+        }
+        const double fraction = progress_begin + (progress_end - progress_begin) * double(stage) / double(std::max<size_t>(1, stage_count));
+        run_monitor->progress = static_cast<float>(std::min(1.0, fraction));
+    }
+
+    void CPURadiationModel::storeResultGeometry(BandResult& result) const {
+        result.areas.resize(primitives.size());
+        result.objects.resize(primitives.size());
+        for (size_t i = 0; i < primitives.size(); ++i) {
+            result.areas[i] = primitives[i].area;
+            result.objects[i] = primitives[i].parent_object;
+        }
+    }
+
+    void CPURadiationModel::refreshStaleBands() {
+        while (!stale_bands.empty()) {
+            const std::string label = *stale_bands.begin();
+            applyResponse(label);
+            writeFluxData(label);
+        }
+    }
+
+    std::vector<float> CPURadiationModel::getAbsorbedFlux(const std::string& band_label) {
+        getBand(band_label);
+        refreshStaleBands();
+        std::vector<uint> uuids = context->getAllUUIDs();
+        std::vector<float> flux(uuids.size(), 0.f);
+        auto it = results.find(band_label);
+        if (it == results.end()) {
+            return flux;
+        }
+        std::unordered_map<uint, size_t> position;
+        position.reserve(uuids.size());
+        for (size_t i = 0; i < uuids.size(); ++i) {
+            position[uuids[i]] = i;
+        }
+        const BandResult& result = it->second;
+        for (size_t i = 0; i < result.uuids.size(); ++i) {
+            auto p = position.find(result.uuids[i]);
+            if (p != position.end()) {
+                flux[p->second] = result.flux[i];
+            }
+        }
+        return flux;
+    }
+
+    std::vector<float> CPURadiationModel::getTotalAbsorbedFlux() {
+        std::vector<float> total(context->getAllUUIDs().size(), 0.f);
+        for (const auto& entry : results) {
+            std::vector<float> flux = getAbsorbedFlux(entry.first);
+            for (size_t i = 0; i < total.size(); ++i) {
+                total[i] += flux[i];
+            }
+        }
+        return total;
+    }
+
+    void CPURadiationModel::reduceByGroup(const BandResult& result, const std::vector<uint32_t>& result_groups, size_t group_count,
+                                          std::vector<double>& power, std::vector<double>& area) const {
+        power.assign(group_count, 0.0);
+        area.assign(group_count, 0.0);
+        const size_t N = result_groups.size();
+        if (N == 0 || group_count == 0) {
+            return;
+        }
+
+        // Fixed chunks with private partial sums, added in chunk order so results do not depend on the
+        // thread count; fewer chunks when there are many groups to keep the partials within O(N) memory
+        const size_t chunks = std::max<size_t>(1, std::min<size_t>({(N + PRIMITIVES_PER_TASK - 1) / PRIMITIVES_PER_TASK, N / group_count, 64}));
+        const size_t chunk_size = (N + chunks - 1) / chunks;
+        std::vector<double> partial_power(chunks * group_count, 0.0);
+        std::vector<double> partial_area(chunks * group_count, 0.0);
+        parallelFor(*workerPool(), N, workerCount(N), [&](size_t begin, size_t end, unsigned int) {
+            const size_t offset = (begin / chunk_size) * group_count;
+            for (size_t i = begin; i < end; ++i) {
+                uint32_t g = result_groups[i];
+                if (g == NO_PRIMITIVE) {
+                    continue;
+                }
+                partial_power[offset + g] += double(result.flux[i]) * result.areas[i];
+                partial_area[offset + g] += result.areas[i];
+            }
+        }, chunk_size);
+
+        for (size_t c = 0; c < chunks; ++c) {
+            for (size_t g = 0; g < group_count; ++g) {
+                power[g] += partial_power[c * group_count + g];
+                area[g] += partial_area[c * group_count + g];
+            }
+        }
+    }
+
+    void CPURadiationModel::aggregateAbsorbedFlux(const std::string& band_label, const std::vector<uint>& uuids, const std::vector<uint>& groups,
+                                                  size_t group_count, std::vector<double>& power, std::vector<double>& area) {
+        getBand(band_label);
+        if (groups.size() != uuids.size()) {
+            throw std::runtime_error("Expected one group index per primitive, got " + std::to_string(groups.size()) + " for " + std::to_string(uuids.size()) + " primitives");
+        }
+        std::unordered_map<uint, uint32_t> group_of;
+        group_of.reserve(uuids.size());
+        for (size_t i = 0; i < uuids.size(); ++i) {
+            if (groups[i] >= group_count) {
+                throw std::runtime_error("Group index " + std::to_string(groups[i]) + " of primitive " + std::to_string(uuids[i]) + " is out of range (" + std::to_string(group_count) + " groups)");
+            }
+            group_of[uuids[i]] = groups[i];
+        }
+
+        refreshStaleBands();
+        auto it = results.find(band_label);
+        if (it == results.end()) {
+            power.assign(group_count, 0.0);
+            area.assign(group_count, 0.0);
+            return;
+        }
+        const BandResult& result = it->second;
+        std::vector<uint32_t> result_groups(result.uuids.size(), NO_PRIMITIVE);
+        parallelFor(*workerPool(), result.uuids.size(), workerCount(result.uuids.size()), [&](size_t begin, size_t end, unsigned int) {
+            for (size_t i = begin; i < end; ++i) {
+                auto g = group_of.find(result.uuids[i]);
+                if (g != group_of.end()) {
+                    result_groups[i] = g->second;
+                }
+            }
+        });
+        reduceByGroup(result, result_groups, group_count, power, area);
+    }
+
+    void CPURadiationModel::aggregateAbsorbedFluxByObject(const std::string& band_label, std::vector<uint>& object_ids,
+                                                          std::vector<double>& power, std::vector<double>& area) {
+        getBand(band_label);
+        refreshStaleBands();
+        object_ids.clear();
+        auto it = results.find(band_label);
+        if (it == results.end()) {
+            power.clear();
+            area.clear();
+            return;
+        }
+        const BandResult& result = it->second;
+        for (uint object : result.objects) {
+            if (object != 0) {
+                object_ids.push_back(object);
+            }
+        }
+        std::sort(object_ids.begin(), object_ids.end());
+        object_ids.erase(std::unique(object_ids.begin(), object_ids.end()), object_ids.end());
+
+        std::vector<uint32_t> result_groups(result.objects.size(), NO_PRIMITIVE);
+        parallelFor(*workerPool(), result.objects.size(), workerCount(result.objects.size()), [&](size_t begin, size_t end, unsigned int) {
+            for (size_t i = begin; i < end; ++i) {
+                if (result.objects[i] != 0) {
+                    result_groups[i] = static_cast<uint32_t>(std::lower_bound(object_ids.begin(), object_ids.end(), result.objects[i]) - object_ids.begin());
+                }
+            }
+        });
+        reduceByGroup(result, result_groups, object_ids.size(), power, area);
+    }
+
+} // namespace pyhelios
@@ -0,0 +1,505 @@
+// PyHelios shared CPU acceleration structure cache
+// Provides a reference-counted BVH over Context geometry, keyed on a geometry revision,
+// and per-primitive change tracking against per-observer baselines
+
+#include "../include/pyhelios_geometry_cache.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+namespace pyhelios {
+
+    namespace {
+
+        const uint32_t BVH_LEAF_SIZE = 4;
+
+        struct GeometryHashes {
+            uint64_t topology = 0xCBF29CE484222325ULL;
+            uint64_t vertex = 0xCBF29CE484222325ULL;
+        };
+
+        //! Copy of the Context geometry taken in a single pass; only needed when the BVH has to be built or refit
+        struct GeometrySnapshot {
+            std::vector<uint> uuids;
+            std::vector<helios::PrimitiveType> types;
+            std::vector<uint32_t> vertex_offsets;
+            std::vector<helios::vec3> vertices;
+            GeometryHashes hashes;
+        };
+
+        struct CacheEntry {
+            uint64_t revision = 0;
+            uint64_t topology_hash = 0;
+            uint64_t vertex_hash = 0;
+            bool initialized = false;
+            bool invalidated = false;
+            uint64_t bvh_topology_hash = 0;
+            std::shared_ptr<const GeometryBVH> bvh;
+            uint64_t builds = 0;
+            uint64_t refits = 0;
+        };
+
+        //! (UUID, hash of type and vertices), sorted by UUID
+        typedef std::vector<std::pair<uint, uint64_t>> PrimitiveHashes;
+
+        std::mutex cache_mutex;
+        std::unordered_map<const helios::Context*, CacheEntry> cache_entries;
+        std::map<std::pair<const helios::Context*, const void*>, PrimitiveHashes> primitive_baselines;
+
+        // FNV-1a over raw bytes
+        inline void hashBytes(uint64_t& h, const void* data, size_t size) {
+            const unsigned char* p = static_cast<const unsigned char*>(data);
+            for (size_t i = 0; i < size; ++i) {
+                h ^= p[i];
+                h *= 0x100000001B3ULL;
+            }
+        }
+
+        inline void hashPrimitive(GeometryHashes& hashes, uint uuid, helios::PrimitiveType type, const std::vector<helios::vec3>& verts) {
+            int type_code = static_cast<int>(type);
+            hashBytes(hashes.topology, &uuid, sizeof(uuid));
+            hashBytes(hashes.topology, &type_code, sizeof(type_code));
+            for (const helios::vec3& v : verts) {
+                hashBytes(hashes.vertex, &v.x, sizeof(float));
+                hashBytes(hashes.vertex, &v.y, sizeof(float));
+                hashBytes(hashes.vertex, &v.z, sizeof(float));
+            }
+        }
+
+        // Hash the geometry in place, without keeping a copy of the vertices
+        GeometryHashes hashGeometry(helios::Context* context) {
+            GeometryHashes hashes;
+            for (uint uuid : context->getAllUUIDs()) {
+                hashPrimitive(hashes, uuid, context->getPrimitiveType(uuid), context->getPrimitiveVertices(uuid));
+            }
+            return hashes;
+        }
+
+        GeometrySnapshot takeSnapshot(helios::Context* context) {
+            GeometrySnapshot snapshot;
+            snapshot.uuids = context->getAllUUIDs();
+            const std::vector<uint>& uuids = snapshot.uuids;
+            snapshot.types.reserve(uuids.size());
+            snapshot.vertex_offsets.reserve(uuids.size() + 1);
+            snapshot.vertices.reserve(uuids.size() * 4);
+            snapshot.vertex_offsets.push_back(0);
+
+            for (uint uuid : uuids) {
+                helios::PrimitiveType type = context->getPrimitiveType(uuid);
+                std::vector<helios::vec3> verts = context->getPrimitiveVertices(uuid);
+                hashPrimitive(snapshot.hashes, uuid, type, verts);
+                snapshot.types.push_back(type);
+                snapshot.vertices.insert(snapshot.vertices.end(), verts.begin(), verts.end());
+                snapshot.vertex_offsets.push_back(static_cast<uint32_t>(snapshot.vertices.size()));
+            }
+            return snapshot;
+        }
+
+        PrimitiveHashes takePrimitiveHashes(helios::Context* context) {
+            std::vector<uint> uuids = context->getAllUUIDs();
+            PrimitiveHashes hashes;
+            hashes.reserve(uuids.size());
+            for (uint uuid : uuids) {
+                uint64_t h = 0xCBF29CE484222325ULL;
+                int type_code = static_cast<int>(context->getPrimitiveType(uuid));
+                hashBytes(h, &type_code, sizeof(type_code));
+                for (const helios::vec3& v : context->getPrimitiveVertices(uuid)) {
+                    hashBytes(h, &v.x, sizeof(float));
+                    hashBytes(h, &v.y, sizeof(float));
+                    hashBytes(h, &v.z, sizeof(float));
+                }
+                hashes.emplace_back(uuid, h);
+            }
+            std::sort(hashes.begin(), hashes.end());
+            return hashes;
+        }
+
+        // Must be called with cache_mutex held
+        void advanceRevision(CacheEntry& entry, const GeometryHashes& hashes) {
+            if (!entry.initialized || entry.invalidated || entry.topology_hash != hashes.topology || entry.vertex_hash != hashes.vertex) {
+                entry.revision++;
+                entry.topology_hash = hashes.topology;
+                entry.vertex_hash = hashes.vertex;
+                entry.initialized = true;
+                entry.invalidated = false;
+            }
+        }
+
+        inline void expandBounds(helios::vec3& bmin, helios::vec3& bmax, const helios::vec3& v) {
+            bmin = helios::make_vec3(std::min(bmin.x, v.x), std::min(bmin.y, v.y), std::min(bmin.z, v.z));
+            bmax = helios::make_vec3(std::max(bmax.x, v.x), std::max(bmax.y, v.y), std::max(bmax.z, v.z));
+        }
+
+        void computeLeafBounds(const GeometryBVH& bvh, BVHNode& node) {
+            node.bmin = helios::make_vec3(1e30f, 1e30f, 1e30f);
+            node.bmax = helios::make_vec3(-1e30f, -1e30f, -1e30f);
+            for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+                const BVHTriangle& tri = bvh.triangles[i];
+                expandBounds(node.bmin, node.bmax, tri.v0);
+                expandBounds(node.bmin, node.bmax, tri.v0 + tri.e1);
+                expandBounds(node.bmin, node.bmax, tri.v0 + tri.e2);
+            }
+        }
+
+        void setTriangle(GeometryBVH& bvh, size_t index, const GeometrySnapshot& snapshot) {
+            const helios::vec3* v = &snapshot.vertices[snapshot.vertex_offsets[bvh.triangle_sources[index]]];
+            if (bvh.triangle_parts[index] == 0) {
+                bvh.triangles[index] = {v[0], v[1] - v[0], v[2] - v[0]};
+            } else {
+                bvh.triangles[index] = {v[0], v[2] - v[0], v[3] - v[0]};
+            }
+        }
+
+        uint32_t buildNode(GeometryBVH& bvh, std::vector<helios::vec3>& centroids, uint32_t first, uint32_t count) {
+            uint32_t node_index = static_cast<uint32_t>(bvh.nodes.size());
+            bvh.nodes.push_back(BVHNode());
+            bvh.nodes[node_index].first = first;
+            bvh.nodes[node_index].count = count;
+            computeLeafBounds(bvh, bvh.nodes[node_index]);
+
+            helios::vec3 cmin(1e30f, 1e30f, 1e30f), cmax(-1e30f, -1e30f, -1e30f);
+            for (uint32_t i = first; i < first + count; ++i) {
+                expandBounds(cmin, cmax, centroids[i]);
+            }
+            helios::vec3 extent = cmax - cmin;
+            int axis = 0;
+            if (extent.y > extent.x) axis = 1;
+            if (extent.z > (axis == 0 ? extent.x : extent.y)) axis = 2;
+            float axis_extent = axis == 0 ? extent.x : (axis == 1 ? extent.y : extent.z);
+
+            if (count <= BVH_LEAF_SIZE || axis_extent <= 0.f) {
+                return node_index;
+            }
+
+            // Median split on the longest centroid axis; keeps the tree balanced for dense canopies
+            uint32_t mid = first + count / 2;
+            std::vector<uint32_t> order(count);
+            for (uint32_t i = 0; i < count; ++i) {
+                order[i] = first + i;
+            }
+            auto key = [&](uint32_t i) {
+                const helios::vec3& c = centroids[i];
+                return axis == 0 ? c.x : (axis == 1 ? c.y : c.z);
+            };
+            std::nth_element(order.begin(), order.begin() + (mid - first), order.end(), [&](uint32_t a, uint32_t b) { return key(a) < key(b); });
+
+            std::vector<BVHTriangle> tri_tmp(count);
+            std::vector<helios::vec3> cen_tmp(count);
+            std::vector<uint32_t> src_tmp(count);
+            std::vector<uint8_t> part_tmp(count);
+            for (uint32_t i = 0; i < count; ++i) {
+                tri_tmp[i] = bvh.triangles[order[i]];
+                cen_tmp[i] = centroids[order[i]];
+                src_tmp[i] = bvh.triangle_sources[order[i]];
+                part_tmp[i] = bvh.triangle_parts[order[i]];
+            }
+            std::copy(tri_tmp.begin(), tri_tmp.end(), bvh.triangles.begin() + first);
+            std::copy(cen_tmp.begin(), cen_tmp.end(), centroids.begin() + first);
+            std::copy(src_tmp.begin(), src_tmp.end(), bvh.triangle_sources.begin() + first);
+            std::copy(part_tmp.begin(), part_tmp.end(), bvh.triangle_parts.begin() + first);
+
+            bvh.nodes[node_index].count = 0;
+            buildNode(bvh, centroids, first, mid - first);
+            uint32_t right = buildNode(bvh, centroids, mid, first + count - mid);
+            bvh.nodes[node_index].first = right;
+            return node_index;
+        }
+
+        std::shared_ptr<GeometryBVH> buildBVH(const GeometrySnapshot& snapshot) {
+            auto bvh = std::make_shared<GeometryBVH>();
+            bvh->primitive_uuids = snapshot.uuids;
+            for (size_t p = 0; p < snapshot.types.size(); ++p) {
+                if (snapshot.types[p] == helios::PRIMITIVE_TYPE_VOXEL) {
+                    continue;
+                }
+                uint32_t nverts = snapshot.vertex_offsets[p + 1] - snapshot.vertex_offsets[p];
+                if (nverts >= 3) {
+                    bvh->triangle_sources.push_back(static_cast<uint32_t>(p));
+                    bvh->triangle_parts.push_back(0);
+                }
+                if (snapshot.types[p] == helios::PRIMITIVE_TYPE_PATCH && nverts == 4) {
+                    bvh->triangle_sources.push_back(static_cast<uint32_t>(p));
+                    bvh->triangle_parts.push_back(1);
+                }
+            }
+            bvh->triangles.resize(bvh->triangle_sources.size());
+            for (size_t i = 0; i < bvh->triangles.size(); ++i) {
+                setTriangle(*bvh, i, snapshot);
+            }
+            if (bvh->triangles.empty()) {
+                return bvh;
+            }
+
+            std::vector<helios::vec3> centroids(bvh->triangles.size());
+            for (size_t i = 0; i < bvh->triangles.size(); ++i) {
+                const BVHTriangle& tri = bvh->triangles[i];
+                centroids[i] = tri.v0 + (tri.e1 + tri.e2) / 3.f;
+            }
+            bvh->nodes.reserve(2 * bvh->triangles.size() / BVH_LEAF_SIZE + 1);
+            buildNode(*bvh, centroids, 0, static_cast<uint32_t>(bvh->triangles.size()));
+            return bvh;
+        }
+
+        // Same primitives, moved vertices: keep the tree topology and recompute bounds bottom-up.
+        // Children are always stored after their parent, so a reverse sweep visits children first.
+        std::shared_ptr<GeometryBVH> refitBVH(const GeometryBVH& previous, const GeometrySnapshot& snapshot) {
+            auto bvh = std::make_shared<GeometryBVH>(previous);
+            for (size_t i = 0; i < bvh->triangles.size(); ++i) {
+                setTriangle(*bvh, i, snapshot);
+            }
+            for (size_t n = bvh->nodes.size(); n-- > 0;) {
+                BVHNode& node = bvh->nodes[n];
+                if (node.count > 0) {
+                    computeLeafBounds(*bvh, node);
+                } else {
+                    const BVHNode& left = bvh->nodes[n + 1];
+                    const BVHNode& right = bvh->nodes[node.first];
+                    node.bmin = helios::make_vec3(std::min(left.bmin.x, right.bmin.x), std::min(left.bmin.y, right.bmin.y), std::min(left.bmin.z, right.bmin.z));
+                    node.bmax = helios::make_vec3(std::max(left.bmax.x, right.bmax.x), std::max(left.bmax.y, right.bmax.y), std::max(left.bmax.z, right.bmax.z));
+                }
+            }
+            return bvh;
+        }
+
+        inline bool rayBox(const helios::vec3& o, const helios::vec3& inv_d, float tmax, const BVHNode& node, float& t_entry) {
+            float tx1 = (node.bmin.x - o.x) * inv_d.x, tx2 = (node.bmax.x - o.x) * inv_d.x;
+            float tmin = std::min(tx1, tx2), tmx = std::max(tx1, tx2);
+            float ty1 = (node.bmin.y - o.y) * inv_d.y, ty2 = (node.bmax.y - o.y) * inv_d.y;
+            tmin = std::max(tmin, std::min(ty1, ty2));
+            tmx = std::min(tmx, std::max(ty1, ty2));
+            float tz1 = (node.bmin.z - o.z) * inv_d.z, tz2 = (node.bmax.z - o.z) * inv_d.z;
+            tmin = std::max(tmin, std::min(tz1, tz2));
+            tmx = std::min(tmx, std::max(tz1, tz2));
+            t_entry = std::max(tmin, 0.f);
+            return tmx >= t_entry && tmin < tmax;
+        }
+
+        inline bool rayBox(const helios::vec3& o, const helios::vec3& inv_d, float tmax, const BVHNode& node) {
+            float t_entry;
+            return rayBox(o, inv_d, tmax, node, t_entry);
+        }
+
+        inline bool rayTriangle(const helios::vec3& o, const helios::vec3& d, float tmax, const BVHTriangle& tri, float& t) {
+            const float eps = 1e-7f;
+            helios::vec3 p = cross(d, tri.e2);
+            float det = tri.e1 * p;
+            if (std::fabs(det) < eps) {
+                return false;
+            }
+            float inv_det = 1.f / det;
+            helios::vec3 s = o - tri.v0;
+            float u = (s * p) * inv_det;
+            if (u < 0.f || u > 1.f) {
+                return false;
+            }
+            helios::vec3 q = cross(s, tri.e1);
+            float v = (d * q) * inv_det;
+            if (v < 0.f || u + v > 1.f) {
+                return false;
+            }
+            t = (tri.e2 * q) * inv_det;
+            return t > 1e-5f && t < tmax;
+        }
+
+    } // namespace
+
+    bool GeometryBVH::occluded(const helios::vec3& o, const helios::vec3& d, float tmax, const uint8_t* primitive_mask, uint32_t ignore_primitive) const {
+        if (nodes.empty()) {
+            return false;
+        }
+        helios::vec3 inv_d(1.f / (d.x != 0.f ? d.x : 1e-20f), 1.f / (d.y != 0.f ? d.y : 1e-20f), 1.f / (d.z != 0.f ? d.z : 1e-20f));
+        uint32_t stack[64];
+        int sp = 0;
+        stack[sp++] = 0;
+        float t;
+        while (sp > 0) {
+            uint32_t ni = stack[--sp];
+            const BVHNode& node = nodes[ni];
+            if (!rayBox(o, inv_d, tmax, node)) {
+                continue;
+            }
+            if (node.count > 0) {
+                for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+                    uint32_t source = triangle_sources[i];
+                    if (source == ignore_primitive || (primitive_mask && !primitive_mask[source])) {
+                        continue;
+                    }
+                    if (rayTriangle(o, d, tmax, triangles[i], t)) {
+                        return true;
+                    }
+                }
+            } else if (sp < 63) {
+                stack[sp++] = node.first;  // right child
+                stack[sp++] = ni + 1;      // left child
+            }
+        }
+        return false;
+    }
+
+    bool GeometryBVH::intersect(const helios::vec3& o, const helios::vec3& d, float tmax, float& t_hit, uint32_t& triangle, const uint8_t* primitive_mask, uint32_t ignore_primitive) const {
+        if (nodes.empty()) {
+            return false;
+        }
+        helios::vec3 inv_d(1.f / (d.x != 0.f ? d.x : 1e-20f), 1.f / (d.y != 0.f ? d.y : 1e-20f), 1.f / (d.z != 0.f ? d.z : 1e-20f));
+        // Each stack entry keeps its box entry distance so subtrees behind the closest hit so far are skipped
+        uint32_t stack[64];
+        float stack_t[64];
+        int sp = 0;
+        bool hit = false;
+        float t;
+        if (!rayBox(o, inv_d, tmax, nodes[0], t)) {
+            return false;
+        }
+        stack[sp] = 0;
+        stack_t[sp++] = t;
+        while (sp > 0) {
+            --sp;
+            if (stack_t[sp] >= tmax) {
+                continue;
+            }
+            const uint32_t ni = stack[sp];
+            const BVHNode& node = nodes[ni];
+            if (node.count > 0) {
+                for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+                    uint32_t source = triangle_sources[i];
+                    if (source == ignore_primitive || (primitive_mask && !primitive_mask[source])) {
+                        continue;
+                    }
+                    if (rayTriangle(o, d, tmax, triangles[i], t)) {
+                        tmax = t;
+                        t_hit = t;
+                        triangle = i;
+                        hit = true;
+                    }
+                }
+                continue;
+            }
+            // Visit the nearer child first: push it last
+            float t_left, t_right;
+            bool left = rayBox(o, inv_d, tmax, nodes[ni + 1], t_left);
+            bool right = rayBox(o, inv_d, tmax, nodes[node.first], t_right);
+            if (left && right && sp < 62) {
+                bool left_first = t_left <= t_right;
+                stack[sp] = left_first ? node.first : ni + 1;
+                stack_t[sp++] = left_first ? t_right : t_left;
+                stack[sp] = left_first ? ni + 1 : node.first;
+                stack_t[sp++] = left_first ? t_left : t_right;
+            } else if (left && sp < 63) {
+                stack[sp] = ni + 1;
+                stack_t[sp++] = t_left;
+            } else if (right && sp < 63) {
+                stack[sp] = node.first;
+                stack_t[sp++] = t_right;
+            }
+        }
+        return hit;
+    }
+
+    uint64_t getGeometryRevision(helios::Context* context) {
+        // Always hash: the Context dirty flag can be cleared by native code that never tells PyHelios
+        GeometryHashes hashes = hashGeometry(context);
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        CacheEntry& entry = cache_entries[context];
+        advanceRevision(entry, hashes);
+        return entry.revision;
+    }
+
+    std::shared_ptr<const GeometryBVH> acquireGeometryBVH(helios::Context* context) {
+        {
+            GeometryHashes hashes = hashGeometry(context);
+            std::lock_guard<std::mutex> lock(cache_mutex);
+            CacheEntry& entry = cache_entries[context];
+            advanceRevision(entry, hashes);
+            if (entry.bvh && entry.bvh->revision == entry.revision) {
+                return entry.bvh;
+            }
+        }
+
+        // The geometry changed: copy it once and build or refit from the copy
+        GeometrySnapshot snapshot = takeSnapshot(context);
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        CacheEntry& entry = cache_entries[context];
+        advanceRevision(entry, snapshot.hashes);
+        if (entry.bvh && entry.bvh->revision == entry.revision) {
+            return entry.bvh;
+        }
+
+        std::shared_ptr<GeometryBVH> bvh;
+        if (entry.bvh && entry.bvh_topology_hash == snapshot.hashes.topology) {
+            bvh = refitBVH(*entry.bvh, snapshot);
+            entry.refits++;
+        } else {
+            bvh = buildBVH(snapshot);
+            entry.builds++;
+        }
+        bvh->revision = entry.revision;
+        entry.bvh = bvh;
+        entry.bvh_topology_hash = snapshot.hashes.topology;
+        return entry.bvh;
+    }
+
+    PrimitiveChangeSet getPrimitiveChanges(helios::Context* context, const void* observer, bool mark_clean) {
+        PrimitiveHashes current = takePrimitiveHashes(context);
+        PrimitiveChangeSet changes;
+
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto key = std::make_pair(static_cast<const helios::Context*>(context), observer);
+        auto it = primitive_baselines.find(key);
+        static const PrimitiveHashes empty_baseline;
+        const PrimitiveHashes& baseline = it != primitive_baselines.end() ? it->second : empty_baseline;
+        changes.has_baseline = it != primitive_baselines.end();
+
+        // Both lists are sorted by UUID, so a single merge pass classifies every primitive
+        size_t i = 0, j = 0;
+        while (i < current.size() || j < baseline.size()) {
+            if (j == baseline.size() || (i < current.size() && current[i].first < baseline[j].first)) {
+                changes.added.push_back(current[i++].first);
+            } else if (i == current.size() || baseline[j].first < current[i].first) {
+                changes.deleted.push_back(baseline[j++].first);
+            } else {
+                if (current[i].second != baseline[j].second) {
+                    changes.modified.push_back(current[i].first);
+                }
+                ++i;
+                ++j;
+            }
+        }
+
+        if (mark_clean) {
+            primitive_baselines[key] = std::move(current);
+        }
+        return changes;
+    }
+
+    void releasePrimitiveObserver(helios::Context* context, const void* observer) {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        primitive_baselines.erase(std::make_pair(static_cast<const helios::Context*>(context), observer));
+    }
+
+    void invalidateGeometryCache(helios::Context* context) {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto it = cache_entries.find(context);
+        if (it != cache_entries.end()) {
+            it->second.invalidated = true;
+        }
+    }
+
+    void releaseGeometryCache(helios::Context* context) {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        cache_entries.erase(context);  // callers still holding the BVH keep it alive until they release it
+        for (auto it = primitive_baselines.begin(); it != primitive_baselines.end();) {
+            it = it->first.first == context ? primitive_baselines.erase(it) : std::next(it);
+        }
+    }
+
+    void getGeometryCacheCounts(helios::Context* context, uint64_t& builds, uint64_t& refits) {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto it = cache_entries.find(context);
+        builds = it != cache_entries.end() ? it->second.builds : 0;
+        refits = it != cache_entries.end() ? it->second.refits : 0;
+    }
+
+} // namespace pyhelios
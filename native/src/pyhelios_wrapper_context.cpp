@@ -3,12 +3,30 @@
 
 #include "../include/pyhelios_wrapper_common.h"
 #include "../include/pyhelios_wrapper_context.h"
+#include "../include/pyhelios_geometry_cache.h"
 #include "Context.h"
 #include <string>
 #include <exception>
 #include <cstring>
 #include <cstdio>
 #include <atomic>
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+    // Reserve primitive storage ahead of a bulk insertion when the linked helios-core Context offers it;
+    // otherwise (the second overload) the Context grows as primitives are added
+    template <typename ContextType>
+    auto reservePrimitiveStorage(ContextType* context, size_t count, int) -> decltype(context->reservePrimitives(count), void()) {
+        context->reservePrimitives(count);
+    }
+
+    template <typename ContextType>
+    void reservePrimitiveStorage(ContextType*, size_t, long) {
+    }
+
+} // namespace
 
 extern "C" {
     // Context management - core functionality required by PyHelios
@@ -17,22 +35,142 @@ extern "C" {
     }
     
     PYHELIOS_API void destroyContext(helios::Context* context) {
+        pyhelios::releaseGeometryCache(context);
         delete context;
     }
     
     // Context state management
     PYHELIOS_API void markGeometryClean(helios::Context* context) {
-        context->markGeometryClean();
+        try {
+            clearError();
+            if (!context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
+                return;
+            }
+            context->markGeometryClean();
+        } catch (const std::runtime_error& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, e.what());
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (markGeometryClean): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (markGeometryClean): Unknown error marking geometry clean.");
+        }
     }
     
     PYHELIOS_API void markGeometryDirty(helios::Context* context) {
-        context->markGeometryDirty();
+        try {
+            clearError();
+            if (!context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
+                return;
+            }
+            context->markGeometryDirty();
+            pyhelios::invalidateGeometryCache(context);
+        } catch (const std::runtime_error& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, e.what());
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (markGeometryDirty): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (markGeometryDirty): Unknown error marking geometry dirty.");
+        }
     }
     
     PYHELIOS_API bool isGeometryDirty(helios::Context* context) {
         return context->isGeometryDirty();
     }
     
+    PYHELIOS_API unsigned long long getGeometryRevision(helios::Context* context) {
+        try {
+            clearError();
+            if (!context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
+                return 0;
+            }
+            return pyhelios::getGeometryRevision(context);
+        } catch (const std::runtime_error& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, e.what());
+            return 0;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (getGeometryRevision): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (getGeometryRevision): Unknown error computing geometry revision.");
+            return 0;
+        }
+    }
+    
+    PYHELIOS_API size_t getDirtyPrimitiveUUIDs(helios::Context* context, unsigned int* out, size_t capacity) {
+        try {
+            clearError();
+            if (!context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
+                return 0;
+            }
+            std::vector<uint> dirty = context->getDirtyUUIDs();
+            std::sort(dirty.begin(), dirty.end());
+            if (out && capacity >= dirty.size()) {
+                std::copy(dirty.begin(), dirty.end(), out);
+            }
+            return dirty.size();
+        } catch (const std::runtime_error& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, e.what());
+            return 0;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (getDirtyPrimitiveUUIDs): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (getDirtyPrimitiveUUIDs): Unknown error computing dirty primitives.");
+            return 0;
+        }
+    }
+    
+    PYHELIOS_API size_t getDeletedPrimitiveUUIDs(helios::Context* context, unsigned int* out, size_t capacity) {
+        try {
+            clearError();
+            if (!context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
+                return 0;
+            }
+            std::vector<uint> deleted = context->getDeletedUUIDs();
+            std::sort(deleted.begin(), deleted.end());
+            if (out && capacity >= deleted.size()) {
+                std::copy(deleted.begin(), deleted.end(), out);
+            }
+            return deleted.size();
+        } catch (const std::runtime_error& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, e.what());
+            return 0;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (getDeletedPrimitiveUUIDs): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (getDeletedPrimitiveUUIDs): Unknown error computing deleted primitives.");
+            return 0;
+        }
+    }
+    
+    PYHELIOS_API void getGeometryCacheStats(helios::Context* context, unsigned long long* builds, unsigned long long* refits) {
+        try {
+            clearError();
+            if (!context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
+                return;
+            }
+            if (!builds || !refits) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Output pointers cannot be null");
+                return;
+            }
+            uint64_t build_count = 0, refit_count = 0;
+            pyhelios::getGeometryCacheCounts(context, build_count, refit_count);
+            *builds = build_count;
+            *refits = refit_count;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (getGeometryCacheStats): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (getGeometryCacheStats): Unknown error reading geometry cache statistics.");
+        }
+    }
+    
     // Basic primitive creation
     PYHELIOS_API unsigned int addPatch(helios::Context* context) {
         try {
@@ -340,7 +478,75 @@ extern "C" {
             return nullptr;
         }
     }
-    
+
+    // Bulk triangle mesh ingestion - creates all faces in a single call, writing UUIDs into a caller-provided buffer
+    PYHELIOS_API unsigned int addTrianglesBulk(helios::Context* context,
+                                               const float* vertices, size_t nverts,
+                                               const unsigned int* faces, size_t nfaces,
+                                               const float* colors,
+                                               unsigned int* out_uuids) {
+        try {
+            clearError();
+            if (!context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
+                return 0;
+            }
+            if (!vertices || !faces || !out_uuids) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "One or more input arrays is null");
+                return 0;
+            }
+            if (nverts == 0 || nfaces == 0) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Vertex or face count is zero");
+                return 0;
+            }
+
+            // Validate all face indices before creating anything so a bad mesh leaves the Context untouched
+            for (size_t i = 0; i < nfaces * 3; i++) {
+                if (faces[i] >= nverts) {
+                    setError(PYHELIOS_ERROR_INVALID_PARAMETER,
+                            "Face " + std::to_string(i / 3) + " references vertex " + std::to_string(faces[i]) +
+                            ", but only " + std::to_string(nverts) + " vertices provided");
+                    return 0;
+                }
+            }
+
+            // Convert the vertex array once so shared vertices are not rebuilt per face
+            std::vector<helios::vec3> vertex_buffer;
+            vertex_buffer.reserve(nverts);
+            for (size_t i = 0; i < nverts; i++) {
+                vertex_buffer.emplace_back(vertices[i * 3], vertices[i * 3 + 1], vertices[i * 3 + 2]);
+            }
+
+            reservePrimitiveStorage(context, context->getPrimitiveCount() + nfaces, 0);
+
+            size_t created = 0;
+            for (size_t f = 0; f < nfaces; f++) {
+                const helios::vec3& v0 = vertex_buffer[faces[f * 3]];
+                const helios::vec3& v1 = vertex_buffer[faces[f * 3 + 1]];
+                const helios::vec3& v2 = vertex_buffer[faces[f * 3 + 2]];
+                if (colors) {
+                    helios::RGBcolor color(colors[f * 3], colors[f * 3 + 1], colors[f * 3 + 2]);
+                    out_uuids[f] = context->addTriangle(v0, v1, v2, color);
+                } else {
+                    out_uuids[f] = context->addTriangle(v0, v1, v2);
+                }
+                created++;
+            }
+
+            return static_cast<unsigned int>(created);
+
+        } catch (const std::runtime_error& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, e.what());
+            return 0;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (Context::addTrianglesBulk): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (Context::addTrianglesBulk): Unknown error creating triangles.");
+            return 0;
+        }
+    }
+
     // Compound geometry creation functions - return arrays of UUIDs
     
     // addTile functions
@@ -702,7 +908,7 @@ extern "C" {
         try {
             clearError(); // Clear any previous error
             helios::vec3 normal = context->getPrimitiveNormal(uuid);
-            static float result[3];
+            static thread_local float result[3];
             result[0] = normal.x;
             result[1] = normal.y;
             result[2] = normal.z;
@@ -734,8 +940,8 @@ extern "C" {
             clearError(); // Clear any previous error
             std::vector<helios::vec3> vertices = context->getPrimitiveVertices(uuid);
             
-            // Allocate static buffer for vertex data (3 floats per vertex)
-            static std::vector<float> vertex_buffer;
+            // Thread-local buffer for vertex data (3 floats per vertex) so concurrent callers do not share storage
+            static thread_local std::vector<float> vertex_buffer;
             vertex_buffer.clear();
             vertex_buffer.reserve(vertices.size() * 3);
             
@@ -773,7 +979,7 @@ extern "C" {
         try {
             clearError(); // Clear any previous error
             helios::RGBcolor color = context->getPrimitiveColor(uuid);
-            static float result[3];
+            static thread_local float result[3];
             result[0] = color.r;
             result[1] = color.g;
             result[2] = color.b;
@@ -800,7 +1006,7 @@ extern "C" {
         try {
             clearError(); // Clear any previous error
             helios::RGBcolor color = context->getPrimitiveColorRGB(uuid);
-            static float result[3];
+            static thread_local float result[3];
             result[0] = color.r;
             result[1] = color.g;
             result[2] = color.b;
@@ -827,7 +1033,7 @@ extern "C" {
         try {
             clearError(); // Clear any previous error
             helios::RGBAcolor color = context->getPrimitiveColorRGBA(uuid);
-            static float result[4];
+            static thread_local float result[4];
             result[0] = color.r;
             result[1] = color.g;
             result[2] = color.b;
@@ -851,14 +1057,115 @@ extern "C" {
         }
     }
     
+    // Bulk geometry export - fills caller-provided structure-of-arrays buffers for a UUID list in one call
+    PYHELIOS_API size_t getPrimitiveGeometryBulk(helios::Context* context, const unsigned int* uuids, size_t n,
+                                                 unsigned int* vertex_offsets, float* vertices, size_t vertex_capacity,
+                                                 float* normals, float* areas, unsigned int* types, float* colors) {
+        try {
+            clearError();
+            if (!context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
+                return 0;
+            }
+            if (!uuids || !vertex_offsets) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "UUID array or vertex offset buffer is null");
+                return 0;
+            }
+
+            // First pass: validate UUIDs and build the vertex offset table (n+1 entries)
+            size_t total_vertices = 0;
+            vertex_offsets[0] = 0;
+            for (size_t i = 0; i < n; i++) {
+                if (!context->doesPrimitiveExist(uuids[i])) {
+                    setError(PYHELIOS_ERROR_UUID_NOT_FOUND, "UUID " + std::to_string(uuids[i]) + " does not exist in context");
+                    return 0;
+                }
+                // Vertex count is fixed per primitive type, so the offsets can be built without copying vertices
+                switch (context->getPrimitiveType(uuids[i])) {
+                    case helios::PRIMITIVE_TYPE_PATCH:
+                        total_vertices += 4;
+                        break;
+                    case helios::PRIMITIVE_TYPE_TRIANGLE:
+                        total_vertices += 3;
+                        break;
+                    case helios::PRIMITIVE_TYPE_VOXEL:
+                        total_vertices += 8;
+                        break;
+                    default:
+                        total_vertices += context->getPrimitiveVertices(uuids[i]).size();
+                        break;
+                }
+                vertex_offsets[i + 1] = static_cast<unsigned int>(total_vertices);
+            }
+
+            // Size query: caller passes a null vertex buffer to learn how many vertices to allocate
+            if (!vertices) {
+                return total_vertices;
+            }
+            if (vertex_capacity < total_vertices) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER,
+                        "Vertex buffer holds " + std::to_string(vertex_capacity) + " vertices, but " +
+                        std::to_string(total_vertices) + " are required");
+                return 0;
+            }
+
+            // Second pass: fill all requested arrays
+            for (size_t i = 0; i < n; i++) {
+                unsigned int uuid = uuids[i];
+                std::vector<helios::vec3> primitive_vertices = context->getPrimitiveVertices(uuid);
+                if (primitive_vertices.size() != vertex_offsets[i + 1] - vertex_offsets[i]) {
+                    setError(PYHELIOS_ERROR_RUNTIME, "Unexpected vertex count for primitive UUID " + std::to_string(uuid));
+                    return 0;
+                }
+                float* dst = vertices + static_cast<size_t>(vertex_offsets[i]) * 3;
+                for (const auto& vertex : primitive_vertices) {
+                    *dst++ = vertex.x;
+                    *dst++ = vertex.y;
+                    *dst++ = vertex.z;
+                }
+                if (normals) {
+                    helios::vec3 normal = context->getPrimitiveNormal(uuid);
+                    normals[i * 3] = normal.x;
+                    normals[i * 3 + 1] = normal.y;
+                    normals[i * 3 + 2] = normal.z;
+                }
+                if (areas) {
+                    areas[i] = context->getPrimitiveArea(uuid);
+                }
+                if (types) {
+                    types[i] = (unsigned int)context->getPrimitiveType(uuid);
+                }
+                if (colors) {
+                    helios::RGBAcolor color = context->getPrimitiveColorRGBA(uuid);
+                    colors[i * 4] = color.r;
+                    colors[i * 4 + 1] = color.g;
+                    colors[i * 4 + 2] = color.b;
+                    colors[i * 4 + 3] = color.a;
+                }
+            }
+
+            return total_vertices;
+
+        } catch (const std::runtime_error& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, e.what());
+            return 0;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (Context::getPrimitiveGeometryBulk): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (Context::getPrimitiveGeometryBulk): Unknown error exporting primitive geometry.");
+            return 0;
+        }
+    }
+    
     PYHELIOS_API unsigned int* getAllUUIDs(helios::Context* context, unsigned int* size) {
         try {
             clearError(); // Clear any previous error
             std::vector<unsigned int> uuids = context->getAllUUIDs();
             *size = uuids.size();
             
-            // Allocate static buffer for UUID data
-            static std::vector<unsigned int> uuid_buffer;
+            // Thread-local buffer for UUID data so concurrent callers do not share storage
+            static thread_local std::vector<unsigned int> uuid_buffer;
             uuid_buffer = uuids;
             
             return uuid_buffer.data();
@@ -888,7 +1195,7 @@ extern "C" {
             std::vector<unsigned int> object_ids = context->getAllObjectIDs();
             *size = object_ids.size();
             
-            static std::vector<unsigned int> object_buffer;
+            static thread_local std::vector<unsigned int> object_buffer;
             object_buffer = object_ids;
             
             return object_buffer.data();
@@ -913,7 +1220,7 @@ extern "C" {
             std::vector<unsigned int> uuids = context->getObjectPrimitiveUUIDs(object_id);
             *size = uuids.size();
             
-            static std::vector<unsigned int> uuid_buffer;
+            static thread_local std::vector<unsigned int> uuid_buffer;
             uuid_buffer = uuids;
             
             return uuid_buffer.data();
@@ -938,6 +1245,186 @@ extern "C" {
         }
     }
 
+    // Caller-buffer variants of the ID list getters. Each returns the required element count and only writes
+    // when the buffer is large enough, so callers size-query with a null buffer and then fill their own storage.
+    PYHELIOS_API size_t getAllUUIDsToBuffer(helios::Context* context, unsigned int* out, size_t capacity) {
+        try {
+            clearError();
+            if (!context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
+                return 0;
+            }
+            std::vector<unsigned int> uuids = context->getAllUUIDs();
+            if (out && capacity >= uuids.size()) {
+                std::copy(uuids.begin(), uuids.end(), out);
+            }
+            return uuids.size();
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (Context::getAllUUIDs): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (Context::getAllUUIDs): Unknown error retrieving all UUIDs.");
+            return 0;
+        }
+    }
+
+    PYHELIOS_API size_t getAllObjectIDsToBuffer(helios::Context* context, unsigned int* out, size_t capacity) {
+        try {
+            clearError();
+            if (!context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
+                return 0;
+            }
+            std::vector<unsigned int> object_ids = context->getAllObjectIDs();
+            if (out && capacity >= object_ids.size()) {
+                std::copy(object_ids.begin(), object_ids.end(), out);
+            }
+            return object_ids.size();
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (Context::getAllObjectIDs): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (Context::getAllObjectIDs): Unknown error retrieving all object IDs.");
+            return 0;
+        }
+    }
+
+    PYHELIOS_API size_t getObjectPrimitiveUUIDsToBuffer(helios::Context* context, unsigned int object_id, unsigned int* out, size_t capacity) {
+        try {
+            clearError();
+            if (!context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
+                return 0;
+            }
+            std::vector<unsigned int> uuids = context->getObjectPrimitiveUUIDs(object_id);
+            if (out && capacity >= uuids.size()) {
+                std::copy(uuids.begin(), uuids.end(), out);
+            }
+            return uuids.size();
+        } catch (const std::runtime_error& e) {
+            // Same error code as getObjectPrimitiveUUIDs for unknown objects
+            setError(PYHELIOS_ERROR_FILE_IO, e.what());
+            return 0;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (Context::getObjectPrimitiveUUIDs): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (Context::getObjectPrimitiveUUIDs): Unknown error accessing object with ID " + std::to_string(object_id) + ".");
+            return 0;
+        }
+    }
+
+    // Caller-buffer variants of the per-primitive geometry getters. Fixed-size results are written to a
+    // buffer of 3 (normal, RGB) or 4 (RGBA) floats; vertices follow the size-query convention above.
+    PYHELIOS_API size_t getPrimitiveVerticesToBuffer(helios::Context* context, unsigned int uuid, float* out, size_t capacity) {
+        try {
+            clearError();
+            if (!context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
+                return 0;
+            }
+            std::vector<helios::vec3> vertices = context->getPrimitiveVertices(uuid);
+            if (out && capacity >= vertices.size() * 3) {
+                for (size_t i = 0; i < vertices.size(); i++) {
+                    out[i * 3] = vertices[i].x;
+                    out[i * 3 + 1] = vertices[i].y;
+                    out[i * 3 + 2] = vertices[i].z;
+                }
+            }
+            return vertices.size() * 3;
+        } catch (const std::runtime_error& e) {
+            setError(PYHELIOS_ERROR_UUID_NOT_FOUND, e.what());
+            return 0;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (Context::getPrimitiveVertices): Unknown error accessing primitive with UUID " + std::to_string(uuid) + ".");
+            return 0;
+        }
+    }
+
+    PYHELIOS_API void getPrimitiveNormalToBuffer(helios::Context* context, unsigned int uuid, float* out) {
+        try {
+            clearError();
+            if (!context || !out) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Required parameters are null");
+                return;
+            }
+            helios::vec3 normal = context->getPrimitiveNormal(uuid);
+            out[0] = normal.x;
+            out[1] = normal.y;
+            out[2] = normal.z;
+        } catch (const std::runtime_error& e) {
+            setError(PYHELIOS_ERROR_UUID_NOT_FOUND, e.what());
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (Context::getPrimitiveNormal): Unknown error accessing primitive with UUID " + std::to_string(uuid) + ".");
+        }
+    }
+
+    PYHELIOS_API void getPrimitiveColorToBuffer(helios::Context* context, unsigned int uuid, float* out) {
+        try {
+            clearError();
+            if (!context || !out) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Required parameters are null");
+                return;
+            }
+            helios::RGBcolor color = context->getPrimitiveColor(uuid);
+            out[0] = color.r;
+            out[1] = color.g;
+            out[2] = color.b;
+        } catch (const std::runtime_error& e) {
+            setError(PYHELIOS_ERROR_UUID_NOT_FOUND, e.what());
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (Context::getPrimitiveColor): Unknown error accessing primitive with UUID " + std::to_string(uuid) + ".");
+        }
+    }
+
+    PYHELIOS_API void getPrimitiveColorRGBToBuffer(helios::Context* context, unsigned int uuid, float* out) {
+        try {
+            clearError();
+            if (!context || !out) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Required parameters are null");
+                return;
+            }
+            helios::RGBcolor color = context->getPrimitiveColorRGB(uuid);
+            out[0] = color.r;
+            out[1] = color.g;
+            out[2] = color.b;
+        } catch (const std::runtime_error& e) {
+            setError(PYHELIOS_ERROR_UUID_NOT_FOUND, e.what());
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (Context::getPrimitiveColorRGB): Unknown error accessing primitive with UUID " + std::to_string(uuid) + ".");
+        }
+    }
+
+    PYHELIOS_API void getPrimitiveColorRGBAToBuffer(helios::Context* context, unsigned int uuid, float* out) {
+        try {
+            clearError();
+            if (!context || !out) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Required parameters are null");
+                return;
+            }
+            helios::RGBAcolor color = context->getPrimitiveColorRGBA(uuid);
+            out[0] = color.r;
+            out[1] = color.g;
+            out[2] = color.b;
+            out[3] = color.a;
+        } catch (const std::runtime_error& e) {
+            setError(PYHELIOS_ERROR_UUID_NOT_FOUND, e.what());
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (Context::getPrimitiveColorRGBA): Unknown error accessing primitive with UUID " + std::to_string(uuid) + ".");
+        }
+    }
+
     PYHELIOS_API unsigned int* loadPLY(helios::Context* context, const char* filename, float* origin, float height, const char* upaxis, unsigned int* size) {
         try {
             clearError();
@@ -971,8 +1458,8 @@ extern "C" {
             
             std::vector<unsigned int> uuids = context->loadPLY(filename, origin_vec, height, upaxis_str, false);
             
-            // Allocate static buffer for UUID data
-            static std::vector<unsigned int> uuid_buffer;
+            // Thread-local buffer for UUID data so concurrent callers do not share storage
+            static thread_local std::vector<unsigned int> uuid_buffer;
             uuid_buffer = uuids;
             *size = uuid_buffer.size();
             return uuid_buffer.data();
@@ -2115,6 +2602,281 @@ extern "C" {
         }
     }
 
+    // Columnar primitive data getter - one label/type resolution, then a tight copy loop into a packed buffer
+    PYHELIOS_API int getPrimitiveDataColumn(helios::Context* context, const unsigned int* uuids, size_t n, const char* label, void* out, int expected_type) {
+        try {
+            clearError();
+            if (!context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
+                return -1;
+            }
+            if (!uuids || !label || !out) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "UUID array, label, or output buffer is null");
+                return -1;
+            }
+            if (n == 0) {
+                return 0;
+            }
+
+            // Data types are global per label, so resolve once for the whole column
+            helios::HeliosDataType data_type = context->getPrimitiveDataType(label);
+            if ((int)data_type != expected_type) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER,
+                        std::string("Primitive data '") + label + "' has type " + std::to_string((int)data_type) +
+                        ", expected " + std::to_string(expected_type));
+                return -1;
+            }
+
+            // Check existence up front so a missing value never leaves a partially filled buffer
+            for (size_t i = 0; i < n; i++) {
+                if (!context->doesPrimitiveExist(uuids[i])) {
+                    setError(PYHELIOS_ERROR_UUID_NOT_FOUND, "UUID " + std::to_string(uuids[i]) + " does not exist in context");
+                    return -1;
+                }
+                if (!context->doesPrimitiveDataExist(uuids[i], label)) {
+                    setError(PYHELIOS_ERROR_INVALID_PARAMETER,
+                            std::string("Primitive data '") + label + "' does not exist for UUID " + std::to_string(uuids[i]));
+                    return -1;
+                }
+            }
+
+            switch (data_type) {
+                case helios::HELIOS_TYPE_INT: {
+                    int* dst = static_cast<int*>(out);
+                    for (size_t i = 0; i < n; i++) {
+                        context->getPrimitiveData(uuids[i], label, dst[i]);
+                    }
+                    break;
+                }
+                case helios::HELIOS_TYPE_UINT: {
+                    unsigned int* dst = static_cast<unsigned int*>(out);
+                    for (size_t i = 0; i < n; i++) {
+                        context->getPrimitiveData(uuids[i], label, dst[i]);
+                    }
+                    break;
+                }
+                case helios::HELIOS_TYPE_FLOAT: {
+                    float* dst = static_cast<float*>(out);
+                    for (size_t i = 0; i < n; i++) {
+                        context->getPrimitiveData(uuids[i], label, dst[i]);
+                    }
+                    break;
+                }
+                case helios::HELIOS_TYPE_DOUBLE: {
+                    double* dst = static_cast<double*>(out);
+                    for (size_t i = 0; i < n; i++) {
+                        context->getPrimitiveData(uuids[i], label, dst[i]);
+                    }
+                    break;
+                }
+                case helios::HELIOS_TYPE_VEC2: {
+                    float* dst = static_cast<float*>(out);
+                    helios::vec2 value;
+                    for (size_t i = 0; i < n; i++) {
+                        context->getPrimitiveData(uuids[i], label, value);
+                        dst[i * 2] = value.x;
+                        dst[i * 2 + 1] = value.y;
+                    }
+                    break;
+                }
+                case helios::HELIOS_TYPE_VEC3: {
+                    float* dst = static_cast<float*>(out);
+                    helios::vec3 value;
+                    for (size_t i = 0; i < n; i++) {
+                        context->getPrimitiveData(uuids[i], label, value);
+                        dst[i * 3] = value.x;
+                        dst[i * 3 + 1] = value.y;
+                        dst[i * 3 + 2] = value.z;
+                    }
+                    break;
+                }
+                case helios::HELIOS_TYPE_VEC4: {
+                    float* dst = static_cast<float*>(out);
+                    helios::vec4 value;
+                    for (size_t i = 0; i < n; i++) {
+                        context->getPrimitiveData(uuids[i], label, value);
+                        dst[i * 4] = value.x;
+                        dst[i * 4 + 1] = value.y;
+                        dst[i * 4 + 2] = value.z;
+                        dst[i * 4 + 3] = value.w;
+                    }
+                    break;
+                }
+                case helios::HELIOS_TYPE_INT2: {
+                    int* dst = static_cast<int*>(out);
+                    helios::int2 value;
+                    for (size_t i = 0; i < n; i++) {
+                        context->getPrimitiveData(uuids[i], label, value);
+                        dst[i * 2] = value.x;
+                        dst[i * 2 + 1] = value.y;
+                    }
+                    break;
+                }
+                case helios::HELIOS_TYPE_INT3: {
+                    int* dst = static_cast<int*>(out);
+                    helios::int3 value;
+                    for (size_t i = 0; i < n; i++) {
+                        context->getPrimitiveData(uuids[i], label, value);
+                        dst[i * 3] = value.x;
+                        dst[i * 3 + 1] = value.y;
+                        dst[i * 3 + 2] = value.z;
+                    }
+                    break;
+                }
+                case helios::HELIOS_TYPE_INT4: {
+                    int* dst = static_cast<int*>(out);
+                    helios::int4 value;
+                    for (size_t i = 0; i < n; i++) {
+                        context->getPrimitiveData(uuids[i], label, value);
+                        dst[i * 4] = value.x;
+                        dst[i * 4 + 1] = value.y;
+                        dst[i * 4 + 2] = value.z;
+                        dst[i * 4 + 3] = value.w;
+                    }
+                    break;
+                }
+                default:
+                    setError(PYHELIOS_ERROR_INVALID_PARAMETER, std::string("Primitive data '") + label + "' has a type that cannot be returned as a column");
+                    return -1;
+            }
+
+            return static_cast<int>(n);
+
+        } catch (const std::runtime_error& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, e.what());
+            return -1;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (Context::getPrimitiveDataColumn): ") + e.what());
+            return -1;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (Context::getPrimitiveDataColumn): Unknown error getting primitive data column.");
+            return -1;
+        }
+    }
+
+    // Columnar primitive data setter - single type dispatch, then a tight write loop (or one value broadcast to all UUIDs)
+    PYHELIOS_API int setPrimitiveDataColumn(helios::Context* context, const unsigned int* uuids, size_t n, const char* label, int data_type, const void* values, bool broadcast) {
+        try {
+            clearError();
+            if (!context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
+                return -1;
+            }
+            if (!uuids || !label || !values) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "UUID array, label, or value buffer is null");
+                return -1;
+            }
+            if (n == 0) {
+                return 0;
+            }
+
+            // Check all UUIDs first so an invalid one never leaves the label partially written
+            for (size_t i = 0; i < n; i++) {
+                if (!context->doesPrimitiveExist(uuids[i])) {
+                    setError(PYHELIOS_ERROR_UUID_NOT_FOUND, "UUID " + std::to_string(uuids[i]) + " does not exist in context");
+                    return -1;
+                }
+            }
+
+            // In broadcast mode every UUID reads element 0 of the value buffer
+            const size_t stride = broadcast ? 0 : 1;
+
+            switch (data_type) {
+                case helios::HELIOS_TYPE_INT: {
+                    const int* src = static_cast<const int*>(values);
+                    for (size_t i = 0; i < n; i++) {
+                        context->setPrimitiveData(uuids[i], label, src[i * stride]);
+                    }
+                    break;
+                }
+                case helios::HELIOS_TYPE_UINT: {
+                    const unsigned int* src = static_cast<const unsigned int*>(values);
+                    for (size_t i = 0; i < n; i++) {
+                        context->setPrimitiveData(uuids[i], label, src[i * stride]);
+                    }
+                    break;
+                }
+                case helios::HELIOS_TYPE_FLOAT: {
+                    const float* src = static_cast<const float*>(values);
+                    for (size_t i = 0; i < n; i++) {
+                        context->setPrimitiveData(uuids[i], label, src[i * stride]);
+                    }
+                    break;
+                }
+                case helios::HELIOS_TYPE_DOUBLE: {
+                    const double* src = static_cast<const double*>(values);
+                    for (size_t i = 0; i < n; i++) {
+                        context->setPrimitiveData(uuids[i], label, src[i * stride]);
+                    }
+                    break;
+                }
+                case helios::HELIOS_TYPE_VEC2: {
+                    const float* src = static_cast<const float*>(values);
+                    for (size_t i = 0; i < n; i++) {
+                        const float* v = src + i * stride * 2;
+                        context->setPrimitiveData(uuids[i], label, helios::make_vec2(v[0], v[1]));
+                    }
+                    break;
+                }
+                case helios::HELIOS_TYPE_VEC3: {
+                    const float* src = static_cast<const float*>(values);
+                    for (size_t i = 0; i < n; i++) {
+                        const float* v = src + i * stride * 3;
+                        context->setPrimitiveData(uuids[i], label, helios::make_vec3(v[0], v[1], v[2]));
+                    }
+                    break;
+                }
+                case helios::HELIOS_TYPE_VEC4: {
+                    const float* src = static_cast<const float*>(values);
+                    for (size_t i = 0; i < n; i++) {
+                        const float* v = src + i * stride * 4;
+                        context->setPrimitiveData(uuids[i], label, helios::make_vec4(v[0], v[1], v[2], v[3]));
+                    }
+                    break;
+                }
+                case helios::HELIOS_TYPE_INT2: {
+                    const int* src = static_cast<const int*>(values);
+                    for (size_t i = 0; i < n; i++) {
+                        const int* v = src + i * stride * 2;
+                        context->setPrimitiveData(uuids[i], label, helios::make_int2(v[0], v[1]));
+                    }
+                    break;
+                }
+                case helios::HELIOS_TYPE_INT3: {
+                    const int* src = static_cast<const int*>(values);
+                    for (size_t i = 0; i < n; i++) {
+                        const int* v = src + i * stride * 3;
+                        context->setPrimitiveData(uuids[i], label, helios::make_int3(v[0], v[1], v[2]));
+                    }
+                    break;
+                }
+                case helios::HELIOS_TYPE_INT4: {
+                    const int* src = static_cast<const int*>(values);
+                    for (size_t i = 0; i < n; i++) {
+                        const int* v = src + i * stride * 4;
+                        context->setPrimitiveData(uuids[i], label, helios::make_int4(v[0], v[1], v[2], v[3]));
+                    }
+                    break;
+                }
+                default:
+                    setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Data type " + std::to_string(data_type) + " cannot be set as a column");
+                    return -1;
+            }
+
+            return static_cast<int>(n);
+
+        } catch (const std::runtime_error& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, e.what());
+            return -1;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (Context::setPrimitiveDataColumn): ") + e.what());
+            return -1;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (Context::setPrimitiveDataColumn): Unknown error setting primitive data column.");
+            return -1;
+        }
+    }
+
     PYHELIOS_API void colorPrimitiveByDataPseudocolor(helios::Context* context, unsigned int* uuids, size_t num_uuids, const char* primitive_data, const char* colormap, unsigned int ncolors) {
         if (context == nullptr) {
             setError(PYHELIOS_ERROR_INVALID_PARAMETER, "ERROR (colorPrimitiveByDataPseudocolor): Context pointer is null.");
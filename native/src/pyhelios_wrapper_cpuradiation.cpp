@@ -0,0 +1,1378 @@
+// PyHelios C Interface - CPU Radiation Functions
+// Provides radiation band simulation on the CPU for builds without CUDA/OptiX
+
+#include "../include/pyhelios_wrapper_common.h"
+#include "../include/pyhelios_wrapper_cpuradiation.h"
+#include "../include/pyhelios_cpu_radiation.h"
+#include "Context.h"
+#include <string>
+#include <exception>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <stdexcept>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+    // Camera properties array layout: [resolution_x, resolution_y, focal_distance, lens_diameter, HFOV, FOV_aspect_ratio]
+    pyhelios::CPURadiationCamera makeCPUCamera(const char** band_labels, size_t band_count, const helios::vec3& position,
+                                               const helios::vec3& lookat, const float* camera_properties, unsigned int antialiasing_samples) {
+        pyhelios::CPURadiationCamera camera;
+        for (size_t i = 0; i < band_count; i++) {
+            if (band_labels[i]) {
+                camera.band_labels.emplace_back(band_labels[i]);
+            }
+        }
+        camera.position = position;
+        camera.lookat = lookat;
+        camera.width = static_cast<uint>(std::max(0.f, camera_properties[0]));
+        camera.height = static_cast<uint>(std::max(0.f, camera_properties[1]));
+        camera.focal_plane_distance = camera_properties[2];
+        camera.lens_diameter = camera_properties[3];
+        camera.HFOV = camera_properties[4];
+        camera.FOV_aspect_ratio = camera_properties[5];
+        camera.antialiasing_samples = antialiasing_samples;
+        return camera;
+    }
+
+} // namespace
+
+//! Background run of runCPURadiationBandMultiple; the error of the worker thread is replayed on wait
+struct CPURadiationJob {
+    pyhelios::CPURadiationModel* model = nullptr;  //!< Cleared once the results were written (or the model destroyed)
+    std::unique_ptr<pyhelios::CPURadiationModel::PreparedRun> run;  //!< Inputs read from the Context when the job started
+    pyhelios::CPURadiationRunMonitor monitor;
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable finished_condition;
+    bool finished = false;
+    int error_code = PYHELIOS_SUCCESS;
+    std::string error_message;
+};
+
+namespace {
+
+    // Jobs whose results have not been written yet, per model; a model runs one job at a time
+    std::mutex running_jobs_mutex;
+    std::map<pyhelios::CPURadiationModel*, CPURadiationJob*> running_jobs;
+
+    // Detach a finished job from its model; the caller holds job->mutex
+    pyhelios::CPURadiationModel* releaseJobModel(CPURadiationJob* job) {
+        pyhelios::CPURadiationModel* model = job->model;
+        if (model) {
+            std::lock_guard<std::mutex> lock(running_jobs_mutex);
+            auto it = running_jobs.find(model);
+            if (it != running_jobs.end() && it->second == job) {
+                running_jobs.erase(it);
+            }
+        }
+        job->model = nullptr;
+        return model;
+    }
+
+    // The worker reads the model and writes its results: every other entry point waits until the job was waited for
+    void requireNoActiveJob(pyhelios::CPURadiationModel* model) {
+        std::lock_guard<std::mutex> lock(running_jobs_mutex);
+        if (running_jobs.count(model)) {
+            throw std::runtime_error("A radiation run started by runBandAsync is still active for this model; wait for or destroy the job first");
+        }
+    }
+
+    bool waitForJob(CPURadiationJob* job, double timeout_seconds) {
+        std::unique_lock<std::mutex> lock(job->mutex);
+        if (timeout_seconds < 0.0) {
+            job->finished_condition.wait(lock, [job] { return job->finished; });
+            return true;
+        }
+        return job->finished_condition.wait_for(lock, std::chrono::duration<double>(timeout_seconds), [job] { return job->finished; });
+    }
+
+} // namespace
+
+extern "C" {
+    // CPURadiationModel C interface functions
+    
+    PYHELIOS_API pyhelios::CPURadiationModel* createCPURadiationModel(helios::Context* context) {
+        try {
+            clearError();
+            if (!context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
+                return nullptr;
+            }
+            return new pyhelios::CPURadiationModel(context);
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::constructor): ") + e.what());
+            return nullptr;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::constructor): Unknown error creating CPURadiationModel.");
+            return nullptr;
+        }
+    }
+    
+    PYHELIOS_API void destroyCPURadiationModel(pyhelios::CPURadiationModel* radiation_model) {
+        try {
+            clearError();
+            if (radiation_model != nullptr) {
+                // A background run must not outlive its model
+                CPURadiationJob* job = nullptr;
+                {
+                    std::lock_guard<std::mutex> lock(running_jobs_mutex);
+                    auto it = running_jobs.find(radiation_model);
+                    if (it != running_jobs.end()) {
+                        job = it->second;
+                    }
+                }
+                if (job) {
+                    job->monitor.cancel = true;
+                    waitForJob(job, -1.0);
+                    std::lock_guard<std::mutex> lock(job->mutex);
+                    releaseJobModel(job);
+                }
+                delete radiation_model;
+            }
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::destructor): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::destructor): Unknown error destroying CPURadiationModel.");
+        }
+    }
+    
+    PYHELIOS_API void disableCPURadiationMessages(pyhelios::CPURadiationModel* radiation_model) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            radiation_model->setMessageFlag(false);
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::disableMessages): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::disableMessages): Unknown error disabling messages.");
+        }
+    }
+    
+    PYHELIOS_API void enableCPURadiationMessages(pyhelios::CPURadiationModel* radiation_model) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            radiation_model->setMessageFlag(true);
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::enableMessages): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::enableMessages): Unknown error enabling messages.");
+        }
+    }
+    
+    PYHELIOS_API void setCPURadiationThreadCount(pyhelios::CPURadiationModel* radiation_model, int num_threads) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            radiation_model->setThreadCount(num_threads);
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::setThreadCount): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::setThreadCount): Unknown error setting thread count.");
+        }
+    }
+    
+    PYHELIOS_API void setCPURadiationSeed(pyhelios::CPURadiationModel* radiation_model, unsigned int seed) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            radiation_model->setSeed(seed);
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::setSeed): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::setSeed): Unknown error setting random seed.");
+        }
+    }
+    
+    PYHELIOS_API void addCPURadiationBand(pyhelios::CPURadiationModel* radiation_model, const char* label) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label is null");
+                return;
+            }
+            radiation_model->addBand(std::string(label));
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::addRadiationBand): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::addRadiationBand): Unknown error adding radiation band.");
+        }
+    }
+    
+    PYHELIOS_API void addCPURadiationBandWithWavelengths(pyhelios::CPURadiationModel* radiation_model, const char* label, float wavelength_min, float wavelength_max) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label is null");
+                return;
+            }
+            radiation_model->addBand(std::string(label), wavelength_min, wavelength_max);
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::addRadiationBand): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::addRadiationBand): Unknown error adding radiation band.");
+        }
+    }
+
+    PYHELIOS_API void copyCPURadiationBand(pyhelios::CPURadiationModel* radiation_model, const char* old_label, const char* new_label) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!old_label || !new_label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label is null");
+                return;
+            }
+            radiation_model->copyBand(std::string(old_label), std::string(new_label));
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::copyRadiationBand): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::copyRadiationBand): Unknown error copying radiation band.");
+        }
+    }
+    
+    PYHELIOS_API unsigned int addCPUCollimatedRadiationSource(pyhelios::CPURadiationModel* radiation_model, float x, float y, float z) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return 0;
+            }
+            requireNoActiveJob(radiation_model);
+            return radiation_model->addCollimatedSource(helios::make_vec3(x, y, z));
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::addCollimatedRadiationSource): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::addCollimatedRadiationSource): Unknown error adding collimated radiation source.");
+            return 0;
+        }
+    }
+    
+    PYHELIOS_API unsigned int addCPUSphereRadiationSource(pyhelios::CPURadiationModel* radiation_model, float x, float y, float z, float radius) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return 0;
+            }
+            requireNoActiveJob(radiation_model);
+            return radiation_model->addSphereSource(helios::make_vec3(x, y, z), radius);
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::addSphereRadiationSource): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::addSphereRadiationSource): Unknown error adding sphere radiation source.");
+            return 0;
+        }
+    }
+    
+    PYHELIOS_API unsigned int addCPUSunSphereRadiationSource(pyhelios::CPURadiationModel* radiation_model, float zenith, float azimuth, float angular_width, float flux_scaling) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return 0;
+            }
+            requireNoActiveJob(radiation_model);
+            return radiation_model->addSunSphereSource(zenith, azimuth, angular_width, flux_scaling);
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::addSunSphereRadiationSource): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::addSunSphereRadiationSource): Unknown error adding sun sphere radiation source.");
+            return 0;
+        }
+    }
+    
+    PYHELIOS_API void setCPUSourceFlux(pyhelios::CPURadiationModel* radiation_model, unsigned int source_id, const char* label, float flux) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label is null");
+                return;
+            }
+            radiation_model->setSourceFlux(source_id, std::string(label), flux);
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::setSourceFlux): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::setSourceFlux): Unknown error setting source flux.");
+        }
+    }
+    
+    PYHELIOS_API void setCPUSourceFluxMultiple(pyhelios::CPURadiationModel* radiation_model, const unsigned int* source_ids, size_t count, const char* label, float flux) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label is null");
+                return;
+            }
+            if (!source_ids && count > 0) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Source ID array is null");
+                return;
+            }
+            for (size_t i = 0; i < count; i++) {
+                radiation_model->setSourceFlux(source_ids[i], std::string(label), flux);
+            }
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::setSourceFlux): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::setSourceFlux): Unknown error setting source flux for multiple sources.");
+        }
+    }
+    
+    PYHELIOS_API float getCPUSourceFlux(pyhelios::CPURadiationModel* radiation_model, unsigned int source_id, const char* label) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return 0.0f;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label is null");
+                return 0.0f;
+            }
+            return radiation_model->getSourceFlux(source_id, std::string(label));
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::getSourceFlux): ") + e.what());
+            return 0.0f;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::getSourceFlux): Unknown error getting source flux.");
+            return 0.0f;
+        }
+    }
+    
+    PYHELIOS_API void setCPUSourceSpectrum(pyhelios::CPURadiationModel* radiation_model, unsigned int source_id, const char* spectrum_label) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!spectrum_label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label is null");
+                return;
+            }
+            radiation_model->setSourceSpectrum(source_id, std::string(spectrum_label));
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::setSourceSpectrum): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::setSourceSpectrum): Unknown error setting source spectrum.");
+        }
+    }
+
+    PYHELIOS_API void setCPUDiffuseRadiationFlux(pyhelios::CPURadiationModel* radiation_model, const char* label, float flux) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label is null");
+                return;
+            }
+            radiation_model->setDiffuseFlux(std::string(label), flux);
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::setDiffuseRadiationFlux): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::setDiffuseRadiationFlux): Unknown error setting diffuse radiation flux.");
+        }
+    }
+    
+    PYHELIOS_API void setCPUDirectRayCount(pyhelios::CPURadiationModel* radiation_model, const char* label, size_t count) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label is null");
+                return;
+            }
+            radiation_model->getBand(std::string(label)).direct_ray_count = count;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::setDirectRayCount): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::setDirectRayCount): Unknown error setting direct ray count.");
+        }
+    }
+    
+    PYHELIOS_API void setCPUDiffuseRayCount(pyhelios::CPURadiationModel* radiation_model, const char* label, size_t count) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label is null");
+                return;
+            }
+            radiation_model->getBand(std::string(label)).diffuse_ray_count = count;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::setDiffuseRayCount): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::setDiffuseRayCount): Unknown error setting diffuse ray count.");
+        }
+    }
+    
+    PYHELIOS_API void setCPUScatteringDepth(pyhelios::CPURadiationModel* radiation_model, const char* label, unsigned int depth) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label is null");
+                return;
+            }
+            radiation_model->getBand(std::string(label)).scattering_depth = depth;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::setScatteringDepth): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::setScatteringDepth): Unknown error setting scattering depth.");
+        }
+    }
+    
+    PYHELIOS_API void setCPUMinScatterEnergy(pyhelios::CPURadiationModel* radiation_model, const char* label, float energy) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label is null");
+                return;
+            }
+            radiation_model->getBand(std::string(label)).min_scatter_energy = energy;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::setMinScatterEnergy): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::setMinScatterEnergy): Unknown error setting minimum scatter energy.");
+        }
+    }
+    
+    PYHELIOS_API void enforceCPUPeriodicBoundary(pyhelios::CPURadiationModel* radiation_model, const char* boundary) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!boundary) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Boundary is null");
+                return;
+            }
+            radiation_model->enforcePeriodicBoundary(std::string(boundary));
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::enforcePeriodicBoundary): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::enforcePeriodicBoundary): Unknown error enforcing periodic boundary.");
+        }
+    }
+    
+    PYHELIOS_API void setCPUScatteringTolerance(pyhelios::CPURadiationModel* radiation_model, const char* label, float tolerance) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label is null");
+                return;
+            }
+            if (tolerance < 0.f) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Scattering tolerance must be non-negative");
+                return;
+            }
+            radiation_model->getBand(std::string(label)).scattering_tolerance = tolerance;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::setScatteringTolerance): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::setScatteringTolerance): Unknown error setting scattering tolerance.");
+        }
+    }
+    
+    PYHELIOS_API void disableCPUEmission(pyhelios::CPURadiationModel* radiation_model, const char* label) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label is null");
+                return;
+            }
+            radiation_model->getBand(std::string(label)).emission = false;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::disableEmission): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::disableEmission): Unknown error disabling emission.");
+        }
+    }
+    
+    PYHELIOS_API void enableCPUEmission(pyhelios::CPURadiationModel* radiation_model, const char* label) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label is null");
+                return;
+            }
+            radiation_model->getBand(std::string(label)).emission = true;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::enableEmission): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::enableEmission): Unknown error enabling emission.");
+        }
+    }
+    
+    PYHELIOS_API void enableCPUFluxSuperposition(pyhelios::CPURadiationModel* radiation_model) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            radiation_model->setFluxSuperposition(true);
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::enableFluxSuperposition): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::enableFluxSuperposition): Unknown error enabling flux superposition.");
+        }
+    }
+    
+    PYHELIOS_API void disableCPUFluxSuperposition(pyhelios::CPURadiationModel* radiation_model) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            radiation_model->setFluxSuperposition(false);
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::disableFluxSuperposition): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::disableFluxSuperposition): Unknown error disabling flux superposition.");
+        }
+    }
+    
+    PYHELIOS_API void enableCPUViewFactorOperator(pyhelios::CPURadiationModel* radiation_model, float tolerance, size_t max_bytes) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            radiation_model->enableViewFactorOperator(tolerance, max_bytes);
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::enableViewFactorOperator): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::enableViewFactorOperator): Unknown error enabling view factor operator.");
+        }
+    }
+    
+    PYHELIOS_API void disableCPUViewFactorOperator(pyhelios::CPURadiationModel* radiation_model) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            radiation_model->disableViewFactorOperator();
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::disableViewFactorOperator): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::disableViewFactorOperator): Unknown error disabling view factor operator.");
+        }
+    }
+    
+    PYHELIOS_API size_t getCPUViewFactorOperatorBytes(pyhelios::CPURadiationModel* radiation_model) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return 0;
+            }
+            requireNoActiveJob(radiation_model);
+            return radiation_model->getViewFactorOperatorBytes();
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::getViewFactorOperatorBytes): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::getViewFactorOperatorBytes): Unknown error getting view factor operator size.");
+            return 0;
+        }
+    }
+    
+    PYHELIOS_API size_t getCPUViewFactorOperatorNonzeros(pyhelios::CPURadiationModel* radiation_model) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return 0;
+            }
+            requireNoActiveJob(radiation_model);
+            return radiation_model->getViewFactorOperatorNonzeros();
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::getViewFactorOperatorNonzeros): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::getViewFactorOperatorNonzeros): Unknown error getting view factor operator size.");
+            return 0;
+        }
+    }
+    
+    PYHELIOS_API void precomputeCPUSunlitFractions(pyhelios::CPURadiationModel* radiation_model, const float* directions, size_t direction_count,
+                                                   size_t ray_count, float max_angle) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!directions && direction_count > 0) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Direction array is null");
+                return;
+            }
+            std::vector<helios::vec3> direction_vector;
+            direction_vector.reserve(direction_count);
+            for (size_t i = 0; i < direction_count; i++) {
+                direction_vector.emplace_back(directions[3 * i], directions[3 * i + 1], directions[3 * i + 2]);
+            }
+            radiation_model->precomputeSunlitFractions(direction_vector, ray_count, max_angle);
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::precomputeSunlitFractions): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::precomputeSunlitFractions): Unknown error precomputing sunlit fractions.");
+        }
+    }
+    
+    PYHELIOS_API void clearCPUSunlitFractions(pyhelios::CPURadiationModel* radiation_model) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            radiation_model->clearSunlitFractions();
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::clearSunlitFractions): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::clearSunlitFractions): Unknown error clearing sunlit fractions.");
+        }
+    }
+    
+    PYHELIOS_API size_t getCPUSunlitFractionBytes(pyhelios::CPURadiationModel* radiation_model) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return 0;
+            }
+            requireNoActiveJob(radiation_model);
+            return radiation_model->getSunlitFractionBytes();
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::getSunlitFractionBytes): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::getSunlitFractionBytes): Unknown error getting sunlit fraction cache size.");
+            return 0;
+        }
+    }
+    
+    PYHELIOS_API void setCPUAdaptiveRayCount(pyhelios::CPURadiationModel* radiation_model, const char* label, float target_error, size_t max_ray_count) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label is null");
+                return;
+            }
+            if (target_error < 0.f) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Target error must be non-negative");
+                return;
+            }
+            if (target_error > 0.f && max_ray_count == 0) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Ray budget must be positive for adaptive ray counts");
+                return;
+            }
+            pyhelios::CPURadiationBand& band = radiation_model->getBand(std::string(label));
+            band.target_error = target_error;
+            band.max_ray_count = max_ray_count;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::setAdaptiveRayCount): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::setAdaptiveRayCount): Unknown error setting adaptive ray count.");
+        }
+    }
+    
+    PYHELIOS_API void updateCPURadiationGeometry(pyhelios::CPURadiationModel* radiation_model) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            radiation_model->updateGeometry();
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::updateGeometry): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::updateGeometry): Unknown error updating geometry.");
+        }
+    }
+    
+    PYHELIOS_API void updateCPURadiationGeometryUUIDs(pyhelios::CPURadiationModel* radiation_model, const unsigned int* uuids, size_t count) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!uuids && count > 0) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "UUID array is null");
+                return;
+            }
+            std::vector<uint> uuid_vector(uuids, uuids + count);
+            radiation_model->updateGeometry(uuid_vector);
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::updateGeometry): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::updateGeometry): Unknown error updating geometry with UUIDs.");
+        }
+    }
+    
+    PYHELIOS_API size_t updateCPURadiationGeometryDirty(pyhelios::CPURadiationModel* radiation_model) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return 0;
+            }
+            requireNoActiveJob(radiation_model);
+            return radiation_model->updateGeometryDirty();
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::updateGeometry): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::updateGeometry): Unknown error updating dirty geometry.");
+            return 0;
+        }
+    }
+    
+    PYHELIOS_API void runCPURadiationBand(pyhelios::CPURadiationModel* radiation_model, const char* label) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label is null");
+                return;
+            }
+            radiation_model->runBands(std::vector<std::string>{std::string(label)});
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::runBand): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::runBand): Unknown error running radiation band.");
+        }
+    }
+    
+    PYHELIOS_API void runCPURadiationBandMultiple(pyhelios::CPURadiationModel* radiation_model, const char** labels, size_t count) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!labels || count == 0) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label array is null or empty");
+                return;
+            }
+            std::vector<std::string> label_vector;
+            label_vector.reserve(count);
+            for (size_t i = 0; i < count; i++) {
+                if (!labels[i]) {
+                    setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label " + std::to_string(i) + " is null");
+                    return;
+                }
+                label_vector.emplace_back(labels[i]);
+            }
+            radiation_model->runBands(label_vector);
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::runBand): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::runBand): Unknown error running multiple radiation bands.");
+        }
+    }
+    
+    PYHELIOS_API CPURadiationJob* runCPURadiationBandAsync(pyhelios::CPURadiationModel* radiation_model, const char** labels, size_t count) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return nullptr;
+            }
+            if (!labels || count == 0) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label array is null or empty");
+                return nullptr;
+            }
+            std::vector<std::string> label_vector;
+            for (size_t i = 0; i < count; i++) {
+                if (!labels[i]) {
+                    setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label " + std::to_string(i) + " is null");
+                    return nullptr;
+                }
+                label_vector.emplace_back(labels[i]);
+            }
+            CPURadiationJob* job = new CPURadiationJob();
+            job->model = radiation_model;
+            {
+                std::lock_guard<std::mutex> lock(running_jobs_mutex);
+                if (running_jobs.count(radiation_model)) {
+                    delete job;
+                    setError(PYHELIOS_ERROR_RUNTIME, "ERROR (CPURadiationModel::runBandAsync): A radiation run is already in progress for this model; wait for it first");
+                    return nullptr;
+                }
+                running_jobs[radiation_model] = job;
+            }
+
+            // The worker traces prepared inputs only; the Context stays with the calling thread
+            auto run = [job]() {
+                int error_code = PYHELIOS_SUCCESS;
+                std::string error_message;
+                try {
+                    job->model->traceRun(*job->run);
+                } catch (const std::exception& e) {
+                    error_code = PYHELIOS_ERROR_RUNTIME;
+                    error_message = std::string("ERROR (CPURadiationModel::runBand): ") + e.what();
+                } catch (...) {
+                    error_code = PYHELIOS_ERROR_UNKNOWN;
+                    error_message = "ERROR (CPURadiationModel::runBand): Unknown error running multiple radiation bands.";
+                }
+                job->model->setRunMonitor(nullptr);
+                std::lock_guard<std::mutex> lock(job->mutex);
+                job->error_code = error_code;
+                job->error_message = error_message;
+                job->finished = true;
+                job->finished_condition.notify_all();
+            };
+            try {
+                job->run = radiation_model->prepareRun(label_vector);
+                radiation_model->setRunMonitor(&job->monitor);
+                job->worker = std::thread(run);
+            } catch (...) {
+                radiation_model->setRunMonitor(nullptr);
+                {
+                    std::lock_guard<std::mutex> lock(running_jobs_mutex);
+                    running_jobs.erase(radiation_model);
+                }
+                delete job;
+                throw;
+            }
+            return job;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::runBandAsync): ") + e.what());
+            return nullptr;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::runBandAsync): Unknown error starting radiation run.");
+            return nullptr;
+        }
+    }
+
+    PYHELIOS_API int pollCPURadiationJob(CPURadiationJob* job) {
+        try {
+            clearError();
+            if (!job) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationJob pointer is null");
+                return 0;
+            }
+            std::lock_guard<std::mutex> lock(job->mutex);
+            return job->finished ? 1 : 0;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::pollJob): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::pollJob): Unknown error polling radiation run.");
+            return 0;
+        }
+    }
+
+    PYHELIOS_API int waitCPURadiationJob(CPURadiationJob* job, double timeout_seconds) {
+        try {
+            clearError();
+            if (!job) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationJob pointer is null");
+                return 0;
+            }
+            if (!waitForJob(job, timeout_seconds)) {
+                return 0;
+            }
+            std::lock_guard<std::mutex> lock(job->mutex);
+            // The first wait writes the traced bands into the Context on the calling thread
+            if (pyhelios::CPURadiationModel* model = releaseJobModel(job)) {
+                model->writeRunFluxData(*job->run);
+            }
+            if (job->error_code != PYHELIOS_SUCCESS) {
+                setError(job->error_code, job->error_message);
+            }
+            return 1;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::waitJob): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::waitJob): Unknown error waiting for radiation run.");
+            return 0;
+        }
+    }
+
+    PYHELIOS_API float getCPURadiationJobProgress(CPURadiationJob* job) {
+        try {
+            clearError();
+            if (!job) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationJob pointer is null");
+                return 0.0f;
+            }
+            return job->monitor.progress;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::getJobProgress): ") + e.what());
+            return 0.0f;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::getJobProgress): Unknown error getting radiation run progress.");
+            return 0.0f;
+        }
+    }
+
+    PYHELIOS_API void cancelCPURadiationJob(CPURadiationJob* job) {
+        try {
+            clearError();
+            if (!job) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationJob pointer is null");
+                return;
+            }
+            job->monitor.cancel = true;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::cancelJob): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::cancelJob): Unknown error cancelling radiation run.");
+        }
+    }
+
+    PYHELIOS_API void destroyCPURadiationJob(CPURadiationJob* job) {
+        try {
+            clearError();
+            if (!job) {
+                return;
+            }
+            job->monitor.cancel = true;
+            if (job->worker.joinable()) {
+                job->worker.join();
+            }
+            {
+                // Results never waited for stay in the model but are not written into the Context
+                std::lock_guard<std::mutex> lock(job->mutex);
+                releaseJobModel(job);
+            }
+            delete job;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::destroyJob): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::destroyJob): Unknown error destroying radiation run.");
+        }
+    }
+
+    PYHELIOS_API size_t getCPURadiationBandStats(pyhelios::CPURadiationModel* radiation_model, const char* label, float* out, size_t capacity) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return 0;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label is null");
+                return 0;
+            }
+            const pyhelios::CPURadiationBandStats& stats = radiation_model->getBandStats(std::string(label));
+            const float values[] = {
+                static_cast<float>(stats.rounds),
+                static_cast<float>(stats.direct_rays),
+                static_cast<float>(stats.diffuse_rays),
+                stats.relative_error,
+                static_cast<float>(stats.scattering_passes),
+                stats.scattering_residual
+            };
+            const size_t count = sizeof(values) / sizeof(values[0]);
+            if (out && capacity >= count) {
+                std::copy(values, values + count, out);
+            }
+            return count;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::getBandStats): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::getBandStats): Unknown error getting band statistics.");
+            return 0;
+        }
+    }
+    
+    PYHELIOS_API size_t getCPUTotalAbsorbedFluxToBuffer(pyhelios::CPURadiationModel* radiation_model, float* out, size_t capacity) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return 0;
+            }
+            requireNoActiveJob(radiation_model);
+            std::vector<float> flux_data = radiation_model->getTotalAbsorbedFlux();
+            if (out && capacity >= flux_data.size()) {
+                std::copy(flux_data.begin(), flux_data.end(), out);
+            }
+            return flux_data.size();
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::getTotalAbsorbedFlux): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::getTotalAbsorbedFlux): Unknown error getting absorbed flux.");
+            return 0;
+        }
+    }
+    
+    PYHELIOS_API size_t getCPUAbsorbedFluxBands(pyhelios::CPURadiationModel* radiation_model,
+                                                const char** band_labels, size_t band_count,
+                                                float* out, size_t capacity) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return 0;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!band_labels || band_count == 0) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Band label array is null or empty");
+                return 0;
+            }
+            const size_t primitive_count = radiation_model->getContext()->getAllUUIDs().size();
+
+            // Size query, or buffer too small: report the number of primitives per band
+            if (!out || capacity < band_count * primitive_count) {
+                return primitive_count;
+            }
+
+            for (size_t b = 0; b < band_count; b++) {
+                if (!band_labels[b]) {
+                    setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Band label " + std::to_string(b) + " is null");
+                    return 0;
+                }
+                std::vector<float> flux = radiation_model->getAbsorbedFlux(band_labels[b]);
+                std::copy(flux.begin(), flux.end(), out + b * primitive_count);
+            }
+            return primitive_count;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::getAbsorbedFluxBands): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::getAbsorbedFluxBands): Unknown error getting per-band absorbed flux.");
+            return 0;
+        }
+    }
+
+    PYHELIOS_API void aggregateCPUAbsorbedFlux(pyhelios::CPURadiationModel* radiation_model, const char* label, const unsigned int* uuids, const unsigned int* groups,
+                                               size_t count, size_t group_count, double* power, double* area) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!label || (count > 0 && (!uuids || !groups)) || (group_count > 0 && (!power || !area))) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Required parameters are null");
+                return;
+            }
+            std::vector<uint> uuid_vector(uuids, uuids + count);
+            std::vector<uint> group_vector(groups, groups + count);
+            std::vector<double> power_sum, area_sum;
+            radiation_model->aggregateAbsorbedFlux(label, uuid_vector, group_vector, group_count, power_sum, area_sum);
+            std::copy(power_sum.begin(), power_sum.end(), power);
+            std::copy(area_sum.begin(), area_sum.end(), area);
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::aggregateAbsorbedFlux): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::aggregateAbsorbedFlux): Unknown error aggregating absorbed flux.");
+        }
+    }
+
+    PYHELIOS_API size_t aggregateCPUAbsorbedFluxByObject(pyhelios::CPURadiationModel* radiation_model, const char* label, unsigned int* object_ids,
+                                                         double* power, double* area, size_t capacity) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return 0;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Required parameters are null");
+                return 0;
+            }
+            std::vector<uint> ids;
+            std::vector<double> power_sum, area_sum;
+            radiation_model->aggregateAbsorbedFluxByObject(label, ids, power_sum, area_sum);
+            if (object_ids && power && area && capacity >= ids.size()) {
+                std::copy(ids.begin(), ids.end(), object_ids);
+                std::copy(power_sum.begin(), power_sum.end(), power);
+                std::copy(area_sum.begin(), area_sum.end(), area);
+            }
+            return ids.size();
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::aggregateAbsorbedFluxByObject): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::aggregateAbsorbedFluxByObject): Unknown error aggregating absorbed flux.");
+            return 0;
+        }
+    }
+
+    PYHELIOS_API void addCPURadiationCameraVec3(pyhelios::CPURadiationModel* radiation_model, const char* camera_label,
+                                                const char** band_labels, size_t band_count,
+                                                float position_x, float position_y, float position_z,
+                                                float lookat_x, float lookat_y, float lookat_z,
+                                                const float* camera_properties, unsigned int antialiasing_samples) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!camera_label || !band_labels || !camera_properties) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Required parameters are null");
+                return;
+            }
+            helios::vec3 position(position_x, position_y, position_z);
+            helios::vec3 lookat(lookat_x, lookat_y, lookat_z);
+            radiation_model->addCamera(camera_label, makeCPUCamera(band_labels, band_count, position, lookat, camera_properties, antialiasing_samples));
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::addRadiationCamera): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::addRadiationCamera): Unknown error adding radiation camera.");
+        }
+    }
+
+    PYHELIOS_API void addCPURadiationCameraSpherical(pyhelios::CPURadiationModel* radiation_model, const char* camera_label,
+                                                     const char** band_labels, size_t band_count,
+                                                     float position_x, float position_y, float position_z,
+                                                     float radius, float elevation, float azimuth,
+                                                     const float* camera_properties, unsigned int antialiasing_samples) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!camera_label || !band_labels || !camera_properties) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Required parameters are null");
+                return;
+            }
+            // Viewing direction as in helios::sphere2cart, with a unit radius if none is given
+            const float distance = radius > 0.f ? radius : 1.f;
+            helios::vec3 position(position_x, position_y, position_z);
+            helios::vec3 direction(std::cos(elevation) * std::sin(azimuth), std::cos(elevation) * std::cos(azimuth), std::sin(elevation));
+            radiation_model->addCamera(camera_label, makeCPUCamera(band_labels, band_count, position, position + direction * distance, camera_properties, antialiasing_samples));
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::addRadiationCamera): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::addRadiationCamera): Unknown error adding radiation camera.");
+        }
+    }
+
+    PYHELIOS_API void renderCPURadiationCameras(pyhelios::CPURadiationModel* radiation_model, const char** camera_labels, size_t count) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!camera_labels && count > 0) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Camera label array is null");
+                return;
+            }
+            std::vector<std::string> label_vector;
+            label_vector.reserve(count);
+            for (size_t i = 0; i < count; i++) {
+                if (!camera_labels[i]) {
+                    setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Camera label " + std::to_string(i) + " is null");
+                    return;
+                }
+                label_vector.emplace_back(camera_labels[i]);
+            }
+            radiation_model->renderCameras(label_vector);
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::renderCameras): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::renderCameras): Unknown error rendering radiation cameras.");
+        }
+    }
+
+    PYHELIOS_API void setCPUCameraTiledOnly(pyhelios::CPURadiationModel* radiation_model, const char* camera, int tiled_only) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!camera) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Camera label is null");
+                return;
+            }
+            radiation_model->setCameraTiledOnly(camera, tiled_only != 0);
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::setCameraTiledOnly): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::setCameraTiledOnly): Unknown error setting camera rendering mode.");
+        }
+    }
+
+    PYHELIOS_API size_t getCPUCameraImageBuffer(pyhelios::CPURadiationModel* radiation_model, const char* camera, const char* band,
+                                                float* out, size_t capacity, int* width, int* height) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return 0;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!camera || !band) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Required parameters are null");
+                return 0;
+            }
+            const pyhelios::CPURadiationCamera& stored = radiation_model->getCamera(camera);
+            const std::vector<float>& pixels = radiation_model->getCameraPixelData(camera, band);
+            if (width) *width = static_cast<int>(stored.width);
+            if (height) *height = static_cast<int>(stored.height);
+            if (out && capacity >= pixels.size()) {
+                std::copy(pixels.begin(), pixels.end(), out);
+            }
+            return pixels.size();
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::getCameraImageBuffer): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::getCameraImageBuffer): Unknown error getting camera image.");
+            return 0;
+        }
+    }
+
+    PYHELIOS_API void renderCPUCameraTiles(pyhelios::CPURadiationModel* radiation_model, const char* camera,
+                                           unsigned int tile_width, unsigned int tile_height,
+                                           CPUCameraTileCallback callback, void* user_data) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "CPURadiationModel pointer is null");
+                return;
+            }
+            requireNoActiveJob(radiation_model);
+            if (!camera || !callback) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Required parameters are null");
+                return;
+            }
+            radiation_model->renderCameraTiles(camera, tile_width, tile_height,
+                [&](const std::string& band, uint x0, uint y0, uint width, uint height, const float* pixels) {
+                    if (callback(user_data, band.c_str(), int(x0), int(y0), int(width), int(height), pixels) != 0) {
+                        throw std::runtime_error("Tile callback stopped rendering");
+                    }
+                });
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (CPURadiationModel::renderCameraTiles): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (CPURadiationModel::renderCameraTiles): Unknown error rendering camera tiles.");
+        }
+    }
+
+} //extern "C"
@@ -102,7 +102,7 @@ extern "C" {
 
             std::vector<uint> plantIDs = plantarch->buildPlantCanopyFromLibrary(center, spacing, count, age);
 
-            // Convert vector to static array for return
+            // Convert vector to thread-local static array for return
             static thread_local std::vector<unsigned int> static_result;
             static_result = plantIDs;
             *plant_ids = static_result.data();
@@ -195,7 +195,7 @@ extern "C" {
 
             std::vector<uint> objectIDs = plantarch->getAllPlantObjectIDs(plantID);
 
-            // Convert vector to static array for return
+            // Convert vector to thread-local static array for return
             static thread_local std::vector<unsigned int> static_result;
             static_result = objectIDs;
             *count = static_result.size();
@@ -227,7 +227,7 @@ extern "C" {
 
             std::vector<uint> uuids = plantarch->getAllPlantUUIDs(plantID);
 
-            // Convert vector to static array for return
+            // Convert vector to thread-local static array for return
             static thread_local std::vector<unsigned int> static_result;
             static_result = uuids;
             *count = static_result.size();
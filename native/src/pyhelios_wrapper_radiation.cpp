@@ -3,9 +3,15 @@
 
 #include "../include/pyhelios_wrapper_common.h"
 #include "../include/pyhelios_wrapper_context.h"
+#include "../include/pyhelios_geometry_cache.h"
 #include "Context.h"
 #include <string>
 #include <exception>
+#include <stdexcept>
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <unordered_map>
 
 #ifdef RADIATION_PLUGIN_AVAILABLE
 #include "../include/pyhelios_wrapper_radiation.h"
@@ -18,6 +24,194 @@ enum class ColorCorrectionAlgorithm {
     MATRIX_3X3_FORCE = 2      //!< Force 3x3 matrix calculation even if potentially unstable
 };
 
+namespace {
+
+    // RadiationModel does not expose its Context, so the wrapper records it at creation time
+    // along with the primitive scope last passed to updateGeometry (empty = whole Context)
+    struct RadiationGeometryState {
+        helios::Context* context = nullptr;
+        bool subset = false;
+        std::vector<uint> scope;
+        std::unordered_map<std::string, helios::int2> camera_resolutions;  //!< Recorded by addRadiationCamera*
+    };
+
+    std::mutex radiation_state_mutex;
+    std::unordered_map<const RadiationModel*, RadiationGeometryState> radiation_states;
+
+    RadiationGeometryState getRadiationGeometryState(const RadiationModel* radiation_model) {
+        std::lock_guard<std::mutex> lock(radiation_state_mutex);
+        auto it = radiation_states.find(radiation_model);
+        return it != radiation_states.end() ? it->second : RadiationGeometryState();
+    }
+
+    void setRadiationGeometryScope(const RadiationModel* radiation_model, bool subset, const std::vector<uint>& scope) {
+        std::lock_guard<std::mutex> lock(radiation_state_mutex);
+        auto it = radiation_states.find(radiation_model);
+        if (it != radiation_states.end()) {
+            it->second.subset = subset;
+            it->second.scope = scope;
+            std::sort(it->second.scope.begin(), it->second.scope.end());
+        }
+    }
+
+    void setCameraResolution(const RadiationModel* radiation_model, const std::string& camera, const helios::int2& resolution) {
+        std::lock_guard<std::mutex> lock(radiation_state_mutex);
+        auto it = radiation_states.find(radiation_model);
+        if (it != radiation_states.end()) {
+            it->second.camera_resolutions[camera] = resolution;
+        }
+    }
+
+    // Resolution recorded when the camera was added; throws if the camera is unknown
+    helios::int2 getCameraResolution(const RadiationModel* radiation_model, const std::string& camera) {
+        std::lock_guard<std::mutex> lock(radiation_state_mutex);
+        auto state = radiation_states.find(radiation_model);
+        if (state == radiation_states.end() || !state->second.camera_resolutions.count(camera)) {
+            throw std::runtime_error("Camera '" + camera + "' does not exist");
+        }
+        return state->second.camera_resolutions.at(camera);
+    }
+
+    // Pixel data of one camera band, row-major with x fastest; throws if the camera is unknown or has not been rendered
+    std::vector<float> readCameraBand(RadiationModel* radiation_model, const std::string& camera, const std::string& band, helios::int2& resolution) {
+        resolution = getCameraResolution(radiation_model, camera);
+        std::vector<float> pixels = radiation_model->getCameraPixelData(camera, band);
+        if (pixels.size() != size_t(resolution.x) * size_t(resolution.y)) {
+            throw std::runtime_error("Camera '" + camera + "' has no pixel data for band '" + band + "'. Run the band with the camera first.");
+        }
+        return pixels;
+    }
+
+    // Interleaved RGB composite scaled to [0, 1], as written by writeCameraImage / writeNormCameraImage
+    std::vector<float> composeCameraRGB(RadiationModel* radiation_model, const std::string& camera, const char* const bands[3],
+                                        float flux_to_pixel_conversion, bool normalize, helios::int2& resolution) {
+        std::vector<float> channels[3];
+        for (int c = 0; c < 3; ++c) {
+            channels[c] = readCameraBand(radiation_model, camera, std::string(bands[c]), resolution);
+        }
+        float scale = flux_to_pixel_conversion;
+        if (normalize) {
+            float max_value = 0.f;
+            for (const std::vector<float>& channel : channels) {
+                for (float v : channel) {
+                    max_value = std::max(max_value, v);
+                }
+            }
+            scale = max_value > 0.f ? 1.f / max_value : 0.f;
+        }
+        const size_t pixel_count = channels[0].size();
+        std::vector<float> rgb(3 * pixel_count);
+        for (size_t p = 0; p < pixel_count; ++p) {
+            for (int c = 0; c < 3; ++c) {
+                rgb[3 * p + c] = std::min(1.f, std::max(0.f, channels[c][p] * scale));
+            }
+        }
+        return rgb;
+    }
+
+    //! Per-pixel instance labels of a camera frame, as read from primitive or object data
+    struct CameraInstanceMap {
+        helios::int2 resolution;
+        std::vector<uint> values;       //!< Data value of each instance, ascending
+        std::vector<uint> pixel_index;  //!< Index into values for each pixel, NO_INSTANCE for background
+    };
+
+    const uint NO_INSTANCE = 0xFFFFFFFFu;
+
+    // Reads an int or uint data label on the primitive (or its parent object) seen by each camera pixel.
+    // The plugin stores the seen primitive per pixel in global data "camera_<label>_pixel_UUID" as UUID+1 (0 = sky).
+    CameraInstanceMap readCameraInstances(RadiationModel* radiation_model, const std::string& camera, const std::string& data_label, bool object_data) {
+        RadiationGeometryState state = getRadiationGeometryState(radiation_model);
+        if (!state.camera_resolutions.count(camera)) {
+            throw std::runtime_error("Camera '" + camera + "' does not exist");
+        }
+        helios::Context* context = state.context;
+        CameraInstanceMap map;
+        map.resolution = state.camera_resolutions.at(camera);
+
+        const std::string pixel_label = "camera_" + camera + "_pixel_UUID";
+        std::vector<uint> pixel_UUIDs;
+        if (context->doesGlobalDataExist(pixel_label.c_str())) {
+            context->getGlobalData(pixel_label.c_str(), pixel_UUIDs);
+        }
+        const size_t pixel_count = size_t(map.resolution.x) * size_t(map.resolution.y);
+        if (pixel_UUIDs.size() != pixel_count) {
+            throw std::runtime_error("Camera '" + camera + "' has no pixel labels. Run a band with the camera first.");
+        }
+
+        const helios::HeliosDataType data_type = object_data ? context->getObjectDataType(data_label.c_str()) : context->getPrimitiveDataType(data_label.c_str());
+        if (data_type != helios::HELIOS_TYPE_UINT && data_type != helios::HELIOS_TYPE_INT) {
+            throw std::runtime_error("Data '" + data_label + "' must be of type uint or int");
+        }
+
+        // Many pixels see the same primitive, so look up each UUID once; the lookup yields value+1 (0 = no data)
+        std::unordered_map<uint, uint64_t> lookup;
+        auto instanceValue = [&](uint UUID) -> uint64_t {
+            if (!context->doesPrimitiveExist(UUID)) {
+                return 0;
+            }
+            if (object_data) {
+                const uint objID = context->getPrimitiveParentObjectID(UUID);
+                if (objID == 0 || !context->doesObjectDataExist(objID, data_label.c_str())) {
+                    return 0;
+                }
+                if (data_type == helios::HELIOS_TYPE_UINT) {
+                    uint value;
+                    context->getObjectData(objID, data_label.c_str(), value);
+                    return uint64_t(value) + 1;
+                }
+                int value;
+                context->getObjectData(objID, data_label.c_str(), value);
+                return uint64_t(uint(value)) + 1;
+            }
+            if (!context->doesPrimitiveDataExist(UUID, data_label.c_str())) {
+                return 0;
+            }
+            if (data_type == helios::HELIOS_TYPE_UINT) {
+                uint value;
+                context->getPrimitiveData(UUID, data_label.c_str(), value);
+                return uint64_t(value) + 1;
+            }
+            int value;
+            context->getPrimitiveData(UUID, data_label.c_str(), value);
+            return uint64_t(uint(value)) + 1;
+        };
+
+        std::vector<uint64_t> pixel_values(pixel_count, 0);
+        for (size_t p = 0; p < pixel_count; ++p) {
+            if (pixel_UUIDs[p] == 0) {
+                continue;
+            }
+            auto it = lookup.find(pixel_UUIDs[p]);
+            if (it == lookup.end()) {
+                it = lookup.emplace(pixel_UUIDs[p], instanceValue(pixel_UUIDs[p] - 1)).first;
+            }
+            pixel_values[p] = it->second;
+        }
+
+        for (const auto& entry : lookup) {
+            if (entry.second != 0) {
+                map.values.push_back(uint(entry.second - 1));
+            }
+        }
+        std::sort(map.values.begin(), map.values.end());
+        map.values.erase(std::unique(map.values.begin(), map.values.end()), map.values.end());
+
+        std::unordered_map<uint, uint> value_index;
+        for (size_t i = 0; i < map.values.size(); ++i) {
+            value_index[map.values[i]] = uint(i);
+        }
+        map.pixel_index.assign(pixel_count, NO_INSTANCE);
+        for (size_t p = 0; p < pixel_count; ++p) {
+            if (pixel_values[p] != 0) {
+                map.pixel_index[p] = value_index.at(uint(pixel_values[p] - 1));
+            }
+        }
+        return map;
+    }
+
+} // namespace
+
 extern "C" {
     // RadiationModel C interface functions
     
@@ -28,7 +222,10 @@ extern "C" {
                 setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
                 return nullptr;
             }
-            return new RadiationModel(context);
+            RadiationModel* radiation_model = new RadiationModel(context);
+            std::lock_guard<std::mutex> lock(radiation_state_mutex);
+            radiation_states[radiation_model].context = context;
+            return radiation_model;
         } catch (const std::exception& e) {
             setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (RadiationModel::constructor): ") + e.what());
             return nullptr;
@@ -42,6 +239,14 @@ extern "C" {
         try {
             clearError();
             if (radiation_model != nullptr) {
+                RadiationGeometryState state = getRadiationGeometryState(radiation_model);
+                if (state.context) {
+                    pyhelios::releasePrimitiveObserver(state.context, radiation_model);
+                }
+                {
+                    std::lock_guard<std::mutex> lock(radiation_state_mutex);
+                    radiation_states.erase(radiation_model);
+                }
                 delete radiation_model;
             }
         } catch (const std::exception& e) {
@@ -344,6 +549,25 @@ extern "C" {
         }
     }
     
+    PYHELIOS_API void setSourceSpectrum(RadiationModel* radiation_model, unsigned int source_id, const char* spectrum_label) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "RadiationModel pointer is null");
+                return;
+            }
+            if (!spectrum_label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Label is null");
+                return;
+            }
+            radiation_model->setSourceSpectrum(source_id, std::string(spectrum_label));
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (RadiationModel::setSourceSpectrum): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (RadiationModel::setSourceSpectrum): Unknown error setting source spectrum.");
+        }
+    }
+
     PYHELIOS_API void setScatteringDepth(RadiationModel* radiation_model, const char* label, unsigned int depth) {
         try {
             clearError();
@@ -382,6 +606,25 @@ extern "C" {
         }
     }
     
+    PYHELIOS_API void enforcePeriodicBoundary(RadiationModel* radiation_model, const char* boundary) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "RadiationModel pointer is null");
+                return;
+            }
+            if (!boundary) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Boundary is null");
+                return;
+            }
+            radiation_model->enforcePeriodicBoundary(std::string(boundary));
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (RadiationModel::enforcePeriodicBoundary): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (RadiationModel::enforcePeriodicBoundary): Unknown error enforcing periodic boundary.");
+        }
+    }
+    
     PYHELIOS_API void disableEmission(RadiationModel* radiation_model, const char* label) {
         try {
             clearError();
@@ -428,6 +671,11 @@ extern "C" {
                 return;
             }
             radiation_model->updateGeometry();
+            setRadiationGeometryScope(radiation_model, false, {});
+            RadiationGeometryState state = getRadiationGeometryState(radiation_model);
+            if (state.context) {
+                pyhelios::getPrimitiveChanges(state.context, radiation_model, true);
+            }
         } catch (const std::exception& e) {
             setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (RadiationModel::updateGeometry): ") + e.what());
         } catch (...) {
@@ -448,6 +696,11 @@ extern "C" {
             }
             std::vector<unsigned int> uuid_vector(uuids, uuids + count);
             radiation_model->updateGeometry(uuid_vector);
+            setRadiationGeometryScope(radiation_model, true, uuid_vector);
+            RadiationGeometryState state = getRadiationGeometryState(radiation_model);
+            if (state.context) {
+                pyhelios::getPrimitiveChanges(state.context, radiation_model, true);
+            }
         } catch (const std::exception& e) {
             setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (RadiationModel::updateGeometry): ") + e.what());
         } catch (...) {
@@ -455,6 +708,63 @@ extern "C" {
         }
     }
     
+    PYHELIOS_API bool updateRadiationGeometryIfChanged(RadiationModel* radiation_model) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "RadiationModel pointer is null");
+                return false;
+            }
+            RadiationGeometryState state = getRadiationGeometryState(radiation_model);
+            if (!state.context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "RadiationModel was not created through createRadiationModel");
+                return false;
+            }
+
+            // One hash pass: the current geometry becomes the baseline of the update below
+            pyhelios::PrimitiveChangeSet changes = pyhelios::getPrimitiveChanges(state.context, radiation_model, true);
+
+            // Restrict to the primitives the model was last told to include
+            auto in_scope = [&](uint uuid) {
+                return !state.subset || std::binary_search(state.scope.begin(), state.scope.end(), uuid);
+            };
+            bool changed = !changes.has_baseline || (!state.subset && !changes.added.empty());
+            changed = changed || std::any_of(changes.modified.begin(), changes.modified.end(), in_scope);
+            changed = changed || std::any_of(changes.deleted.begin(), changes.deleted.end(), in_scope);
+            if (!changed) {
+                return false;
+            }
+
+            // The plugin cannot patch part of its scene: any change re-uploads the whole scope
+            try {
+                if (state.subset) {
+                    std::vector<uint> live_scope;
+                    live_scope.reserve(state.scope.size());
+                    for (uint uuid : state.scope) {
+                        if (!std::binary_search(changes.deleted.begin(), changes.deleted.end(), uuid)) {
+                            live_scope.push_back(uuid);
+                        }
+                    }
+                    radiation_model->updateGeometry(live_scope);
+                    setRadiationGeometryScope(radiation_model, true, live_scope);
+                } else {
+                    radiation_model->updateGeometry();
+                }
+            } catch (...) {
+                // The model was not updated, so the next call must not diff against the new baseline
+                pyhelios::releasePrimitiveObserver(state.context, radiation_model);
+                throw;
+            }
+            return true;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (RadiationModel::updateGeometry): ") + e.what());
+            return false;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (RadiationModel::updateGeometry): Unknown error updating changed geometry.");
+            return false;
+        }
+    }
+    
     PYHELIOS_API void runRadiationBand(RadiationModel* radiation_model, const char* label) {
         try {
             clearError();
@@ -514,8 +824,8 @@ extern "C" {
             
             std::vector<float> flux_data = radiation_model->getTotalAbsorbedFlux();
             
-            // Allocate static buffer for flux data
-            static std::vector<float> flux_buffer;
+            // Thread-local buffer for flux data so concurrent callers do not share storage
+            static thread_local std::vector<float> flux_buffer;
             flux_buffer = flux_data;
             *size = flux_buffer.size();
             return flux_buffer.data();
@@ -531,6 +841,196 @@ extern "C" {
         }
     }
 
+    // Absorbed flux readback into a caller-provided buffer (no intermediate wrapper-owned copy)
+    PYHELIOS_API size_t getTotalAbsorbedFluxToBuffer(RadiationModel* radiation_model, float* out, size_t capacity) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "RadiationModel pointer is null");
+                return 0;
+            }
+
+            std::vector<float> flux_data = radiation_model->getTotalAbsorbedFlux();
+            if (out && capacity >= flux_data.size()) {
+                std::copy(flux_data.begin(), flux_data.end(), out);
+            }
+            return flux_data.size();
+
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (RadiationModel::getTotalAbsorbedFlux): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (RadiationModel::getTotalAbsorbedFlux): Unknown error getting absorbed flux.");
+            return 0;
+        }
+    }
+
+    // Per-band absorbed flux as a row-major [band x primitive] array, read from the "radiation_flux_<band>" primitive data
+    PYHELIOS_API size_t getAbsorbedFluxBands(RadiationModel* radiation_model, helios::Context* context,
+                                             const char** band_labels, size_t band_count,
+                                             float* out, size_t capacity) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "RadiationModel pointer is null");
+                return 0;
+            }
+            if (!context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
+                return 0;
+            }
+            if (!band_labels || band_count == 0) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Band label array is null or empty");
+                return 0;
+            }
+
+            std::vector<unsigned int> uuids = context->getAllUUIDs();
+            const size_t primitive_count = uuids.size();
+
+            // Size query, or buffer too small: report the number of primitives per band
+            if (!out || capacity < band_count * primitive_count) {
+                return primitive_count;
+            }
+
+            for (size_t b = 0; b < band_count; b++) {
+                if (!band_labels[b]) {
+                    setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Band label " + std::to_string(b) + " is null");
+                    return 0;
+                }
+                if (!radiation_model->doesBandExist(band_labels[b])) {
+                    setError(PYHELIOS_ERROR_INVALID_PARAMETER, std::string("Radiation band '") + band_labels[b] + "' does not exist");
+                    return 0;
+                }
+
+                const std::string data_label = std::string("radiation_flux_") + band_labels[b];
+                float* row = out + b * primitive_count;
+                for (size_t i = 0; i < primitive_count; i++) {
+                    // Primitives that were not part of the last runBand() have no flux data
+                    if (context->doesPrimitiveDataExist(uuids[i], data_label.c_str())) {
+                        context->getPrimitiveData(uuids[i], data_label.c_str(), row[i]);
+                    } else {
+                        row[i] = 0.f;
+                    }
+                }
+            }
+
+            return primitive_count;
+
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (RadiationModel::getAbsorbedFluxBands): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (RadiationModel::getAbsorbedFluxBands): Unknown error getting per-band absorbed flux.");
+            return 0;
+        }
+    }
+
+    PYHELIOS_API void aggregateAbsorbedFlux(RadiationModel* radiation_model, helios::Context* context, const char* label, const unsigned int* uuids,
+                                            const unsigned int* groups, size_t count, size_t group_count, double* power, double* area) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "RadiationModel pointer is null");
+                return;
+            }
+            if (!context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
+                return;
+            }
+            if (!label || (count > 0 && (!uuids || !groups)) || (group_count > 0 && (!power || !area))) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Required parameters are null");
+                return;
+            }
+            if (!radiation_model->doesBandExist(label)) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, std::string("Radiation band '") + label + "' does not exist");
+                return;
+            }
+            for (size_t i = 0; i < count; i++) {
+                if (groups[i] >= group_count) {
+                    setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Group index " + std::to_string(groups[i]) + " of primitive " + std::to_string(uuids[i]) + " is out of range");
+                    return;
+                }
+            }
+
+            std::fill(power, power + group_count, 0.0);
+            std::fill(area, area + group_count, 0.0);
+            const std::string data_label = std::string("radiation_flux_") + label;
+            for (size_t i = 0; i < count; i++) {
+                // Primitives that were not part of the last runBand() have no flux data
+                if (!context->doesPrimitiveExist(uuids[i]) || !context->doesPrimitiveDataExist(uuids[i], data_label.c_str())) {
+                    continue;
+                }
+                float flux;
+                context->getPrimitiveData(uuids[i], data_label.c_str(), flux);
+                const float primitive_area = context->getPrimitiveArea(uuids[i]);
+                power[groups[i]] += double(flux) * primitive_area;
+                area[groups[i]] += primitive_area;
+            }
+
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (RadiationModel::aggregateAbsorbedFlux): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (RadiationModel::aggregateAbsorbedFlux): Unknown error aggregating absorbed flux.");
+        }
+    }
+
+    PYHELIOS_API size_t aggregateAbsorbedFluxByObject(RadiationModel* radiation_model, helios::Context* context, const char* label,
+                                                      unsigned int* object_ids, double* power, double* area, size_t capacity) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "RadiationModel pointer is null");
+                return 0;
+            }
+            if (!context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
+                return 0;
+            }
+            if (!label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Required parameters are null");
+                return 0;
+            }
+            if (!radiation_model->doesBandExist(label)) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, std::string("Radiation band '") + label + "' does not exist");
+                return 0;
+            }
+
+            // Objects in ascending ID order, each with the running sums of its primitives
+            std::map<unsigned int, std::pair<double, double>> sums;
+            const std::string data_label = std::string("radiation_flux_") + label;
+            for (unsigned int uuid : context->getAllUUIDs()) {
+                const unsigned int object_id = context->getPrimitiveParentObjectID(uuid);
+                if (object_id == 0 || !context->doesPrimitiveDataExist(uuid, data_label.c_str())) {
+                    continue;
+                }
+                float flux;
+                context->getPrimitiveData(uuid, data_label.c_str(), flux);
+                const float primitive_area = context->getPrimitiveArea(uuid);
+                std::pair<double, double>& sum = sums[object_id];
+                sum.first += double(flux) * primitive_area;
+                sum.second += primitive_area;
+            }
+
+            if (object_ids && power && area && capacity >= sums.size()) {
+                size_t i = 0;
+                for (const auto& entry : sums) {
+                    object_ids[i] = entry.first;
+                    power[i] = entry.second.first;
+                    area[i] = entry.second.second;
+                    i++;
+                }
+            }
+            return sums.size();
+
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (RadiationModel::aggregateAbsorbedFluxByObject): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (RadiationModel::aggregateAbsorbedFluxByObject): Unknown error aggregating absorbed flux.");
+            return 0;
+        }
+    }
+
     //=========================================================================
     // Camera and Image Functions (v1.3.47)
     //=========================================================================
@@ -641,6 +1141,235 @@ extern "C" {
         }
     }
 
+    PYHELIOS_API size_t getCameraImageBuffer(RadiationModel* radiation_model, const char* camera, const char* band,
+                                             float* out, size_t capacity, int* width, int* height) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "RadiationModel pointer is null");
+                return 0;
+            }
+            if (!camera || !band) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Required parameters are null");
+                return 0;
+            }
+
+            // Size queries are answered from the recorded resolution without reading the pixels
+            helios::int2 resolution = getCameraResolution(radiation_model, std::string(camera));
+            if (width) *width = resolution.x;
+            if (height) *height = resolution.y;
+            const size_t count = size_t(resolution.x) * size_t(resolution.y);
+            if (out && capacity >= count) {
+                std::vector<float> pixels = readCameraBand(radiation_model, std::string(camera), std::string(band), resolution);
+                std::copy(pixels.begin(), pixels.end(), out);
+            }
+            return count;
+
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (RadiationModel::getCameraImageBuffer): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (RadiationModel::getCameraImageBuffer): Unknown error getting camera image.");
+            return 0;
+        }
+    }
+
+    PYHELIOS_API size_t getCameraImageRGBBuffer(RadiationModel* radiation_model, const char* camera,
+                                                const char* red_band, const char* green_band, const char* blue_band,
+                                                float flux_to_pixel_conversion, int normalize,
+                                                float* out, size_t capacity, int* width, int* height) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "RadiationModel pointer is null");
+                return 0;
+            }
+            if (!camera || !red_band || !green_band || !blue_band) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Required parameters are null");
+                return 0;
+            }
+
+            const char* bands[3] = {red_band, green_band, blue_band};
+            helios::int2 resolution = getCameraResolution(radiation_model, std::string(camera));
+            if (width) *width = resolution.x;
+            if (height) *height = resolution.y;
+            const size_t count = 3 * size_t(resolution.x) * size_t(resolution.y);
+            if (out && capacity >= count) {
+                std::vector<float> rgb = composeCameraRGB(radiation_model, std::string(camera), bands, flux_to_pixel_conversion, normalize != 0, resolution);
+                std::copy(rgb.begin(), rgb.end(), out);
+            }
+            return count;
+
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (RadiationModel::getCameraImageRGBBuffer): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (RadiationModel::getCameraImageRGBBuffer): Unknown error getting camera RGB image.");
+            return 0;
+        }
+    }
+
+    PYHELIOS_API size_t getCameraImageRGB8Buffer(RadiationModel* radiation_model, const char* camera,
+                                                 const char* red_band, const char* green_band, const char* blue_band,
+                                                 float flux_to_pixel_conversion, int normalize,
+                                                 unsigned char* out, size_t capacity, int* width, int* height) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "RadiationModel pointer is null");
+                return 0;
+            }
+            if (!camera || !red_band || !green_band || !blue_band) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Required parameters are null");
+                return 0;
+            }
+
+            const char* bands[3] = {red_band, green_band, blue_band};
+            helios::int2 resolution = getCameraResolution(radiation_model, std::string(camera));
+            if (width) *width = resolution.x;
+            if (height) *height = resolution.y;
+            const size_t count = 3 * size_t(resolution.x) * size_t(resolution.y);
+            if (out && capacity >= count) {
+                std::vector<float> rgb = composeCameraRGB(radiation_model, std::string(camera), bands, flux_to_pixel_conversion, normalize != 0, resolution);
+                for (size_t i = 0; i < rgb.size(); ++i) {
+                    out[i] = static_cast<unsigned char>(rgb[i] * 255.f + 0.5f);
+                }
+            }
+            return count;
+
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (RadiationModel::getCameraImageRGB8Buffer): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (RadiationModel::getCameraImageRGB8Buffer): Unknown error getting camera RGB image.");
+            return 0;
+        }
+    }
+
+    PYHELIOS_API size_t getImageBoundingBoxesBuffer(RadiationModel* radiation_model, const char* camera_label,
+                                                    const char* data_label, int object_data,
+                                                    unsigned int* out, size_t capacity, int* width, int* height) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "RadiationModel pointer is null");
+                return 0;
+            }
+            if (!camera_label || !data_label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Required parameters are null");
+                return 0;
+            }
+
+            CameraInstanceMap map = readCameraInstances(radiation_model, std::string(camera_label), std::string(data_label), object_data != 0);
+            if (width) *width = map.resolution.x;
+            if (height) *height = map.resolution.y;
+            const size_t count = 6 * map.values.size();
+            if (!out || capacity < count) {
+                return count;
+            }
+
+            for (size_t i = 0; i < map.values.size(); ++i) {
+                unsigned int* box = out + 6 * i;
+                box[0] = map.values[i];
+                box[1] = uint(map.resolution.x);
+                box[2] = uint(map.resolution.y);
+                box[3] = 0;
+                box[4] = 0;
+                box[5] = 0;
+            }
+            for (int j = 0; j < map.resolution.y; ++j) {
+                for (int i = 0; i < map.resolution.x; ++i) {
+                    const uint index = map.pixel_index[size_t(j) * map.resolution.x + i];
+                    if (index == NO_INSTANCE) {
+                        continue;
+                    }
+                    unsigned int* box = out + 6 * size_t(index);
+                    box[1] = std::min(box[1], uint(i));
+                    box[2] = std::min(box[2], uint(j));
+                    box[3] = std::max(box[3], uint(i));
+                    box[4] = std::max(box[4], uint(j));
+                    box[5]++;
+                }
+            }
+            return count;
+
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (RadiationModel::getImageBoundingBoxesBuffer): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (RadiationModel::getImageBoundingBoxesBuffer): Unknown error getting bounding boxes.");
+            return 0;
+        }
+    }
+
+    PYHELIOS_API size_t getImageSegmentationMasksRLE(RadiationModel* radiation_model, const char* camera_label,
+                                                     const char* data_label, int object_data,
+                                                     unsigned int* out, size_t capacity, int* width, int* height) {
+        try {
+            clearError();
+            if (!radiation_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "RadiationModel pointer is null");
+                return 0;
+            }
+            if (!camera_label || !data_label) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Required parameters are null");
+                return 0;
+            }
+
+            CameraInstanceMap map = readCameraInstances(radiation_model, std::string(camera_label), std::string(data_label), object_data != 0);
+            if (width) *width = map.resolution.x;
+            if (height) *height = map.resolution.y;
+            const uint columns = uint(map.resolution.x);
+            const uint rows = uint(map.resolution.y);
+
+            // One column-major pass builds the runs of every instance: a pixel either extends the
+            // instance's current foreground run or closes the background gap since its last run
+            std::vector<std::vector<uint>> runs(map.values.size());
+            std::vector<uint> run_end(map.values.size(), 0);
+            for (uint i = 0; i < columns; ++i) {
+                for (uint j = 0; j < rows; ++j) {
+                    const uint index = map.pixel_index[size_t(j) * columns + i];
+                    if (index == NO_INSTANCE) {
+                        continue;
+                    }
+                    const uint position = i * rows + j;
+                    std::vector<uint>& counts = runs[index];
+                    if (!counts.empty() && run_end[index] == position) {
+                        counts.back()++;
+                    } else {
+                        counts.push_back(position - run_end[index]);
+                        counts.push_back(1);
+                    }
+                    run_end[index] = position + 1;
+                }
+            }
+
+            size_t count = 0;
+            for (size_t k = 0; k < runs.size(); ++k) {
+                runs[k].push_back(columns * rows - run_end[k]);
+                count += 2 + runs[k].size();
+            }
+            if (!out || capacity < count) {
+                return count;
+            }
+
+            unsigned int* cursor = out;
+            for (size_t k = 0; k < runs.size(); ++k) {
+                *cursor++ = map.values[k];
+                *cursor++ = uint(runs[k].size());
+                cursor = std::copy(runs[k].begin(), runs[k].end(), cursor);
+            }
+            return count;
+
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (RadiationModel::getImageSegmentationMasksRLE): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (RadiationModel::getImageSegmentationMasksRLE): Unknown error getting segmentation masks.");
+            return 0;
+        }
+    }
+
     // Bounding box functions - single primitive data label
     PYHELIOS_API void writeImageBoundingBoxes(RadiationModel* radiation_model, const char* camera_label,
                                  const char* primitive_data_label, unsigned int object_class_id,
@@ -999,6 +1728,7 @@ extern "C" {
             props.FOV_aspect_ratio = camera_properties[5];
 
             radiation_model->addRadiationCamera(std::string(camera_label), band_vector, position, lookat, props, antialiasing_samples);
+            setCameraResolution(radiation_model, std::string(camera_label), props.camera_resolution);
 
         } catch (const std::exception& e) {
             setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (RadiationModel::addRadiationCamera): ") + e.what());
@@ -1049,6 +1779,7 @@ extern "C" {
             props.FOV_aspect_ratio = camera_properties[5];
 
             radiation_model->addRadiationCamera(std::string(camera_label), band_vector, position, viewing_direction, props, antialiasing_samples);
+            setCameraResolution(radiation_model, std::string(camera_label), props.camera_resolution);
 
         } catch (const std::exception& e) {
             setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (RadiationModel::addRadiationCamera): ") + e.what());
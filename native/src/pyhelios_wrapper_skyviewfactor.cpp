@@ -3,9 +3,19 @@
 
 #include "../include/pyhelios_wrapper_common.h"
 #include "../include/pyhelios_wrapper_context.h"
+#include "../include/pyhelios_geometry_cache.h"
 #include "Context.h"
 #include <string>
 #include <exception>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// Mirrors the typedef in pyhelios_wrapper_skyviewfactor.h (that header is not included here)
+typedef int (*SkyViewFactorProgressCallback)(size_t points_done, size_t total_points);
 
 #ifdef SKYVIEWFACTOR_PLUGIN_AVAILABLE
 // Include complete class definitions
@@ -18,6 +28,27 @@
 using helios::SkyViewFactorModel;
 using helios::SkyViewFactorCamera;
 
+namespace {
+
+    // Cosine-weighted hemisphere sampling about +z: the fraction of unoccluded rays is the sky view factor
+    float svfForPoint(const pyhelios::GeometryBVH& bvh, const helios::vec3& origin, uint ray_count, float max_length, uint64_t seed, uint64_t index) {
+        pyhelios::RandomStream rng(seed, index);
+        uint visible = 0;
+        for (uint r = 0; r < ray_count; ++r) {
+            float u1 = rng.uniform();
+            float u2 = rng.uniform();
+            float sin_theta = std::sqrt(u1);
+            float phi = 2.f * float(M_PI) * u2;
+            helios::vec3 dir(sin_theta * std::cos(phi), sin_theta * std::sin(phi), std::sqrt(std::max(0.f, 1.f - u1)));
+            if (!bvh.occluded(origin, dir, max_length)) {
+                ++visible;
+            }
+        }
+        return ray_count > 0 ? float(visible) / float(ray_count) : 0.f;
+    }
+
+} // namespace
+
 extern "C" {
     // SkyViewFactorModel C interface functions
     
@@ -197,15 +228,14 @@ extern "C" {
             }
             
             std::vector<helios::vec3> point_vec;
+            point_vec.reserve(num_points);
             for (size_t i = 0; i < num_points; ++i) {
-                point_vec.push_back(helios::vec3(points[3*i], points[3*i+1], points[3*i+2]));
+                point_vec.emplace_back(points[3*i], points[3*i+1], points[3*i+2]);
             }
             
             std::vector<float> svf_results = skyviewfactor_model->calculateSkyViewFactors(point_vec, num_threads);
             
-            for (size_t i = 0; i < svf_results.size() && i < num_points; ++i) {
-                results[i] = svf_results[i];
-            }
+            std::copy_n(svf_results.begin(), std::min(svf_results.size(), num_points), results);
         } catch (const std::exception& e) {
             setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (SkyViewFactorModel::calculateSkyViewFactors): ") + e.what());
         } catch (...) {
@@ -213,6 +243,57 @@ extern "C" {
         }
     }
     
+    // Chunked multiple points calculation for point clouds too large to convert in one pass
+    PYHELIOS_API size_t calculateSkyViewFactorsChunked(SkyViewFactorModel* skyviewfactor_model, const float* points, size_t num_points, float* results, size_t chunk_size, SkyViewFactorProgressCallback progress_cb, int num_threads) {
+        try {
+            clearError();
+            if (!skyviewfactor_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "SkyViewFactorModel pointer is null");
+                return 0;
+            }
+            if (num_points == 0) {
+                return 0;
+            }
+            if (!points || !results) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Points or results pointer is null");
+                return 0;
+            }
+            if (chunk_size == 0) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Chunk size must be greater than zero");
+                return 0;
+            }
+
+            // Only one chunk of vec3 points is resident at a time; the buffer is reused between chunks
+            std::vector<helios::vec3> point_vec;
+            point_vec.reserve(std::min(chunk_size, num_points));
+
+            size_t processed = 0;
+            while (processed < num_points) {
+                size_t count = std::min(chunk_size, num_points - processed);
+                const float* chunk_points = points + 3 * processed;
+                point_vec.clear();
+                for (size_t i = 0; i < count; ++i) {
+                    point_vec.emplace_back(chunk_points[3*i], chunk_points[3*i+1], chunk_points[3*i+2]);
+                }
+
+                std::vector<float> svf_results = skyviewfactor_model->calculateSkyViewFactors(point_vec, num_threads);
+                std::copy_n(svf_results.begin(), std::min(svf_results.size(), count), results + processed);
+                processed += count;
+
+                if (progress_cb && progress_cb(processed, num_points) != 0) {
+                    break;  // cancelled by caller; results beyond 'processed' are left untouched
+                }
+            }
+            return processed;
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (SkyViewFactorModel::calculateSkyViewFactorsChunked): ") + e.what());
+            return 0;
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (SkyViewFactorModel::calculateSkyViewFactorsChunked): Unknown error calculating sky view factors.");
+            return 0;
+        }
+    }
+    
     // Primitive centers calculation
     PYHELIOS_API size_t calculateSkyViewFactorsForPrimitives(SkyViewFactorModel* skyviewfactor_model, float* results, uint* primitive_ids, size_t num_primitives, int num_threads) {
         try {
@@ -245,7 +326,69 @@ extern "C" {
             return 0;
         }
     }
-    
+
+    // Multithreaded CPU calculation (shared cached BVH, dynamic chunk scheduling)
+    PYHELIOS_API void calculateSkyViewFactorsParallelCPU(SkyViewFactorModel* skyviewfactor_model, helios::Context* context, const float* points, size_t num_points, float* results, int num_threads, unsigned int seed) {
+        try {
+            clearError();
+            if (!skyviewfactor_model) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "SkyViewFactorModel pointer is null");
+                return;
+            }
+            if (!context) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Context pointer is null");
+                return;
+            }
+            if (num_points == 0) {
+                return;
+            }
+            if (!points || !results) {
+                setError(PYHELIOS_ERROR_INVALID_PARAMETER, "Points or results pointer is null");
+                return;
+            }
+
+            // Shared with other CPU ray tracing wrappers; only rebuilt (or refit) when the geometry revision changes
+            std::shared_ptr<const pyhelios::GeometryBVH> bvh = pyhelios::acquireGeometryBVH(context);
+
+            const uint ray_count = skyviewfactor_model->getRayCount();
+            const float max_length = skyviewfactor_model->getMaxRayLength();
+
+            size_t thread_count = num_threads > 0 ? size_t(num_threads) : size_t(std::thread::hardware_concurrency());
+            thread_count = std::max<size_t>(1, std::min(thread_count, num_points));
+
+            // Threads pull fixed-size chunks from a shared counter so slow (occluded) regions don't stall a static partition
+            const size_t chunk_size = 64;
+            std::atomic<size_t> next_chunk(0);
+            auto worker = [&]() {
+                while (true) {
+                    size_t begin = next_chunk.fetch_add(chunk_size);
+                    if (begin >= num_points) {
+                        break;
+                    }
+                    size_t end = std::min(begin + chunk_size, num_points);
+                    for (size_t i = begin; i < end; ++i) {
+                        helios::vec3 origin(points[3 * i], points[3 * i + 1], points[3 * i + 2]);
+                        results[i] = svfForPoint(*bvh, origin, ray_count, max_length, seed, i);
+                    }
+                }
+            };
+
+            std::vector<std::thread> pool;
+            pool.reserve(thread_count - 1);
+            for (size_t t = 1; t < thread_count; ++t) {
+                pool.emplace_back(worker);
+            }
+            worker();
+            for (std::thread& th : pool) {
+                th.join();
+            }
+        } catch (const std::exception& e) {
+            setError(PYHELIOS_ERROR_RUNTIME, std::string("ERROR (SkyViewFactorModel::calculateSkyViewFactorsParallelCPU): ") + e.what());
+        } catch (...) {
+            setError(PYHELIOS_ERROR_UNKNOWN, "ERROR (SkyViewFactorModel::calculateSkyViewFactorsParallelCPU): Unknown error calculating sky view factors (parallel CPU).");
+        }
+    }
+
     // Export/Import functionality
     PYHELIOS_API bool exportSkyViewFactors(SkyViewFactorModel* skyviewfactor_model, const char* filename) {
         try {
@@ -781,14 +924,23 @@ extern "C" {
         return 0.0f;
     }
     
-    PYHELIOS_API void calculateSkyViewFactors(SkyViewFactorModel* skyviewfactor_model, float* points, size_t num_points, float* results) {
+    PYHELIOS_API void calculateSkyViewFactors(SkyViewFactorModel* skyviewfactor_model, float* points, size_t num_points, float* results, int num_threads) {
         setError(PYHELIOS_ERROR_PLUGIN_NOT_AVAILABLE, "SkyViewFactor plugin is not available");
     }
+
+    PYHELIOS_API size_t calculateSkyViewFactorsChunked(SkyViewFactorModel* skyviewfactor_model, const float* points, size_t num_points, float* results, size_t chunk_size, SkyViewFactorProgressCallback progress_cb, int num_threads) {
+        setError(PYHELIOS_ERROR_PLUGIN_NOT_AVAILABLE, "SkyViewFactor plugin is not available");
+        return 0;
+    }
     
     PYHELIOS_API size_t calculateSkyViewFactorsForPrimitives(SkyViewFactorModel* skyviewfactor_model, float* results, uint* primitive_ids, size_t num_primitives, int num_threads) {
         setError(PYHELIOS_ERROR_PLUGIN_NOT_AVAILABLE, "SkyViewFactor plugin is not available");
         return 0;
     }
+
+    PYHELIOS_API void calculateSkyViewFactorsParallelCPU(SkyViewFactorModel* skyviewfactor_model, helios::Context* context, const float* points, size_t num_points, float* results, int num_threads, unsigned int seed) {
+        setError(PYHELIOS_ERROR_PLUGIN_NOT_AVAILABLE, "SkyViewFactor plugin is not available");
+    }
     
     PYHELIOS_API bool exportSkyViewFactors(SkyViewFactorModel* skyviewfactor_model, const char* filename) {
         setError(PYHELIOS_ERROR_PLUGIN_NOT_AVAILABLE, "SkyViewFactor plugin is not available");
@@ -1,4 +1,3 @@
-import ctypes
 from dataclasses import dataclass
 from typing import List, Optional, Union
 from enum import Enum
@@ -9,6 +8,7 @@ from .wrappers import UContextWrapper as context_wrapper
 from .wrappers.DataTypes import vec2, vec3, vec4, int2, int3, int4, SphericalCoord, RGBcolor, PrimitiveType
 from .plugins.loader import LibraryLoadError, validate_library, get_library_info
 from .plugins.registry import get_plugin_registry
+from .exceptions import HeliosInvalidArgumentError, HeliosUUIDNotFoundError
 from .validation.geometry import (
     validate_patch_params, validate_triangle_params, validate_sphere_params,
     validate_tube_params, validate_box_params
@@ -297,6 +297,60 @@ class Context:
         self._check_context_available()
         return context_wrapper.isGeometryDirty(self.context)
 
+    def getGeometryRevision(self) -> int:
+        """
+        Get the geometry revision counter.
+
+        The revision advances whenever primitives are added or deleted, any vertex
+        moves, or markGeometryDirty() is called. CPU ray tracing routines share one
+        acceleration structure per Context and reuse it while the revision is unchanged,
+        refitting it in place of a rebuild when only vertex positions changed.
+
+        Returns:
+            Revision number (reading it is linear in the number of primitives)
+        """
+        self._check_context_available()
+        return context_wrapper.getGeometryRevision(self.context)
+
+    def getDirtyUUIDs(self, include_deleted: bool = False) -> List[int]:
+        """
+        Get UUIDs of primitives added or modified since the last markGeometryClean().
+
+        Read from the Context's own per-primitive dirty flags, so any change Helios
+        tracks on a primitive (vertices, color, ...) marks it dirty.
+
+        Args:
+            include_deleted: If True, also include UUIDs of primitives deleted since the last clean
+
+        Returns:
+            Sorted list of UUIDs
+        """
+        self._check_context_available()
+        dirty = context_wrapper.getDirtyPrimitiveUUIDs(self.context)
+        if include_deleted:
+            dirty = sorted(dirty + context_wrapper.getDeletedPrimitiveUUIDs(self.context))
+        return dirty
+
+    def getDeletedUUIDs(self) -> List[int]:
+        """
+        Get UUIDs of primitives deleted since the last markGeometryClean().
+
+        Returns:
+            Sorted list of UUIDs
+        """
+        self._check_context_available()
+        return context_wrapper.getDeletedPrimitiveUUIDs(self.context)
+
+    def getGeometryCacheStats(self) -> dict:
+        """
+        Get counters for the shared CPU acceleration structure of this Context.
+
+        Returns:
+            Dictionary with 'builds' (full BVH builds) and 'refits' (vertex-only refits)
+        """
+        self._check_context_available()
+        return context_wrapper.getGeometryCacheStats(self.context)
+
     @validate_patch_params
     def addPatch(self, center: vec3 = vec3(0, 0, 0), size: vec2 = vec2(1, 1), rotation: Optional[SphericalCoord] = None, color: Optional[RGBcolor] = None) -> int:
         self._check_context_available()
@@ -393,12 +447,8 @@ class Context:
 
     def getPrimitiveVertices(self, uuid: int) -> List[vec3]:
         self._check_context_available()
-        size = ctypes.c_uint()
-        vertices_ptr = context_wrapper.getPrimitiveVertices(self.context, uuid, ctypes.byref(size))
-        # size.value is the total number of floats (3 per vertex), not the number of vertices
-        vertices_list = ctypes.cast(vertices_ptr, ctypes.POINTER(ctypes.c_float * size.value)).contents
-        vertices = [vec3(vertices_list[i], vertices_list[i+1], vertices_list[i+2]) for i in range(0, size.value, 3)]
-        return vertices
+        coordinates = context_wrapper.getPrimitiveVerticesList(self.context, uuid)
+        return [vec3(coordinates[i], coordinates[i+1], coordinates[i+2]) for i in range(0, len(coordinates), 3)]
 
     def getPrimitiveColor(self, uuid: int) -> RGBcolor:
         self._check_context_available()
@@ -411,9 +461,7 @@ class Context:
 
     def getAllUUIDs(self) -> List[int]:
         self._check_context_available()
-        size = ctypes.c_uint()
-        uuids_ptr = context_wrapper.getAllUUIDs(self.context, ctypes.byref(size))
-        return list(uuids_ptr[:size.value])
+        return context_wrapper.getAllUUIDsList(self.context)
 
     def getObjectCount(self) -> int:
         self._check_context_available()
@@ -421,9 +469,7 @@ class Context:
 
     def getAllObjectIDs(self) -> List[int]:
         self._check_context_available()
-        size = ctypes.c_uint()
-        objectids_ptr = context_wrapper.getAllObjectIDs(self.context, ctypes.byref(size))
-        return list(objectids_ptr[:size.value])
+        return context_wrapper.getAllObjectIDsList(self.context)
 
     def getPrimitiveInfo(self, uuid: int) -> PrimitiveInfo:
         """
@@ -460,7 +506,7 @@ class Context:
             List of PrimitiveInfo objects for all primitives
         """
         all_uuids = self.getAllUUIDs()
-        return [self.getPrimitiveInfo(uuid) for uuid in all_uuids]
+        return self._getPrimitiveInfoList(all_uuids)
 
     def getPrimitivesInfoForObject(self, object_id: int) -> List[PrimitiveInfo]:
         """
@@ -473,7 +519,76 @@ class Context:
             List of PrimitiveInfo objects for primitives in the object
         """
         object_uuids = context_wrapper.getObjectPrimitiveUUIDs(self.context, object_id)
-        return [self.getPrimitiveInfo(uuid) for uuid in object_uuids]
+        return self._getPrimitiveInfoList(object_uuids)
+
+    def getPrimitiveGeometryArrays(self, uuids: Optional[List[int]] = None) -> dict:
+        """
+        Get geometry for many primitives as NumPy arrays in a single native round-trip.
+        
+        Args:
+            uuids: List of primitive UUIDs (default: all primitives in the context)
+            
+        Returns:
+            Dictionary of NumPy arrays:
+            - 'uuids': uint32 array (N,) of the queried UUIDs
+            - 'vertex_offsets': uint32 array (N+1,); vertices of primitive i are vertices[offsets[i]:offsets[i+1]]
+            - 'vertices': float32 array (V, 3) of packed vertices
+            - 'normals': float32 array (N, 3)
+            - 'areas': float32 array (N,)
+            - 'types': uint32 array (N,) of PrimitiveType values
+            - 'colors': float32 array (N, 4) of RGBA colors
+            
+        Example:
+            >>> geometry = context.getPrimitiveGeometryArrays()
+            >>> total_leaf_area = geometry['areas'].sum()
+        """
+        self._check_context_available()
+        if uuids is None:
+            uuids = self.getAllUUIDs()
+        
+        if context_wrapper._GEOMETRY_BULK_FUNCTIONS_AVAILABLE:
+            geometry = context_wrapper.getPrimitiveGeometryBulk(self.context, uuids)
+        else:
+            # Fall back to per-primitive queries on older native builds
+            infos = [self.getPrimitiveInfo(uuid) for uuid in uuids]
+            counts = [len(info.vertices) for info in infos]
+            geometry = {
+                'vertex_offsets': np.concatenate([[0], np.cumsum(counts)]).astype(np.uint32),
+                'vertices': np.array([[v.x, v.y, v.z] for info in infos for v in info.vertices], dtype=np.float32).reshape(-1, 3),
+                'normals': np.array([[i.normal.x, i.normal.y, i.normal.z] for i in infos], dtype=np.float32).reshape(-1, 3),
+                'areas': np.array([i.area for i in infos], dtype=np.float32),
+                'types': np.array([i.primitive_type.value for i in infos], dtype=np.uint32),
+                'colors': np.array([list(context_wrapper.getPrimitiveColorRGBA(self.context, uuid)[:4]) for uuid in uuids],
+                                   dtype=np.float32).reshape(-1, 4),
+            }
+        geometry['uuids'] = np.asarray(uuids, dtype=np.uint32)
+        return geometry
+
+    def _getPrimitiveInfoList(self, uuids: List[int]) -> List[PrimitiveInfo]:
+        """Build PrimitiveInfo objects for a UUID list, using the bulk geometry export when available."""
+        if not context_wrapper._GEOMETRY_BULK_FUNCTIONS_AVAILABLE:
+            return [self.getPrimitiveInfo(uuid) for uuid in uuids]
+        
+        self._check_context_available()
+        geometry = context_wrapper.getPrimitiveGeometryBulk(self.context, uuids)
+        offsets = geometry['vertex_offsets'].tolist()
+        vertices = geometry['vertices'].tolist()
+        normals = geometry['normals'].tolist()
+        areas = geometry['areas'].tolist()
+        types = geometry['types'].tolist()
+        colors = geometry['colors'].tolist()
+        
+        return [
+            PrimitiveInfo(
+                uuid=uuid,
+                primitive_type=PrimitiveType(types[i]),
+                area=areas[i],
+                normal=vec3(*normals[i]),
+                vertices=[vec3(*v) for v in vertices[offsets[i]:offsets[i + 1]]],
+                color=RGBcolor(colors[i][0], colors[i][1], colors[i][2])
+            )
+            for i, uuid in enumerate(uuids)
+        ]
 
     # Compound geometry methods
     def addTile(self, center: vec3 = vec3(0, 0, 0), size: vec2 = vec2(1, 1), 
@@ -994,6 +1109,16 @@ class Context:
         if colors is not None:
             colors_float = colors.astype(np.float32)
         
+        # Use the single-call native path when available
+        if 'addTrianglesBulk' in context_wrapper._AVAILABLE_TRIANGLE_FUNCTIONS:
+            face_colors = None
+            if per_triangle_colors:
+                face_colors = colors_float
+            elif per_vertex_colors:
+                # Average the per-vertex colors for each triangle
+                face_colors = colors_float[faces_int].mean(axis=1)
+            return context_wrapper.addTrianglesBulk(self.context, vertices_float, faces_int, face_colors)
+        
         # Add triangles
         triangle_uuids = []
         for i in range(faces.shape[0]):
@@ -1358,19 +1483,31 @@ class Context:
         if not uuids:
             raise ValueError("UUID list cannot be empty")
         
-        # First validate that all UUIDs exist
+        # First validate that all UUIDs exist, fetching the context's UUID set only once
+        valid_uuids = set(self.getAllUUIDs())
         for uuid in uuids:
-            self._validate_uuid(uuid)
+            if not isinstance(uuid, int) or uuid not in valid_uuids:
+                self._validate_uuid(uuid)
+        
+        # Get data type from the first UUID to determine array type
+        first_uuid = uuids[0]
+        if not self.doesPrimitiveDataExist(first_uuid, label):
+            raise ValueError(f"Primitive data '{label}' does not exist for UUID {first_uuid}")
+        data_type = self.getPrimitiveDataType(first_uuid, label)
+        
+        # Numeric and vector data can be read as one contiguous column in a single native call,
+        # which also checks that every UUID carries the label
+        if context_wrapper._PRIMITIVE_DATA_COLUMN_FUNCTIONS_AVAILABLE and data_type in context_wrapper._PRIMITIVE_DATA_COLUMN_LAYOUTS:
+            try:
+                return context_wrapper.getPrimitiveDataColumn(self.context, uuids, label, data_type)
+            except HeliosInvalidArgumentError as e:
+                raise ValueError(str(e)) from e
         
         # Then check that all UUIDs have the specified data
         for uuid in uuids:
             if not self.doesPrimitiveDataExist(uuid, label):
                 raise ValueError(f"Primitive data '{label}' does not exist for UUID {uuid}")
         
-        # Get data type from the first UUID to determine array type
-        first_uuid = uuids[0]
-        data_type = self.getPrimitiveDataType(first_uuid, label)
-        
         # Map Helios data types to NumPy array creation
         # Based on HeliosDataType enum from Helios core
         if data_type == 0:  # HELIOS_TYPE_INT
@@ -1438,6 +1575,75 @@ class Context:
             raise ValueError(f"Unsupported primitive data type: {data_type}")
         
         return result
+
+    
+    def setPrimitiveDataArray(self, uuids: List[int], label: str, values, data_type: str = "float") -> None:
+        """
+        Set primitive data for multiple primitives from a NumPy array or a single broadcast value.
+        
+        This is the write counterpart of getPrimitiveDataArray() and is intended for per-timestep
+        forcing updates (e.g. "temperature" or radiation inputs) on many primitives at once.
+        
+        Args:
+            uuids: List of primitive UUIDs to set data for
+            label: String key for the primitive data
+            values: Array of shape (N,) for scalar types or (N, k) for vector types, with one entry
+                    per UUID; or a single scalar / length-k value that is written to every UUID
+            data_type: Storage type - one of "int", "uint", "float", "double", "vec2", "vec3",
+                       "vec4", "int2", "int3", "int4" (default: "float")
+            
+        Raises:
+            ValueError: If the UUID list is empty, the data type is unknown, or the values do not match the UUID count
+            RuntimeError: If context is in mock mode or a UUID does not exist
+            
+        Example:
+            >>> context.setPrimitiveDataArray(leaf_uuids, "temperature", leaf_temps)
+            >>> context.setPrimitiveDataArray(leaf_uuids, "moisture_conductance", 0.05)  # broadcast
+        """
+        self._check_context_available()
+        
+        if not uuids:
+            raise ValueError("UUID list cannot be empty")
+        
+        type_codes = {"int": 0, "uint": 1, "float": 2, "double": 3, "vec2": 4, "vec3": 5,
+                      "vec4": 6, "int2": 7, "int3": 8, "int4": 9}
+        if data_type not in type_codes:
+            raise ValueError(f"Unsupported data type '{data_type}'. Supported types: {', '.join(type_codes)}")
+        type_code = type_codes[data_type]
+        
+        if context_wrapper._PRIMITIVE_DATA_COLUMN_FUNCTIONS_AVAILABLE:
+            try:
+                context_wrapper.setPrimitiveDataColumn(self.context, uuids, label, type_code, values)
+            except HeliosUUIDNotFoundError as e:
+                raise RuntimeError(str(e)) from e
+            return
+        
+        # Fall back to one native call per UUID
+        dtype_name, components = context_wrapper._PRIMITIVE_DATA_COLUMN_LAYOUTS[type_code]
+        value_array = np.asarray(values, dtype=np.dtype(dtype_name))
+        if value_array.size == components:
+            value_array = np.broadcast_to(value_array.reshape(components), (len(uuids), components))
+        elif value_array.size == len(uuids) * components:
+            value_array = value_array.reshape(len(uuids), components)
+        else:
+            raise ValueError(f"Expected {len(uuids)} values with {components} component(s) each "
+                             f"(or a single value to broadcast), got array of shape {value_array.shape}")
+        
+        setters = {
+            "int": context_wrapper.setPrimitiveDataInt,
+            "uint": context_wrapper.setPrimitiveDataUInt,
+            "float": context_wrapper.setPrimitiveDataFloat,
+            "double": context_wrapper.setPrimitiveDataDouble,
+            "vec2": context_wrapper.setPrimitiveDataVec2,
+            "vec3": context_wrapper.setPrimitiveDataVec3,
+            "vec4": context_wrapper.setPrimitiveDataVec4,
+            "int2": context_wrapper.setPrimitiveDataInt2,
+            "int3": context_wrapper.setPrimitiveDataInt3,
+            "int4": context_wrapper.setPrimitiveDataInt4,
+        }
+        setter = setters[data_type]
+        for uuid, value in zip(uuids, value_array.tolist()):
+            setter(self.context, uuid, label, *value)
     
     
     def colorPrimitiveByDataPseudocolor(self, uuids: List[int], primitive_data: str, 
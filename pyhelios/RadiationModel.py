@@ -5,14 +5,19 @@ This module provides a user-friendly interface to the radiation modeling
 capabilities with graceful plugin handling and informative error messages.
 """
 
+import json
 import logging
 from typing import List, Optional
 from contextlib import contextmanager
+from functools import wraps
 from pathlib import Path
 import os
 
+import numpy as np
+
 from .plugins.registry import get_plugin_registry, require_plugin, graceful_plugin_fallback
 from .wrappers import URadiationModelWrapper as radiation_wrapper
+from .wrappers import UCPURadiationModelWrapper as cpu_radiation_wrapper
 from .validation.plugins import (
     validate_wavelength_range, validate_flux_value, validate_ray_count,
     validate_direction_vector, validate_band_label, validate_source_id, validate_source_id_list
@@ -24,6 +29,7 @@ from .validation.plugin_decorators import (
     validate_min_scatter_energy_params
 )
 from .Context import Context
+from .exceptions import HeliosError
 from .assets import get_asset_manager
 
 logger = logging.getLogger(__name__)
@@ -91,6 +97,76 @@ class RadiationModelError(Exception):
     pass
 
 
+RADIATION_BACKENDS = ("optix", "cpu")
+
+
+def require_radiation_backend(feature_description: str, cpu_supported: bool = True):
+    """
+    Method decorator replacing require_plugin('radiation', ...) on RadiationModel.
+
+    The OptiX backend needs the radiation plugin; the CPU backend is part of the core
+    wrapper library and needs no plugin, but does not implement every feature. CPU models
+    also refuse calls while a runBandAsync() job is still going.
+    """
+    def decorator(func):
+        @wraps(func)
+        def wrapper(self, *args, **kwargs):
+            if self._backend == "cpu":
+                if not cpu_supported:
+                    raise RadiationModelError(
+                        f"Cannot {feature_description}: not supported by the CPU radiation backend. "
+                        "Create the RadiationModel with backend='optix' for this feature."
+                    )
+                self._check_no_active_job()
+            else:
+                get_plugin_registry().require_plugin('radiation', feature_description or func.__name__)
+            return func(self, *args, **kwargs)
+        return wrapper
+    return decorator
+
+
+def require_cpu_backend(func):
+    """
+    Method decorator for features only the CPU backend implements.
+
+    Raises RadiationModelError on any other backend and, like require_radiation_backend,
+    refuses the call while a runBandAsync() job is still going.
+    """
+    @wraps(func)
+    def wrapper(self, *args, **kwargs):
+        if self._backend != "cpu":
+            raise RadiationModelError(f"{func.__name__}() is only available with backend='cpu'")
+        self._check_no_active_job()
+        return func(self, *args, **kwargs)
+    return wrapper
+
+
+def _direction_components(direction):
+    """Cartesian (x, y, z) of a direction given as tuple, vec3 or SphericalCoord"""
+    # Handle vec3, SphericalCoord, and tuple types
+    if hasattr(direction, 'x') and hasattr(direction, 'y') and hasattr(direction, 'z'):
+        # vec3-like object
+        return direction.x, direction.y, direction.z
+    if hasattr(direction, 'radius') and hasattr(direction, 'elevation') and hasattr(direction, 'azimuth'):
+        # SphericalCoord object - convert to Cartesian
+        import math
+        r = direction.radius
+        elevation = direction.elevation
+        azimuth = direction.azimuth
+        return (r * math.cos(elevation) * math.cos(azimuth),
+                r * math.cos(elevation) * math.sin(azimuth),
+                r * math.sin(elevation))
+    # Assume tuple-like object - validate it first
+    try:
+        if len(direction) != 3:
+            raise TypeError(f"Direction must be a 3-element tuple, vec3, or SphericalCoord, got {type(direction).__name__} with {len(direction)} elements")
+        x, y, z = direction
+    except (TypeError, AttributeError):
+        # Not a valid sequence type
+        raise TypeError(f"Direction must be a tuple, vec3, or SphericalCoord, got {type(direction).__name__}")
+    return x, y, z
+
+
 class CameraProperties:
     """
     Camera properties for radiation model cameras.
@@ -159,6 +235,202 @@ class CameraProperties:
                 f"FOV_aspect_ratio={self.FOV_aspect_ratio})")
 
 
+class COCOAnnotationWriter:
+    """
+    Streaming writer for COCO instance segmentation annotations.
+
+    Annotations are written to the file as frames are added, so adding a frame costs the same no
+    matter how large the dataset already is. The image and category lists are kept in memory and
+    written as the last line of the file when the writer is closed; opening an existing file with
+    append=True only rewrites that line.
+
+    Example:
+        >>> with COCOAnnotationWriter("annotations.json", categories={1: "leaf"}) as writer:
+        ...     frame = radiation_model.getImageAnnotations("camera", primitive_data_labels="leaf_id",
+        ...                                                 object_class_ids=1)
+        ...     writer.addFrame("image_0001.jpeg", frame)
+    """
+
+    _HEADER = '{"annotations": ['
+
+    def __init__(self, filename: str, categories: Optional[dict] = None, append: bool = False):
+        """
+        Open an annotation file for writing.
+
+        Args:
+            filename: JSON output filename
+            categories: Dict mapping class IDs to category names
+            append: Continue an existing file written by this class instead of overwriting it
+
+        Raises:
+            ValueError: If append is True and the file was not written by COCOAnnotationWriter
+        """
+        self.filename = str(filename)
+        self._images = []
+        self._categories = {}
+        self._annotation_count = 0
+
+        if append and os.path.exists(self.filename) and os.path.getsize(self.filename) > 0:
+            self._file = open(self.filename, 'r+b')
+            tail_start = self._findLastNewline()
+            self._file.seek(max(tail_start, 0))
+            tail = self._file.read().decode('utf-8')
+            if tail_start < 0 or not tail.startswith('\n], '):
+                self._file.close()
+                raise ValueError(f"'{self.filename}' was not written by COCOAnnotationWriter")
+            closing = json.loads('{' + tail[len('\n], '):])
+            self._images = closing['images']
+            self._categories = {category['id']: category['name'] for category in closing['categories']}
+            self._annotation_count = closing['info']['annotation_count']
+            self._file.seek(tail_start)
+            self._file.truncate()
+        else:
+            self._file = open(self.filename, 'wb')
+            self._file.write(self._HEADER.encode('utf-8'))
+
+        if categories:
+            self._categories.update({int(class_id): str(name) for class_id, name in categories.items()})
+
+    def _findLastNewline(self) -> int:
+        """Byte offset of the last newline in the file (-1 if there is none)"""
+        self._file.seek(0, os.SEEK_END)
+        end = self._file.tell()
+        chunk_size = 65536
+        while end > 0:
+            start = max(0, end - chunk_size)
+            self._file.seek(start)
+            position = self._file.read(end - start).rfind(b'\n')
+            if position >= 0:
+                return start + position
+            end = start
+        return -1
+
+    def addFrame(self, image_file: str, frame: dict) -> int:
+        """
+        Append one image and its annotations.
+
+        Args:
+            image_file: Image filename recorded in the COCO image entry
+            frame: Dict as returned by RadiationModel.getImageAnnotations
+
+        Returns:
+            COCO image ID assigned to the frame
+        """
+        if self._file is None:
+            raise ValueError("COCOAnnotationWriter is closed")
+
+        image_id = len(self._images) + 1
+        self._images.append({"id": image_id, "file_name": str(image_file),
+                             "width": int(frame["width"]), "height": int(frame["height"])})
+
+        lines = []
+        for annotation in frame["annotations"]:
+            self._annotation_count += 1
+            entry = dict(annotation, id=self._annotation_count, image_id=image_id)
+            self._categories.setdefault(entry["category_id"], str(entry["category_id"]))
+            prefix = ',\n' if self._annotation_count > 1 else '\n'
+            lines.append(prefix + json.dumps(entry, separators=(',', ':')))
+        self._file.write(''.join(lines).encode('utf-8'))
+        return image_id
+
+    def close(self):
+        """Write the image and category lists and close the file"""
+        if self._file is None:
+            return
+        categories = [{"id": class_id, "name": name} for class_id, name in sorted(self._categories.items())]
+        closing = ('\n], "images": ' + json.dumps(self._images, separators=(',', ':')) +
+                   ', "categories": ' + json.dumps(categories, separators=(',', ':')) +
+                   ', "info": ' + json.dumps({"annotation_count": self._annotation_count}) + '}')
+        self._file.write(closing.encode('utf-8'))
+        self._file.close()
+        self._file = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.close()
+
+
+class RadiationJob:
+    """
+    Handle to a radiation simulation running on a background native thread.
+
+    Returned by RadiationModel.runBandAsync(). The run reports a progress fraction
+    and can be cancelled; cancellation takes effect at the next ray-tracing stage.
+    wait() writes the "radiation_flux_<band>" primitive data of the finished bands into
+    the Context, and raises the error of a run that failed or was cancelled.
+    """
+
+    def __init__(self, handle, bands: List[str]):
+        self._handle = handle
+        self._error = None
+        self.bands = list(bands)
+
+    def poll(self) -> bool:
+        """Return True if the run has finished, without blocking."""
+        if self._handle is None:
+            return True
+        return cpu_radiation_wrapper.pollRadiationJob(self._handle)
+
+    @property
+    def done(self) -> bool:
+        """True once the run has finished (successfully, with an error, or cancelled)."""
+        return self.poll()
+
+    @property
+    def progress(self) -> float:
+        """Completed fraction of the run, from 0 to 1."""
+        if self._handle is None:
+            return 1.0 if self._error is None else 0.0
+        return cpu_radiation_wrapper.getRadiationJobProgress(self._handle)
+
+    def wait(self, timeout: Optional[float] = None) -> bool:
+        """
+        Block until the run finishes.
+
+        Args:
+            timeout: Maximum time to wait in seconds (None waits indefinitely)
+
+        Returns:
+            True if the run finished, False if the timeout expired first
+
+        Raises:
+            RadiationModelError: If the run failed or was cancelled
+        """
+        if self._handle is None:
+            if self._error is not None:
+                raise self._error
+            return True
+        try:
+            if not cpu_radiation_wrapper.waitRadiationJob(self._handle, timeout):
+                return False
+        except HeliosError as e:
+            self._error = RadiationModelError(f"Radiation run for bands {self.bands} failed: {e}")
+            self._release()
+            raise self._error
+        self._release()
+        logger.info(f"Completed asynchronous radiation simulation for bands: {self.bands}")
+        return True
+
+    def cancel(self):
+        """Request cancellation; call wait() to block until the run has stopped."""
+        if self._handle is not None:
+            cpu_radiation_wrapper.cancelRadiationJob(self._handle)
+
+    def _release(self):
+        """Free the native job, cancelling and joining the run if still going."""
+        handle, self._handle = self._handle, None
+        if handle is not None:
+            cpu_radiation_wrapper.destroyRadiationJob(handle)
+
+    def __del__(self):
+        try:
+            self._release()
+        except Exception:
+            pass
+
+
 class RadiationModel:
     """
     High-level interface for radiation modeling and ray tracing.
@@ -168,23 +440,50 @@ class RadiationModel:
     graceful error handling.
     """
     
-    def __init__(self, context: Context):
+    def __init__(self, context: Context, backend: str = "optix"):
         """
         Initialize RadiationModel with graceful plugin handling.
         
         Args:
             context: Helios Context instance
+            backend: "optix" (default) for the GPU radiation plugin, or "cpu" for the
+                     multithreaded CPU ray tracer, which needs no CUDA/OptiX. The CPU
+                     backend supports collimated, sphere and sun-sphere sources, diffuse
+                     flux, emission, scattering, bands with wavelength bounds (spectral
+                     reflectivity/transmissivity averaged over the band), and radiation
+                     cameras rendered in memory, in batches (renderCameras) or tile by
+                     tile (renderCameraTiles). It does not write camera image files or
+                     produce image annotations (bounding boxes, segmentation masks).
             
         Raises:
             TypeError: If context is not a Context instance
-            RadiationModelError: If radiation plugin is not available
+            ValueError: If backend is not "optix" or "cpu"
+            RadiationModelError: If the selected backend is not available
         """
         # Validate context type
         if not isinstance(context, Context):
             raise TypeError(f"RadiationModel requires a Context instance, got {type(context).__name__}")
+        if backend not in RADIATION_BACKENDS:
+            raise ValueError(f"Radiation backend must be one of {RADIATION_BACKENDS}, got {backend!r}")
         
         self.context = context
         self.radiation_model = None
+        self._backend = backend
+        self._active_job = None
+        self._wrapper = cpu_radiation_wrapper if backend == "cpu" else radiation_wrapper
+        
+        if backend == "cpu":
+            if not cpu_radiation_wrapper._CPU_RADIATION_FUNCTIONS_AVAILABLE:
+                raise RadiationModelError(
+                    "The CPU radiation backend is not available in the loaded native library. "
+                    "Rebuild PyHelios with the updated C++ wrapper implementation."
+                )
+            try:
+                self.radiation_model = cpu_radiation_wrapper.createRadiationModel(context.getNativePtr())
+            except Exception as e:
+                raise RadiationModelError(f"Failed to initialize CPU RadiationModel: {e}")
+            logger.info("RadiationModel created successfully (CPU backend)")
+            return
         
         # Check plugin availability using registry
         registry = get_plugin_registry()
@@ -237,9 +536,15 @@ class RadiationModel:
     
     def __exit__(self, exc_type, exc_value, traceback):
         """Context manager exit with proper cleanup."""
+        if self._active_job is not None:
+            try:
+                self._active_job._release()
+            except Exception as e:
+                logger.warning(f"Error stopping asynchronous radiation run: {e}")
+            self._active_job = None
         if self.radiation_model is not None:
             try:
-                radiation_wrapper.destroyRadiationModel(self.radiation_model)
+                self._wrapper.destroyRadiationModel(self.radiation_model)
                 logger.debug("RadiationModel destroyed successfully")
             except Exception as e:
                 logger.warning(f"Error destroying RadiationModel: {e}")
@@ -248,41 +553,235 @@ class RadiationModel:
         """Get native pointer for advanced operations."""
         return self.radiation_model
     
+    def getBackend(self) -> str:
+        """Get the ray-tracing backend of this model ("optix" or "cpu")."""
+        return self._backend
+    
+    @require_cpu_backend
+    def setThreadCount(self, num_threads: int):
+        """
+        Set the number of worker threads used by the CPU backend.
+        
+        Args:
+            num_threads: Number of threads (0 = all available cores)
+        """
+        if not isinstance(num_threads, int) or num_threads < 0:
+            raise ValueError(f"num_threads must be a non-negative integer, got {num_threads}")
+        cpu_radiation_wrapper.setThreadCount(self.radiation_model, num_threads)
+    
+    @require_cpu_backend
+    def setScatteringTolerance(self, band_label: str, tolerance: float):
+        """
+        Stop scattering iterations early once little energy is left to scatter (CPU backend only).
+        
+        After each scattering pass, the band stops scattering if the power reflected or transmitted in
+        that pass is at most tolerance times the power injected by sources, sky and emission.
+        setScatteringDepth() remains the upper bound. The passes run and the final residual are
+        reported by getRadiationBandStats().
+        
+        Args:
+            band_label: Radiation band label
+            tolerance: Relative residual, e.g. 1e-3 (0 = always run to the scattering depth)
+        """
+        validate_band_label(band_label, "band_label", "setScatteringTolerance")
+        if tolerance < 0:
+            raise ValueError(f"tolerance must be non-negative, got {tolerance}")
+        cpu_radiation_wrapper.setScatteringTolerance(self.radiation_model, band_label, float(tolerance))
+    
+    @require_cpu_backend
+    def setAdaptiveRayCount(self, band_label: str, target_error: float, max_ray_count: int):
+        """
+        Trace a band in rounds until a target accuracy or a ray budget is reached (CPU backend only).
+        
+        Each round traces the band's direct and diffuse ray counts with independent samples and the
+        result is the mean over rounds. Tracing stops once the area-weighted relative standard error
+        of the absorbed flux is at most target_error (after at least two rounds), or when the next
+        round would exceed max_ray_count direct or diffuse rays per primitive. The achieved error is
+        reported by getRadiationBandStats().
+        
+        Args:
+            band_label: Radiation band label
+            target_error: Target relative error, e.g. 0.01 for 1% (0 restores fixed ray counts)
+            max_ray_count: Ray budget per primitive summed over rounds
+        """
+        validate_band_label(band_label, "band_label", "setAdaptiveRayCount")
+        if target_error < 0:
+            raise ValueError(f"target_error must be non-negative, got {target_error}")
+        if not isinstance(max_ray_count, int) or (target_error > 0 and max_ray_count <= 0):
+            raise ValueError(f"max_ray_count must be a positive integer, got {max_ray_count}")
+        cpu_radiation_wrapper.setAdaptiveRayCount(self.radiation_model, band_label, float(target_error), max_ray_count)
+    
+    @require_cpu_backend
+    def getRadiationBandStats(self, band_label: str) -> dict:
+        """
+        Get sampling statistics of the last run of a band (CPU backend only).
+        
+        Returns:
+            Dict with "rounds", "direct_rays" (per primitive and source), "diffuse_rays" (per primitive
+            face), "relative_error" (area-weighted relative standard error, -1 if fewer than two
+            rounds were traced), "scattering_passes" and "scattering_residual" (power scattered but
+            not traced further, relative to the injected power)
+        """
+        validate_band_label(band_label, "band_label", "getRadiationBandStats")
+        return cpu_radiation_wrapper.getRadiationBandStats(self.radiation_model, band_label)
+    
+    @require_cpu_backend
+    def enableFluxSuperposition(self):
+        """
+        Cache per-source unit-flux responses on the next runBand() (CPU backend only).
+        
+        Absorbed flux is linear in source and diffuse flux. With superposition enabled, runBand()
+        traces each source and the sky at unit flux, and later calls to setSourceFlux(),
+        setSourceFluxMultiple() or setDiffuseRadiationFlux() update getTotalAbsorbedFlux() and the
+        "radiation_flux_<band>" primitive data as a weighted sum, without re-tracing. Changing
+        geometry, optical properties, temperatures or other band settings still requires runBand().
+        The min_scatter_energy cutoff is not applied while superposition is enabled.
+        
+        Example:
+            >>> radiation_model.enableFluxSuperposition()
+            >>> radiation_model.runBand("SW")
+            >>> for direct in [200.0, 400.0, 800.0]:
+            ...     radiation_model.setSourceFlux(sun, "SW", direct)
+            ...     flux = radiation_model.getTotalAbsorbedFlux()
+        """
+        cpu_radiation_wrapper.enableFluxSuperposition(self.radiation_model)
+    
+    @require_cpu_backend
+    def disableFluxSuperposition(self):
+        """Stop caching unit-flux responses and drop the cached ones (CPU backend only)."""
+        cpu_radiation_wrapper.disableFluxSuperposition(self.radiation_model)
+    
+    @require_cpu_backend
+    def enableViewFactorOperator(self, tolerance: float = 1e-4, max_memory_mb: Optional[float] = None):
+        """
+        Precompute a sparse diffuse exchange operator for static scenes (CPU backend only).
+        
+        The next runBand() traces every primitive face once and stores the fraction of its emitted
+        or scattered power reaching every other face, plus its sky view. Later runs solve sky diffuse
+        and scattering/emission passes with sparse matrix-vector products instead of tracing, so
+        changes to setDiffuseRadiationFlux() or "temperature" data are cheap. Direct radiation from
+        sources is still traced. The operator is dropped by updateGeometry(). Bands with adaptive
+        ray counts (setAdaptiveRayCount) keep tracing diffuse radiation, so their reported error
+        also covers diffuse sampling.
+        
+        Args:
+            tolerance: Exchange fractions below this are not stored
+            max_memory_mb: Memory cap in MB, enforced while the operator is built; only the largest
+                fractions are kept (None = no cap)
+        """
+        if tolerance < 0:
+            raise ValueError(f"tolerance must be non-negative, got {tolerance}")
+        if max_memory_mb is not None and max_memory_mb <= 0:
+            raise ValueError(f"max_memory_mb must be positive, got {max_memory_mb}")
+        max_bytes = 0 if max_memory_mb is None else int(max_memory_mb * 1024 * 1024)
+        cpu_radiation_wrapper.enableViewFactorOperator(self.radiation_model, float(tolerance), max_bytes)
+    
+    @require_cpu_backend
+    def disableViewFactorOperator(self):
+        """Drop the exchange operator and trace diffuse radiation again (CPU backend only)."""
+        cpu_radiation_wrapper.disableViewFactorOperator(self.radiation_model)
+    
+    @require_cpu_backend
+    def getViewFactorOperatorInfo(self) -> dict:
+        """
+        Get the memory footprint of the exchange operator (CPU backend only).
+        
+        Returns:
+            Dict with "bytes" and "nonzeros" (both 0 if no operator has been built)
+        """
+        return cpu_radiation_wrapper.getViewFactorOperatorInfo(self.radiation_model)
+
+    @require_cpu_backend
+    def precomputeSunlitFractions(self, directions, ray_count: int = 100, max_angle: float = 0.5):
+        """
+        Precompute the sunlit fraction of every primitive for a set of sun directions (CPU backend only).
+
+        For static geometry, all sun positions of a day (or the bins of a sky dome) are traced in one
+        batched pass: each primitive samples ray_count points once and tests every direction. The
+        fractions are stored quantized to 8 bits, one byte per primitive and direction. Later runBand()
+        calls serve collimated sources within max_angle of a cached direction from the cache,
+        interpolating between the two nearest cached directions, instead of tracing direct rays.
+        Other sources, diffuse radiation and scattering are traced as usual. The cache is dropped
+        by updateGeometry().
+
+        Args:
+            directions: Sun directions (tuple, vec3 or SphericalCoord, pointing toward the sun), given
+                        the same way as to addCollimatedRadiationSource()
+            ray_count: Sample points per primitive
+            max_angle: Largest angle in degrees between a source and a cached direction that is
+                       served from the cache
+
+        Example:
+            >>> sun_path = [sun_direction(hour) for hour in range(24)]
+            >>> radiation_model.precomputeSunlitFractions(sun_path)
+            >>> for hour, direction in enumerate(sun_path):
+            ...     sun = radiation_model.addCollimatedRadiationSource(direction)
+            ...     radiation_model.setSourceFlux(sun, "SW", direct_flux[hour])
+            ...     radiation_model.runBand("SW")  # direct beam read from the cache
+            ...     radiation_model.setSourceFlux(sun, "SW", 0.0)
+        """
+        if not isinstance(ray_count, int) or ray_count <= 0:
+            raise ValueError("ray_count must be a positive integer")
+        if max_angle < 0:
+            raise ValueError("max_angle must be non-negative")
+        components = [_direction_components(direction) for direction in directions]
+        if not components:
+            raise ValueError("At least one sun direction is required")
+        import math
+        cpu_radiation_wrapper.precomputeSunlitFractions(self.radiation_model, components, ray_count, math.radians(max_angle))
+
+    @require_cpu_backend
+    def clearSunlitFractions(self):
+        """Drop the sunlit fraction cache and trace every source again (CPU backend only)."""
+        cpu_radiation_wrapper.clearSunlitFractions(self.radiation_model)
+
+    @require_cpu_backend
+    def getSunlitFractionBytes(self) -> int:
+        """Get the memory used by the sunlit fraction cache in bytes, 0 if none is built (CPU backend only)."""
+        return cpu_radiation_wrapper.getSunlitFractionBytes(self.radiation_model)
+    
     def getNativePtr(self):
         """Get native pointer for advanced operations. (Legacy naming for compatibility)"""
         return self.get_native_ptr()
     
-    @require_plugin('radiation', 'disable status messages')
+    @require_radiation_backend('disable status messages')
     def disableMessages(self):
         """Disable RadiationModel status messages."""
-        radiation_wrapper.disableMessages(self.radiation_model)
+        self._wrapper.disableMessages(self.radiation_model)
     
-    @require_plugin('radiation', 'enable status messages')
+    @require_radiation_backend('enable status messages')
     def enableMessages(self):
         """Enable RadiationModel status messages."""
-        radiation_wrapper.enableMessages(self.radiation_model)
+        self._wrapper.enableMessages(self.radiation_model)
     
-    @require_plugin('radiation', 'add radiation band')
+    @require_radiation_backend('add radiation band')
     def addRadiationBand(self, band_label: str, wavelength_min: float = None, wavelength_max: float = None):
         """
         Add radiation band with optional wavelength bounds.
         
+        With wavelength bounds, primitives without "reflectivity_<band>" / "transmissivity_<band>"
+        data use the band average of the spectra named by their "reflectivity_spectrum" /
+        "transmissivity_spectrum" string data (Context global data of (wavelength, value) pairs),
+        weighted by the source spectrum (see setSourceSpectrum). With backend='cpu', band averages
+        come from a cache of cumulative spectral integrals shared by all bands, so sweeping many
+        narrow bands over the same spectra does not repeat the integration.
+        
         Args:
             band_label: Name/label for the radiation band
-            wavelength_min: Optional minimum wavelength (μm)
-            wavelength_max: Optional maximum wavelength (μm)
+            wavelength_min: Optional minimum wavelength (nm)
+            wavelength_max: Optional maximum wavelength (nm)
         """
         # Validate inputs
         validate_band_label(band_label, "band_label", "addRadiationBand")
         if wavelength_min is not None and wavelength_max is not None:
             validate_wavelength_range(wavelength_min, wavelength_max, "wavelength_min", "wavelength_max", "addRadiationBand")
-            radiation_wrapper.addRadiationBandWithWavelengths(self.radiation_model, band_label, wavelength_min, wavelength_max)
+            self._wrapper.addRadiationBandWithWavelengths(self.radiation_model, band_label, wavelength_min, wavelength_max)
             logger.debug(f"Added radiation band {band_label}: {wavelength_min}-{wavelength_max} μm")
         else:
-            radiation_wrapper.addRadiationBand(self.radiation_model, band_label)
+            self._wrapper.addRadiationBand(self.radiation_model, band_label)
             logger.debug(f"Added radiation band: {band_label}")
     
-    @require_plugin('radiation', 'copy radiation band')
+    @require_radiation_backend('copy radiation band')
     @validate_radiation_band_params
     def copyRadiationBand(self, old_label: str, new_label: str):
         """
@@ -292,10 +791,10 @@ class RadiationModel:
             old_label: Existing band label to copy
             new_label: New label for the copied band
         """
-        radiation_wrapper.copyRadiationBand(self.radiation_model, old_label, new_label)
+        self._wrapper.copyRadiationBand(self.radiation_model, old_label, new_label)
         logger.debug(f"Copied radiation band {old_label} to {new_label}")
     
-    @require_plugin('radiation', 'add radiation source')
+    @require_radiation_backend('add radiation source')
     @validate_collimated_source_params
     def addCollimatedRadiationSource(self, direction=None) -> int:
         """
@@ -308,36 +807,15 @@ class RadiationModel:
             Source ID
         """
         if direction is None:
-            source_id = radiation_wrapper.addCollimatedRadiationSourceDefault(self.radiation_model)
+            source_id = self._wrapper.addCollimatedRadiationSourceDefault(self.radiation_model)
         else:
-            # Handle vec3, SphericalCoord, and tuple types
-            if hasattr(direction, 'x') and hasattr(direction, 'y') and hasattr(direction, 'z'):
-                # vec3-like object
-                x, y, z = direction.x, direction.y, direction.z
-            elif hasattr(direction, 'radius') and hasattr(direction, 'elevation') and hasattr(direction, 'azimuth'):
-                # SphericalCoord object - convert to Cartesian
-                import math
-                r = direction.radius
-                elevation = direction.elevation
-                azimuth = direction.azimuth
-                x = r * math.cos(elevation) * math.cos(azimuth)
-                y = r * math.cos(elevation) * math.sin(azimuth)
-                z = r * math.sin(elevation)
-            else:
-                # Assume tuple-like object - validate it first
-                try:
-                    if len(direction) != 3:
-                        raise TypeError(f"Direction must be a 3-element tuple, vec3, or SphericalCoord, got {type(direction).__name__} with {len(direction)} elements")
-                    x, y, z = direction
-                except (TypeError, AttributeError):
-                    # Not a valid sequence type
-                    raise TypeError(f"Direction must be a tuple, vec3, or SphericalCoord, got {type(direction).__name__}")
-            source_id = radiation_wrapper.addCollimatedRadiationSourceVec3(self.radiation_model, x, y, z)
+            x, y, z = _direction_components(direction)
+            source_id = self._wrapper.addCollimatedRadiationSourceVec3(self.radiation_model, x, y, z)
         
         logger.debug(f"Added collimated radiation source: ID {source_id}")
         return source_id
     
-    @require_plugin('radiation', 'add spherical radiation source')
+    @require_radiation_backend('add spherical radiation source')
     @validate_sphere_source_params
     def addSphereRadiationSource(self, position, radius: float) -> int:
         """
@@ -357,11 +835,11 @@ class RadiationModel:
         else:
             # Assume tuple-like object
             x, y, z = position
-        source_id = radiation_wrapper.addSphereRadiationSource(self.radiation_model, x, y, z, radius)
+        source_id = self._wrapper.addSphereRadiationSource(self.radiation_model, x, y, z, radius)
         logger.debug(f"Added sphere radiation source: ID {source_id} at ({x}, {y}, {z}) with radius {radius}")
         return source_id
     
-    @require_plugin('radiation', 'add sun radiation source')
+    @require_radiation_backend('add sun radiation source')
     @validate_sun_sphere_params
     def addSunSphereRadiationSource(self, radius: float, zenith: float, azimuth: float,
                                     position_scaling: float = 1.0, angular_width: float = 0.53,
@@ -370,44 +848,50 @@ class RadiationModel:
         Add sun sphere radiation source.
         
         Args:
-            radius: Radius of the sun sphere
+            radius: Radius of the sun sphere (ignored by the CPU backend)
             zenith: Zenith angle (degrees)
             azimuth: Azimuth angle (degrees)
-            position_scaling: Position scaling factor
+            position_scaling: Position scaling factor (ignored by the CPU backend)
             angular_width: Angular width of the sun (degrees)
             flux_scaling: Flux scaling factor
             
         Returns:
             Source ID
         """
-        source_id = radiation_wrapper.addSunSphereRadiationSource(
-            self.radiation_model, radius, zenith, azimuth, position_scaling, angular_width, flux_scaling
-        )
+        if self._backend == "cpu":
+            # The CPU backend treats the sun as a direction at infinity
+            source_id = self._wrapper.addSunSphereRadiationSource(
+                self.radiation_model, zenith, azimuth, angular_width, flux_scaling
+            )
+        else:
+            source_id = self._wrapper.addSunSphereRadiationSource(
+                self.radiation_model, radius, zenith, azimuth, position_scaling, angular_width, flux_scaling
+            )
         logger.debug(f"Added sun radiation source: ID {source_id}")
         return source_id
     
-    @require_plugin('radiation', 'set ray count')
+    @require_radiation_backend('set ray count')
     def setDirectRayCount(self, band_label: str, ray_count: int):
         """Set direct ray count for radiation band."""
         validate_band_label(band_label, "band_label", "setDirectRayCount")
         validate_ray_count(ray_count, "ray_count", "setDirectRayCount")
-        radiation_wrapper.setDirectRayCount(self.radiation_model, band_label, ray_count)
+        self._wrapper.setDirectRayCount(self.radiation_model, band_label, ray_count)
     
-    @require_plugin('radiation', 'set ray count')
+    @require_radiation_backend('set ray count')
     def setDiffuseRayCount(self, band_label: str, ray_count: int):
         """Set diffuse ray count for radiation band."""
         validate_band_label(band_label, "band_label", "setDiffuseRayCount")
         validate_ray_count(ray_count, "ray_count", "setDiffuseRayCount")
-        radiation_wrapper.setDiffuseRayCount(self.radiation_model, band_label, ray_count)
+        self._wrapper.setDiffuseRayCount(self.radiation_model, band_label, ray_count)
     
-    @require_plugin('radiation', 'set radiation flux')
+    @require_radiation_backend('set radiation flux')
     def setDiffuseRadiationFlux(self, label: str, flux: float):
         """Set diffuse radiation flux for band."""
         validate_band_label(label, "label", "setDiffuseRadiationFlux")
         validate_flux_value(flux, "flux", "setDiffuseRadiationFlux")
-        radiation_wrapper.setDiffuseRadiationFlux(self.radiation_model, label, flux)
+        self._wrapper.setDiffuseRadiationFlux(self.radiation_model, label, flux)
     
-    @require_plugin('radiation', 'set source flux')
+    @require_radiation_backend('set source flux')
     def setSourceFlux(self, source_id, label: str, flux: float):
         """Set source flux for single source or multiple sources."""
         validate_band_label(label, "label", "setSourceFlux")
@@ -416,20 +900,42 @@ class RadiationModel:
         if isinstance(source_id, (list, tuple)):
             # Multiple sources
             validate_source_id_list(list(source_id), "source_id", "setSourceFlux")
-            radiation_wrapper.setSourceFluxMultiple(self.radiation_model, source_id, label, flux)
+            self._wrapper.setSourceFluxMultiple(self.radiation_model, source_id, label, flux)
         else:
             # Single source
             validate_source_id(source_id, "source_id", "setSourceFlux")
-            radiation_wrapper.setSourceFlux(self.radiation_model, source_id, label, flux)
+            self._wrapper.setSourceFlux(self.radiation_model, source_id, label, flux)
     
     
-    @require_plugin('radiation', 'get source flux')
+    @require_radiation_backend('get source flux')
     @validate_get_source_flux_params
     def getSourceFlux(self, source_id: int, label: str) -> float:
         """Get source flux for band."""
-        return radiation_wrapper.getSourceFlux(self.radiation_model, source_id, label)
+        return self._wrapper.getSourceFlux(self.radiation_model, source_id, label)
+
+    @require_radiation_backend('set source spectrum')
+    def setSourceSpectrum(self, source_id: int, spectrum_label: str):
+        """
+        Set the spectrum of a radiation source.
+
+        Spectral optical properties of wavelength-bounded bands are averaged over the band weighted
+        by this spectrum. With backend='cpu', the first source with a spectrum is used for all bands,
+        an empty label restores a flat spectrum, and source fluxes are still set per band.
+
+        Args:
+            source_id: ID of the radiation source
+            spectrum_label: Context global data label of the spectrum ((wavelength in nm, value) pairs)
+
+        Example:
+            >>> context.loadXML("spectra.xml")  # defines <globaldata_vec2 label="solar_spectrum">
+            >>> radiation.setSourceSpectrum(sun, "solar_spectrum")
+        """
+        validate_source_id(source_id, "source_id", "setSourceSpectrum")
+        if not isinstance(spectrum_label, str):
+            raise TypeError(f"Spectrum label must be a string, got {type(spectrum_label).__name__}")
+        self._wrapper.setSourceSpectrum(self.radiation_model, source_id, spectrum_label)
     
-    @require_plugin('radiation', 'update geometry')
+    @require_radiation_backend('update geometry')
     @validate_update_geometry_params
     def updateGeometry(self, uuids: Optional[List[int]] = None):
         """
@@ -439,13 +945,34 @@ class RadiationModel:
             uuids: Optional list of specific UUIDs to update. If None, updates all geometry.
         """
         if uuids is None:
-            radiation_wrapper.updateGeometry(self.radiation_model)
+            self._wrapper.updateGeometry(self.radiation_model)
             logger.debug("Updated all geometry in radiation model")
         else:
-            radiation_wrapper.updateGeometryUUIDs(self.radiation_model, uuids)
+            self._wrapper.updateGeometryUUIDs(self.radiation_model, uuids)
             logger.debug(f"Updated {len(uuids)} geometry UUIDs in radiation model")
     
-    @require_plugin('radiation', 'run radiation simulation')
+    @require_radiation_backend('update geometry')
+    def updateGeometryIfChanged(self) -> bool:
+        """
+        Update geometry in the radiation model only if primitives changed.
+
+        Compares the Context against the primitives captured at this model's last
+        geometry update (added, modified or deleted UUIDs). If the last update was
+        given an explicit UUID list, that list stays the scope.
+
+        On the OptiX backend the saving applies only to calls where nothing in scope
+        changed: any change re-uploads the whole scope, exactly like updateGeometry().
+        On the CPU backend only the changed primitives are updated (moved vertices
+        refit the scene in place, and only added primitives are read from the Context).
+
+        Returns:
+            True if the geometry was updated, False if nothing changed and the update was skipped
+        """
+        updated = self._wrapper.updateGeometryIfChanged(self.radiation_model)
+        logger.debug(f"Geometry update if changed: {'updated' if updated else 'skipped'}")
+        return updated
+
+    @require_radiation_backend('run radiation simulation')
     @validate_run_band_params
     def runBand(self, band_label):
         """
@@ -478,53 +1005,282 @@ class RadiationModel:
             for lbl in band_label:
                 if not isinstance(lbl, str):
                     raise TypeError(f"Band labels must be strings, got {type(lbl).__name__}")
-            radiation_wrapper.runBandMultiple(self.radiation_model, band_label)
+            self._wrapper.runBandMultiple(self.radiation_model, band_label)
             logger.info(f"Completed radiation simulation for bands: {band_label}")
         else:
             # Single band - validate label type
             if not isinstance(band_label, str):
                 raise TypeError(f"Band label must be a string, got {type(band_label).__name__}")
-            radiation_wrapper.runBand(self.radiation_model, band_label)
+            self._wrapper.runBand(self.radiation_model, band_label)
             logger.info(f"Completed radiation simulation for band: {band_label}")
     
     
-    @require_plugin('radiation', 'get simulation results')
+    @require_cpu_backend
+    @validate_run_band_params
+    def runBandAsync(self, band_label) -> RadiationJob:
+        """
+        Start a radiation simulation on a background thread and return immediately.
+
+        The returned RadiationJob reports progress and supports poll(), wait(timeout)
+        and cancel(). Optical properties and temperatures are read from the Context before
+        this returns, and the background thread never touches the Context, so it stays
+        usable meanwhile. wait() writes the "radiation_flux_<band>" primitive data on the
+        calling thread; results are then read from the model as usual. Only one run may be
+        in progress per model, and other RadiationModel methods raise until it has finished.
+
+        Example:
+            job = radiation.runBandAsync(["PAR", "NIR"])
+            while not job.wait(timeout=1.0):
+                print(f"{job.progress:.0%}")
+            flux = radiation.getTotalAbsorbedFluxArray()
+
+        Args:
+            band_label: Single band name (str) or list of band names
+
+        Returns:
+            RadiationJob handle for the run
+
+        Raises:
+            RadiationModelError: If the backend is not 'cpu', a band does not exist or a run is already in progress
+        """
+        bands = list(band_label) if isinstance(band_label, (list, tuple)) else [band_label]
+        try:
+            handle = cpu_radiation_wrapper.runBandAsync(self.radiation_model, bands)
+        except HeliosError as e:
+            raise RadiationModelError(f"Failed to start radiation run for bands {bands}: {e}")
+        self._active_job = RadiationJob(handle, bands)
+        logger.info(f"Started asynchronous radiation simulation for bands: {bands}")
+        return self._active_job
+
+    def _check_no_active_job(self):
+        """Raise if an asynchronous run started by runBandAsync() is still going; finish one that has stopped."""
+        job = self._active_job
+        if job is None:
+            return
+        if not job.done:
+            raise RadiationModelError(
+                f"A radiation run for bands {job.bands} is still in progress; "
+                "wait() for or cancel() the RadiationJob first"
+            )
+        self._active_job = None
+        if job._handle is not None:
+            # The run was never waited for: wait() writes its results into the Context
+            try:
+                job.wait()
+            except RadiationModelError as e:
+                logger.warning(str(e))
+
+    @require_radiation_backend('get simulation results')
     def getTotalAbsorbedFlux(self) -> List[float]:
         """Get total absorbed flux for all primitives."""
-        results = radiation_wrapper.getTotalAbsorbedFlux(self.radiation_model)
+        results = self._wrapper.getTotalAbsorbedFlux(self.radiation_model)
         logger.debug(f"Retrieved absorbed flux data for {len(results)} primitives")
         return results
     
+    @require_radiation_backend('get simulation results')
+    def getTotalAbsorbedFluxArray(self, out: Optional[np.ndarray] = None) -> np.ndarray:
+        """
+        Get total absorbed flux for all primitives as a float32 NumPy array.
+        
+        Unlike getTotalAbsorbedFlux(), no Python list is built. Passing a preallocated
+        buffer lets repeated timesteps reuse the same memory.
+        
+        Args:
+            out: Optional contiguous float32 array with at least one entry per primitive.
+                 The flux is written into it and a view of the filled part is returned.
+            
+        Returns:
+            NumPy float32 array of absorbed flux per primitive
+            
+        Example:
+            >>> flux = np.empty(context.getPrimitiveCount(), dtype=np.float32)
+            >>> for hour in range(24):
+            ...     radiation.runBand(["PAR", "NIR"])
+            ...     radiation.getTotalAbsorbedFluxArray(out=flux)
+        """
+        results = self._wrapper.getTotalAbsorbedFluxArray(self.radiation_model, out)
+        logger.debug(f"Retrieved absorbed flux data for {results.size} primitives")
+        return results
+    
+    @require_radiation_backend('get simulation results')
+    def getAbsorbedFluxByBand(self, band_labels: List[str]) -> np.ndarray:
+        """
+        Get absorbed flux for several bands in one call.
+        
+        Args:
+            band_labels: List of band labels (e.g. ["PAR", "NIR", "LW", "SW"])
+            
+        Returns:
+            NumPy float32 array of shape (len(band_labels), primitive_count). Columns follow
+            Context.getAllUUIDs() order; primitives without flux for a band report 0.
+        """
+        for label in band_labels:
+            validate_band_label(label, "band_labels", "getAbsorbedFluxByBand")
+        results = self._wrapper.getAbsorbedFluxBands(self.radiation_model, self.context.getNativePtr(), band_labels)
+        logger.debug(f"Retrieved absorbed flux data for {results.shape[0]} bands x {results.shape[1]} primitives")
+        return results
+
+    @staticmethod
+    def _flux_groups(power: np.ndarray, area: np.ndarray) -> dict:
+        """Package per-group power and area sums with the area-weighted mean flux"""
+        mean = np.divide(power, area, out=np.zeros_like(power), where=area > 0)
+        return {"power": power, "area": area, "mean_flux": mean}
+
+    @require_radiation_backend('get simulation results')
+    def aggregateAbsorbedFlux(self, band_label: str, groups, uuids: Optional[List[int]] = None) -> dict:
+        """
+        Sum the absorbed flux of one band over arbitrary groups of primitives in a single native call.
+
+        Replaces per-group loops over getPrimitiveData/getObjectPrimitiveUUIDs after each run. Primitives
+        without flux from the last run of the band (e.g. outside the geometry passed to updateGeometry)
+        are left out.
+
+        Args:
+            band_label: Band label
+            groups: Non-negative group index of each primitive in uuids
+            uuids: Primitives to aggregate (default: Context.getAllUUIDs(), in that order)
+
+        Returns:
+            Dict of float64 arrays with one entry per group index (0 .. max(groups)):
+            "power" (absorbed power, flux times area summed, W), "area" (summed area, m^2) and
+            "mean_flux" (area-weighted mean absorbed flux, W/m^2; 0 for empty groups)
+
+        Example:
+            >>> # Sunlit vs. shaded leaves, grouped by a primitive data flag read once per timestep
+            >>> result = radiation.aggregateAbsorbedFlux("PAR", shaded_flags)
+            >>> print(result["mean_flux"])
+        """
+        validate_band_label(band_label, "band_label", "aggregateAbsorbedFlux")
+        if uuids is None:
+            uuids = self.context.getAllUUIDs()
+        uuid_array = np.ascontiguousarray(uuids, dtype=np.uint32)
+        group_array = np.asarray(groups)
+        if group_array.shape != uuid_array.shape:
+            raise ValueError(f"Expected one group index per primitive ({uuid_array.size}), got {group_array.size}")
+        if group_array.size > 0 and group_array.min() < 0:
+            raise ValueError("Group indices must be non-negative")
+        group_array = np.ascontiguousarray(group_array, dtype=np.uint32)
+        group_count = int(group_array.max()) + 1 if group_array.size > 0 else 0
+
+        power, area = self._wrapper.aggregateAbsorbedFlux(self.radiation_model, self.context.getNativePtr(), band_label,
+                                                          uuid_array, group_array, group_count)
+        return self._flux_groups(power, area)
+
+    @require_radiation_backend('get simulation results')
+    def aggregateAbsorbedFluxByObject(self, band_label: str) -> dict:
+        """
+        Sum the absorbed flux of one band per Context object (e.g. per leaf or per tile object).
+
+        Args:
+            band_label: Band label
+
+        Returns:
+            Dict of arrays with one entry per object that has flux, in ascending ID order:
+            "object_ids" (uint32), "power" (W), "area" (m^2) and "mean_flux" (W/m^2)
+
+        Example:
+            >>> leaves = radiation.aggregateAbsorbedFluxByObject("PAR")
+            >>> for obj, flux in zip(leaves["object_ids"], leaves["mean_flux"]):
+            ...     print(obj, flux)
+        """
+        validate_band_label(band_label, "band_label", "aggregateAbsorbedFluxByObject")
+        object_ids, power, area = self._wrapper.aggregateAbsorbedFluxByObject(self.radiation_model, self.context.getNativePtr(), band_label)
+        result = self._flux_groups(power, area)
+        result["object_ids"] = object_ids
+        return result
+
+    @require_radiation_backend('get simulation results')
+    def aggregateAbsorbedFluxByPlant(self, band_label: str, plant_architecture, plant_ids: List[int]) -> dict:
+        """
+        Sum the absorbed flux of one band per PlantArchitecture plant.
+
+        The plant membership is gathered with one call per plant; the reduction itself is one native call.
+
+        Args:
+            band_label: Band label
+            plant_architecture: PlantArchitecture instance that built the plants
+            plant_ids: Plants to aggregate
+
+        Returns:
+            Dict of float64 arrays with one entry per plant in plant_ids order:
+            "plant_ids", "power" (W), "area" (m^2) and "mean_flux" (W/m^2)
+
+        Example:
+            >>> plant_ids = plantarch.buildPlantCanopyFromLibrary([0, 0, 0], [0.5, 0.5], [3, 3], 30.0)
+            >>> radiation.runBand("PAR")
+            >>> plants = radiation.aggregateAbsorbedFluxByPlant("PAR", plantarch, plant_ids)
+        """
+        uuids = []
+        groups = []
+        for index, plant_id in enumerate(plant_ids):
+            plant_uuids = plant_architecture.getAllPlantUUIDs(plant_id)
+            uuids.extend(plant_uuids)
+            groups.extend([index] * len(plant_uuids))
+
+        result = self.aggregateAbsorbedFlux(band_label, groups, uuids=uuids)
+        # Plants without primitives still get an entry
+        for key in ("power", "area", "mean_flux"):
+            result[key] = np.pad(result[key], (0, len(plant_ids) - result[key].size))
+        result["plant_ids"] = np.asarray(plant_ids, dtype=np.uint32)
+        return result
+    
     # Configuration methods
-    @require_plugin('radiation', 'configure radiation simulation')
+    @require_radiation_backend('configure radiation simulation')
     @validate_scattering_depth_params
     def setScatteringDepth(self, label: str, depth: int):
         """Set scattering depth for radiation band."""
-        radiation_wrapper.setScatteringDepth(self.radiation_model, label, depth)
+        self._wrapper.setScatteringDepth(self.radiation_model, label, depth)
     
-    @require_plugin('radiation', 'configure radiation simulation')
+    @require_radiation_backend('configure radiation simulation')
     @validate_min_scatter_energy_params
     def setMinScatterEnergy(self, label: str, energy: float):
         """Set minimum scatter energy for radiation band."""
-        radiation_wrapper.setMinScatterEnergy(self.radiation_model, label, energy)
+        self._wrapper.setMinScatterEnergy(self.radiation_model, label, energy)
     
-    @require_plugin('radiation', 'configure radiation emission')
+    @require_radiation_backend('configure periodic boundaries')
+    def enforcePeriodicBoundary(self, boundary: str):
+        """
+        Make rays leaving the domain through its lateral sides re-enter from the opposite side.
+
+        Approximates an infinite canopy (e.g. a row crop) with one representative tile of geometry.
+        The period along each axis is the extent of the geometry along that axis, so the tile should
+        span exactly one period (for example one row spacing across rows). With backend='cpu', direct,
+        diffuse and scattered rays wrap around, camera rays do not, and an empty string disables the
+        boundaries again.
+
+        Args:
+            boundary: "x", "y" or "xy" (or "" to disable, CPU backend only)
+
+        Example:
+            >>> # One row of a row crop, periodic across and along the rows
+            >>> radiation_model.enforcePeriodicBoundary("xy")
+            >>> radiation_model.setScatteringDepth("SW", 3)
+            >>> radiation_model.updateGeometry()
+            >>> radiation_model.runBand("SW")
+        """
+        if boundary not in ("x", "y", "xy", ""):
+            raise ValueError(f"Periodic boundary must be 'x', 'y', 'xy' or '', got {boundary!r}")
+        if boundary == "" and self._backend != "cpu":
+            raise RadiationModelError("Periodic boundaries cannot be disabled with backend='optix'")
+        self._wrapper.enforcePeriodicBoundary(self.radiation_model, boundary)
+
+    @require_radiation_backend('configure radiation emission')
     def disableEmission(self, label: str):
         """Disable emission for radiation band."""
         validate_band_label(label, "label", "disableEmission")
-        radiation_wrapper.disableEmission(self.radiation_model, label)
+        self._wrapper.disableEmission(self.radiation_model, label)
     
-    @require_plugin('radiation', 'configure radiation emission')
+    @require_radiation_backend('configure radiation emission')
     def enableEmission(self, label: str):
         """Enable emission for radiation band."""
         validate_band_label(label, "label", "enableEmission")
-        radiation_wrapper.enableEmission(self.radiation_model, label)
+        self._wrapper.enableEmission(self.radiation_model, label)
     
     #=============================================================================
     # Camera and Image Functions (v1.3.47)
     #=============================================================================
 
-    @require_plugin('radiation', 'add radiation camera')
+    @require_radiation_backend('add radiation camera')
     def addRadiationCamera(self, camera_label: str, band_labels: List[str], position, lookat_or_direction,
                           camera_properties=None, antialiasing_samples: int = 100):
         """
@@ -590,7 +1346,7 @@ class RadiationModel:
                 else:
                     raise ValueError("SphericalCoord must have at least radius, elevation, and azimuth")
 
-                radiation_wrapper.addRadiationCameraSpherical(
+                self._wrapper.addRadiationCameraSpherical(
                     self.radiation_model,
                     validated_label,
                     validated_bands,
@@ -601,7 +1357,7 @@ class RadiationModel:
                 )
             else:
                 # vec3 case
-                radiation_wrapper.addRadiationCameraVec3(
+                self._wrapper.addRadiationCameraVec3(
                     self.radiation_model,
                     validated_label,
                     validated_bands,
@@ -614,7 +1370,7 @@ class RadiationModel:
         except Exception as e:
             raise RadiationModelError(f"Failed to add radiation camera '{validated_label}': {e}")
 
-    @require_plugin('radiation', 'write camera images')
+    @require_radiation_backend('write camera images', cpu_supported=False)
     def writeCameraImage(self, camera: str, bands: List[str], imagefile_base: str,
                           image_path: str = "./", frame: int = -1,
                           flux_to_pixel_conversion: float = 1.0) -> str:
@@ -652,14 +1408,14 @@ class RadiationModel:
         if not isinstance(flux_to_pixel_conversion, (int, float)) or flux_to_pixel_conversion <= 0:
             raise TypeError("Flux to pixel conversion must be a positive number")
         
-        filename = radiation_wrapper.writeCameraImage(
+        filename = self._wrapper.writeCameraImage(
             self.radiation_model, camera, bands, imagefile_base, 
             image_path, frame, flux_to_pixel_conversion)
         
         logger.info(f"Camera image written to: {filename}")
         return filename
     
-    @require_plugin('radiation', 'write normalized camera images')
+    @require_radiation_backend('write normalized camera images', cpu_supported=False)
     def writeNormCameraImage(self, camera: str, bands: List[str], imagefile_base: str,
                                image_path: str = "./", frame: int = -1) -> str:
         """
@@ -693,13 +1449,13 @@ class RadiationModel:
         if not isinstance(frame, int):
             raise TypeError("Frame must be an integer")
         
-        filename = radiation_wrapper.writeNormCameraImage(
+        filename = self._wrapper.writeNormCameraImage(
             self.radiation_model, camera, bands, imagefile_base, image_path, frame)
         
         logger.info(f"Normalized camera image written to: {filename}")
         return filename
     
-    @require_plugin('radiation', 'write camera image data')
+    @require_radiation_backend('write camera image data', cpu_supported=False)
     def writeCameraImageData(self, camera: str, band: str, imagefile_base: str,
                                image_path: str = "./", frame: int = -1):
         """
@@ -728,12 +1484,174 @@ class RadiationModel:
         if not isinstance(frame, int):
             raise TypeError("Frame must be an integer")
         
-        radiation_wrapper.writeCameraImageData(
+        self._wrapper.writeCameraImageData(
             self.radiation_model, camera, band, imagefile_base, image_path, frame)
         
         logger.info(f"Camera image data written for camera {camera}, band {band}")
     
-    @require_plugin('radiation', 'write image bounding boxes')
+    @require_radiation_backend('get camera images')
+    def getCameraImage(self, camera: str, band: str):
+        """
+        Get the pixel data of one camera band as an array, without writing a file.
+
+        Args:
+            camera: Camera label
+            band: Band label
+
+        Returns:
+            NumPy float32 array of shape (height, width)
+
+        Raises:
+            RadiationModelError: If the camera or band does not exist
+            TypeError: If parameters have incorrect types
+        """
+        if not isinstance(camera, str) or not camera.strip():
+            raise TypeError("Camera label must be a non-empty string")
+        if not isinstance(band, str) or not band.strip():
+            raise TypeError("Band label must be a non-empty string")
+
+        try:
+            return self._wrapper.getCameraImageBuffer(self.radiation_model, camera, band)
+        except Exception as e:
+            raise RadiationModelError(f"Failed to get image of camera '{camera}': {e}")
+
+    @require_radiation_backend('get camera images')
+    def getCameraImageRGB(self, camera: str, bands: List[str], flux_to_pixel_conversion: float = 1.0,
+                          normalize: bool = False, dtype: str = "float32"):
+        """
+        Get an RGB composite of three camera bands as an array, without writing a file.
+
+        Pixel values are scaled as in writeCameraImage (or writeNormCameraImage if normalize is True)
+        and clamped to [0, 1].
+
+        Args:
+            camera: Camera label
+            bands: Red, green and blue band labels
+            flux_to_pixel_conversion: Conversion factor from flux to pixel value (ignored if normalize is True)
+            normalize: Divide by the maximum pixel value over the three bands
+            dtype: "float32" for values in [0, 1] or "uint8" for values in [0, 255]
+
+        Returns:
+            NumPy array of shape (height, width, 3)
+
+        Raises:
+            RadiationModelError: If the camera or a band does not exist
+            TypeError: If parameters have incorrect types
+            ValueError: If bands does not hold exactly three labels or dtype is unsupported
+        """
+        if not isinstance(camera, str) or not camera.strip():
+            raise TypeError("Camera label must be a non-empty string")
+        if not isinstance(bands, (list, tuple)) or len(bands) != 3:
+            raise ValueError("Exactly three band labels (red, green, blue) are required")
+        if not all(isinstance(band, str) and band.strip() for band in bands):
+            raise TypeError("Band labels must be non-empty strings")
+        if dtype not in ("float32", "uint8"):
+            raise ValueError(f"dtype must be 'float32' or 'uint8', got '{dtype}'")
+
+        try:
+            return self._wrapper.getCameraImageRGB(self.radiation_model, camera, list(bands),
+                                                   float(flux_to_pixel_conversion), bool(normalize), dtype)
+        except Exception as e:
+            raise RadiationModelError(f"Failed to get RGB image of camera '{camera}': {e}")
+
+    @require_cpu_backend
+    def renderCameras(self, camera_labels: Optional[List[str]] = None):
+        """
+        Render several cameras in one batch from the last run of their bands (CPU backend only).
+
+        runBand() already renders the cameras observing the bands it ran. Call this after adding or
+        moving cameras to re-render them without re-running the bands. Primary rays of all cameras
+        share one work list on the thread pool, and each ray shades every band of its camera.
+        Pixel values are surface exitance in W/m^2 (pi times radiance); rays that miss the scene see
+        the band's diffuse flux above the horizon and zero below it.
+
+        Args:
+            camera_labels: Labels of the cameras to render (None = all cameras except tiled-only ones)
+
+        Example:
+            >>> for i, position in enumerate(positions):
+            ...     radiation_model.addRadiationCamera(f"view_{i}", ["red", "green", "blue"], position, vec3(0, 0, 0))
+            >>> radiation_model.renderCameras()
+            >>> images = [radiation_model.getCameraImage(f"view_{i}", "red") for i in range(len(positions))]
+        """
+        if camera_labels is not None:
+            if isinstance(camera_labels, str) or not all(isinstance(label, str) and label.strip() for label in camera_labels):
+                raise TypeError("camera_labels must be a list of non-empty strings")
+            camera_labels = list(camera_labels)
+        self._wrapper.renderCameras(self.radiation_model, camera_labels)
+
+    @require_cpu_backend
+    def setCameraTiledOnly(self, camera: str, tiled_only: bool = True):
+        """
+        Render a camera only through renderCameraTiles() (CPU backend only).
+
+        By default runBand() renders every camera observing the bands it ran into memory, which
+        allocates the full frame. A tiled-only camera is skipped by runBand() and renderCameras(), so
+        frames too large for memory are only ever streamed tile by tile. Enabling the flag drops
+        pixels rendered earlier; re-adding the camera (e.g. to move it) keeps the flag.
+
+        Args:
+            camera: Camera label
+            tiled_only: True to render the camera only in tiles, False to restore in-memory rendering
+
+        Example:
+            >>> radiation_model.addRadiationCamera("drone", ["NIR"], vec3(0, 0, 50), vec3(0, 0, 0), properties)
+            >>> radiation_model.setCameraTiledOnly("drone")
+            >>> radiation_model.runBand("NIR")  # no full frame allocated
+            >>> radiation_model.renderCameraTiles("drone", write_tile, tile_size=(512, 512))
+        """
+        if not isinstance(camera, str) or not camera.strip():
+            raise TypeError("Camera label must be a non-empty string")
+
+        try:
+            self._wrapper.setCameraTiledOnly(self.radiation_model, camera, bool(tiled_only))
+        except HeliosError as e:
+            raise RadiationModelError(f"Failed to set rendering mode of camera '{camera}': {e}")
+
+    @require_cpu_backend
+    def renderCameraTiles(self, camera: str, writer, tile_size=(256, 256)):
+        """
+        Render one camera tile by tile and stream the tiles to a writer (CPU backend only).
+
+        The frame is never held in memory: tiles are rendered in parallel in small waves and handed
+        to writer in row-major tile order, so peak memory scales with the tile size and thread count
+        rather than the camera resolution. Use this for frames too large for getCameraImage(), together
+        with setCameraTiledOnly() so runBand() does not render the full frame first. Pixel values match
+        getCameraImage() for the same camera.
+
+        Args:
+            camera: Camera label
+            writer: Callable writer(band, x0, y0, pixels) called once per tile and band; pixels is a
+                    float32 array of shape (tile_height, tile_width) valid only during the call, and
+                    (x0, y0) is the column and row of its top-left pixel. Edge tiles are clipped.
+            tile_size: (width, height) of a tile in pixels
+
+        Raises:
+            RadiationModelError: If the camera does not exist, none of its bands has been run since
+                the last geometry update, or rendering fails
+            Any exception raised by writer, which stops rendering
+
+        Example:
+            >>> width, height = 16384, 16384
+            >>> frame = np.lib.format.open_memmap("nir.npy", mode="w+", dtype=np.float32, shape=(height, width))
+            >>> def write_tile(band, x0, y0, pixels):
+            ...     frame[y0:y0 + pixels.shape[0], x0:x0 + pixels.shape[1]] = pixels
+            >>> radiation_model.renderCameraTiles("drone", write_tile, tile_size=(512, 512))
+            >>> frame.flush()
+        """
+        if not isinstance(camera, str) or not camera.strip():
+            raise TypeError("Camera label must be a non-empty string")
+        if not callable(writer):
+            raise TypeError("writer must be callable")
+        if len(tile_size) != 2 or not all(isinstance(n, int) and n > 0 for n in tile_size):
+            raise ValueError("tile_size must be a (width, height) pair of positive integers")
+
+        try:
+            self._wrapper.renderCameraTiles(self.radiation_model, camera, tile_size[0], tile_size[1], writer)
+        except HeliosError as e:
+            raise RadiationModelError(f"Failed to render tiles of camera '{camera}': {e}")
+
+    @require_radiation_backend('write image bounding boxes', cpu_supported=False)
     def writeImageBoundingBoxes(self, camera_label: str,
                                   primitive_data_labels=None, object_data_labels=None,
                                   object_class_ids=None, image_file: str = "",
@@ -781,7 +1699,7 @@ class RadiationModel:
                 # Single label
                 if not isinstance(object_class_ids, int):
                     raise TypeError("For single primitive data label, object_class_ids must be an integer")
-                radiation_wrapper.writeImageBoundingBoxes(
+                self._wrapper.writeImageBoundingBoxes(
                     self.radiation_model, camera_label, primitive_data_labels, 
                     object_class_ids, image_file, classes_txt_file, image_path)
                 logger.info(f"Image bounding boxes written for primitive data: {primitive_data_labels}")
@@ -797,7 +1715,7 @@ class RadiationModel:
                 if not all(isinstance(cid, int) for cid in object_class_ids):
                     raise TypeError("All object class IDs must be integers")
                 
-                radiation_wrapper.writeImageBoundingBoxesVector(
+                self._wrapper.writeImageBoundingBoxesVector(
                     self.radiation_model, camera_label, primitive_data_labels, 
                     object_class_ids, image_file, classes_txt_file, image_path)
                 logger.info(f"Image bounding boxes written for {len(primitive_data_labels)} primitive data labels")
@@ -810,7 +1728,7 @@ class RadiationModel:
                 # Single label
                 if not isinstance(object_class_ids, int):
                     raise TypeError("For single object data label, object_class_ids must be an integer")
-                radiation_wrapper.writeImageBoundingBoxes_ObjectData(
+                self._wrapper.writeImageBoundingBoxes_ObjectData(
                     self.radiation_model, camera_label, object_data_labels, 
                     object_class_ids, image_file, classes_txt_file, image_path)
                 logger.info(f"Image bounding boxes written for object data: {object_data_labels}")
@@ -826,14 +1744,14 @@ class RadiationModel:
                 if not all(isinstance(cid, int) for cid in object_class_ids):
                     raise TypeError("All object class IDs must be integers")
                 
-                radiation_wrapper.writeImageBoundingBoxes_ObjectDataVector(
+                self._wrapper.writeImageBoundingBoxes_ObjectDataVector(
                     self.radiation_model, camera_label, object_data_labels, 
                     object_class_ids, image_file, classes_txt_file, image_path)
                 logger.info(f"Image bounding boxes written for {len(object_data_labels)} object data labels")
             else:
                 raise TypeError("object_data_labels must be a string or list of strings")
     
-    @require_plugin('radiation', 'write image segmentation masks')
+    @require_radiation_backend('write image segmentation masks', cpu_supported=False)
     def writeImageSegmentationMasks(self, camera_label: str,
                                       primitive_data_labels=None, object_data_labels=None,
                                       object_class_ids=None, json_filename: str = "",
@@ -880,7 +1798,7 @@ class RadiationModel:
                 # Single label
                 if not isinstance(object_class_ids, int):
                     raise TypeError("For single primitive data label, object_class_ids must be an integer")
-                radiation_wrapper.writeImageSegmentationMasks(
+                self._wrapper.writeImageSegmentationMasks(
                     self.radiation_model, camera_label, primitive_data_labels, 
                     object_class_ids, json_filename, image_file, append_file)
                 logger.info(f"Image segmentation masks written for primitive data: {primitive_data_labels}")
@@ -896,7 +1814,7 @@ class RadiationModel:
                 if not all(isinstance(cid, int) for cid in object_class_ids):
                     raise TypeError("All object class IDs must be integers")
                 
-                radiation_wrapper.writeImageSegmentationMasksVector(
+                self._wrapper.writeImageSegmentationMasksVector(
                     self.radiation_model, camera_label, primitive_data_labels, 
                     object_class_ids, json_filename, image_file, append_file)
                 logger.info(f"Image segmentation masks written for {len(primitive_data_labels)} primitive data labels")
@@ -909,7 +1827,7 @@ class RadiationModel:
                 # Single label
                 if not isinstance(object_class_ids, int):
                     raise TypeError("For single object data label, object_class_ids must be an integer")
-                radiation_wrapper.writeImageSegmentationMasks_ObjectData(
+                self._wrapper.writeImageSegmentationMasks_ObjectData(
                     self.radiation_model, camera_label, object_data_labels, 
                     object_class_ids, json_filename, image_file, append_file)
                 logger.info(f"Image segmentation masks written for object data: {object_data_labels}")
@@ -925,14 +1843,134 @@ class RadiationModel:
                 if not all(isinstance(cid, int) for cid in object_class_ids):
                     raise TypeError("All object class IDs must be integers")
                 
-                radiation_wrapper.writeImageSegmentationMasks_ObjectDataVector(
+                self._wrapper.writeImageSegmentationMasks_ObjectDataVector(
                     self.radiation_model, camera_label, object_data_labels, 
                     object_class_ids, json_filename, image_file, append_file)
                 logger.info(f"Image segmentation masks written for {len(object_data_labels)} object data labels")
             else:
                 raise TypeError("object_data_labels must be a string or list of strings")
     
-    @require_plugin('radiation', 'auto-calibrate camera image')
+    def _annotationLabels(self, primitive_data_labels, object_data_labels, object_class_ids):
+        """Normalize single-or-list annotation label arguments to (label, object_data, class_id) tuples"""
+        if primitive_data_labels is not None and object_data_labels is not None:
+            raise ValueError("Cannot specify both primitive_data_labels and object_data_labels")
+        if primitive_data_labels is None and object_data_labels is None:
+            raise ValueError("Must specify either primitive_data_labels or object_data_labels")
+
+        object_data = object_data_labels is not None
+        labels = object_data_labels if object_data else primitive_data_labels
+        if isinstance(labels, str):
+            labels = [labels]
+            class_ids = [object_class_ids if object_class_ids is not None else 0]
+        else:
+            class_ids = object_class_ids if object_class_ids is not None else [0] * len(labels)
+        if not isinstance(labels, list) or not all(isinstance(lbl, str) and lbl.strip() for lbl in labels):
+            raise TypeError("Data labels must be a non-empty string or list of non-empty strings")
+        if not isinstance(class_ids, list) or len(class_ids) != len(labels):
+            raise ValueError("object_class_ids must match the data labels")
+        if not all(isinstance(cid, int) for cid in class_ids):
+            raise TypeError("All object class IDs must be integers")
+        return [(label, object_data, class_id) for label, class_id in zip(labels, class_ids)]
+
+    @require_radiation_backend('get image bounding boxes', cpu_supported=False)
+    def getImageBoundingBoxes(self, camera_label: str, primitive_data_label: str = None,
+                              object_data_label: str = None) -> np.ndarray:
+        """
+        Get bounding boxes of labelled instances seen by a camera, without writing files.
+
+        Each distinct value of an int or uint data label is one instance. Coordinates are inclusive
+        pixel indices in the pixel order of getCameraImage. A band must have been run with the camera.
+
+        Args:
+            camera_label: Camera label
+            primitive_data_label: Primitive data label identifying instances
+            object_data_label: Object data label identifying instances (instead of primitive_data_label)
+
+        Returns:
+            NumPy uint32 array of shape (instances, 6): data value, x min, y min, x max, y max, pixel count
+
+        Raises:
+            RadiationModelError: If the camera does not exist or has not been rendered
+            ValueError: If both or neither data labels are given
+        """
+        if not isinstance(camera_label, str) or not camera_label.strip():
+            raise TypeError("Camera label must be a non-empty string")
+        (label, object_data, _), = self._annotationLabels(primitive_data_label, object_data_label, None)
+
+        boxes, _ = self._wrapper.getImageBoundingBoxes(self.radiation_model, camera_label, label, object_data)
+        return boxes
+
+    @require_radiation_backend('get image segmentation masks', cpu_supported=False)
+    def getImageSegmentationMasks(self, camera_label: str, primitive_data_label: str = None,
+                                  object_data_label: str = None) -> dict:
+        """
+        Get run-length encoded segmentation masks of labelled instances seen by a camera, without writing files.
+
+        Instances are defined as in getImageBoundingBoxes. Counts follow COCO uncompressed RLE:
+        column-major, alternating background and foreground runs, starting with background.
+
+        Args:
+            camera_label: Camera label
+            primitive_data_label: Primitive data label identifying instances
+            object_data_label: Object data label identifying instances (instead of primitive_data_label)
+
+        Returns:
+            Dict mapping each data value to a NumPy uint32 array of run lengths
+
+        Raises:
+            RadiationModelError: If the camera does not exist or has not been rendered
+            ValueError: If both or neither data labels are given
+        """
+        if not isinstance(camera_label, str) or not camera_label.strip():
+            raise TypeError("Camera label must be a non-empty string")
+        (label, object_data, _), = self._annotationLabels(primitive_data_label, object_data_label, None)
+
+        masks, _ = self._wrapper.getImageSegmentationMasksRLE(self.radiation_model, camera_label, label, object_data)
+        return masks
+
+    @require_radiation_backend('get image annotations', cpu_supported=False)
+    def getImageAnnotations(self, camera_label: str, primitive_data_labels=None, object_data_labels=None,
+                            object_class_ids=None) -> dict:
+        """
+        Get COCO instance annotations of the current camera frame, without writing files.
+
+        Takes the same label arguments as writeImageSegmentationMasks. The result can be passed to
+        COCOAnnotationWriter.addFrame.
+
+        Args:
+            camera_label: Camera label
+            primitive_data_labels: Single primitive data label (str) or list of primitive data labels
+            object_data_labels: Single object data label (str) or list of object data labels
+            object_class_ids: Single class ID (int) or list of class IDs (must match data labels)
+
+        Returns:
+            Dict with "width", "height" and "annotations", a list of COCO annotation dicts
+            (category_id, segmentation as uncompressed RLE, area, bbox, iscrowd)
+
+        Raises:
+            RadiationModelError: If the camera does not exist or has not been rendered
+            ValueError: If both or neither data labels are given
+        """
+        if not isinstance(camera_label, str) or not camera_label.strip():
+            raise TypeError("Camera label must be a non-empty string")
+        labels = self._annotationLabels(primitive_data_labels, object_data_labels, object_class_ids)
+
+        frame = {"width": 0, "height": 0, "annotations": []}
+        for label, object_data, class_id in labels:
+            boxes, (height, width) = self._wrapper.getImageBoundingBoxes(self.radiation_model, camera_label, label, object_data)
+            masks, _ = self._wrapper.getImageSegmentationMasksRLE(self.radiation_model, camera_label, label, object_data)
+            frame["width"], frame["height"] = width, height
+            for value, xmin, ymin, xmax, ymax, area in boxes.tolist():
+                frame["annotations"].append({
+                    "category_id": class_id,
+                    "segmentation": {"size": [height, width], "counts": masks[value].tolist()},
+                    "area": area,
+                    "bbox": [xmin, ymin, xmax - xmin + 1, ymax - ymin + 1],
+                    "iscrowd": 0
+                })
+        return frame
+
+    @require_radiation_backend('auto-calibrate camera image', cpu_supported=False)
     def autoCalibrateCameraImage(self, camera_label: str, red_band_label: str,
                                    green_band_label: str, blue_band_label: str,
                                    output_file_path: str, print_quality_report: bool = False,
@@ -987,7 +2025,7 @@ class RadiationModel:
         
         algorithm_int = algorithm_map[algorithm]
         
-        filename = radiation_wrapper.autoCalibrateCameraImage(
+        filename = self._wrapper.autoCalibrateCameraImage(
             self.radiation_model, camera_label, red_band_label, green_band_label,
             blue_band_label, output_file_path, print_quality_report, 
             algorithm_int, ccm_export_file_path)
@@ -400,6 +400,82 @@ class SkyViewFactorModel:
         except Exception as e:
             raise SkyViewFactorModelError(f"Failed to calculate sky view factors: {e}")
 
+    def calculate_sky_view_factors_chunked(
+        self,
+        points,
+        chunk_size: int = 100000,
+        progress_callback=None,
+        num_threads: int = 0,
+    ):
+        """
+        Calculate sky view factors for a large point cloud in bounded-memory chunks.
+
+        Only ``chunk_size`` points are held by the native model at a time, so very large
+        grids (e.g. LiDAR point clouds) can be processed without building the full
+        intermediate point set.
+
+        Args:
+            points: N x 3 numpy array (or list of (x, y, z) tuples)
+            chunk_size: Number of points per chunk (default: 100000)
+            progress_callback: Optional callable(points_done, total_points) invoked after
+                each chunk; return True to stop early
+            num_threads: Number of OpenMP threads to use (0 = auto, default: 0)
+
+        Returns:
+            numpy float32 array of sky view factors. If cancelled, entries after the
+            last completed chunk are 0.
+        """
+        if chunk_size <= 0:
+            raise ValueError(f"chunk_size must be positive, got {chunk_size}")
+
+        try:
+            with _skyviewfactor_working_directory():
+                results, _ = skyviewfactor_wrapper.calculateSkyViewFactorsChunked(
+                    self._model_ptr, points, chunk_size, progress_callback, num_threads
+                )
+            self._sky_view_factors = results
+            return results
+        except Exception as e:
+            raise SkyViewFactorModelError(
+                f"Failed to calculate sky view factors (chunked): {e}"
+            )
+
+    def calculate_sky_view_factors_parallel_cpu(
+        self,
+        points: List[Tuple[float, float, float]],
+        num_threads: int = 0,
+        seed: int = 0,
+    ) -> List[float]:
+        """
+        Calculate sky view factors for many points with the multithreaded CPU engine.
+
+        Intended for machines without a GPU. The scene BVH is built once per call and
+        points are shared between worker threads; for a fixed seed the results are
+        identical regardless of the number of threads.
+
+        Args:
+            points: List (or N x 3 array) of (x, y, z) points
+            num_threads: Number of worker threads (0 = all cores, default: 0)
+            seed: Random seed for ray directions (default: 0)
+
+        Returns:
+            List of sky view factor values (0-1)
+        """
+        if points is None or len(points) == 0:
+            return []
+
+        try:
+            results = skyviewfactor_wrapper.calculateSkyViewFactorsParallelCPU(
+                self._model_ptr, self.context.context, points, num_threads, seed
+            ).tolist()
+            self._sky_view_factors = results
+            self._sample_points = [tuple(p) for p in points]
+            return results
+        except Exception as e:
+            raise SkyViewFactorModelError(
+                f"Failed to calculate sky view factors (parallel CPU): {e}"
+            )
+
     def calculate_sky_view_factors_for_primitives(
         self, uuids: List[str | int] = None, num_threads: int = 0
     ) -> List[float]:
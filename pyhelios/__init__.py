@@ -51,12 +51,14 @@ except (AttributeError, ImportError):
     WPTType = None
 
 try:
-    from .RadiationModel import RadiationModel, RadiationModelError, CameraProperties
+    from .RadiationModel import RadiationModel, RadiationModelError, CameraProperties, COCOAnnotationWriter, RadiationJob
 except (AttributeError, ImportError):
     # RadiationModel functions not available in current library
     RadiationModel = None
     CameraProperties = None
     RadiationModelError = None
+    COCOAnnotationWriter = None
+    RadiationJob = None
 
 try:
     from .SkyViewFactorModel import SkyViewFactorModel, SkyViewFactorModelError, SkyViewFactorCamera
@@ -0,0 +1,855 @@
+"""
+Ctypes wrapper for the CPU radiation backend C++ bindings.
+
+This module provides low-level ctypes bindings to the CPU ray-tracing radiation
+model in the PyHelios wrapper layer. The CPU backend is compiled into every build
+(it does not depend on the radiation plugin, CUDA or OptiX). Python function names
+mirror URadiationModelWrapper so RadiationModel can use either module.
+"""
+
+import ctypes
+from typing import List
+
+from ..plugins import helios_lib
+from ..exceptions import check_helios_error
+
+# Define the UCPURadiationModel struct
+class UCPURadiationModel(ctypes.Structure):
+    pass
+
+# Import UContext from main wrapper to avoid type conflicts
+from .UContextWrapper import UContext
+
+# Error checking callback
+def _check_error(result, func, args):
+    """
+    Errcheck callback that automatically checks for Helios errors after each CPU radiation function call.
+    This ensures that C++ exceptions are properly converted to Python exceptions.
+    """
+    check_helios_error(helios_lib.getLastErrorCode, helios_lib.getLastErrorMessage)
+    return result
+
+# int callback(void* user_data, const char* band, int x0, int y0, int width, int height, const float* pixels)
+_CPUCameraTileCallback = ctypes.CFUNCTYPE(ctypes.c_int, ctypes.c_void_p, ctypes.c_char_p, ctypes.c_int, ctypes.c_int,
+                                          ctypes.c_int, ctypes.c_int, ctypes.POINTER(ctypes.c_float))
+
+# Try to set up CPU radiation function prototypes
+try:
+    # CPU radiation model creation and destruction
+    helios_lib.createCPURadiationModel.argtypes = [ctypes.POINTER(UContext)]
+    helios_lib.createCPURadiationModel.restype = ctypes.POINTER(UCPURadiationModel)
+    helios_lib.createCPURadiationModel.errcheck = _check_error
+
+    helios_lib.destroyCPURadiationModel.argtypes = [ctypes.POINTER(UCPURadiationModel)]
+    helios_lib.destroyCPURadiationModel.restype = None
+    helios_lib.destroyCPURadiationModel.errcheck = _check_error
+
+    # Message and thread control
+    helios_lib.disableCPURadiationMessages.argtypes = [ctypes.POINTER(UCPURadiationModel)]
+    helios_lib.disableCPURadiationMessages.restype = None
+    helios_lib.disableCPURadiationMessages.errcheck = _check_error
+
+    helios_lib.enableCPURadiationMessages.argtypes = [ctypes.POINTER(UCPURadiationModel)]
+    helios_lib.enableCPURadiationMessages.restype = None
+    helios_lib.enableCPURadiationMessages.errcheck = _check_error
+
+    helios_lib.setCPURadiationThreadCount.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_int]
+    helios_lib.setCPURadiationThreadCount.restype = None
+    helios_lib.setCPURadiationThreadCount.errcheck = _check_error
+
+    helios_lib.setCPURadiationSeed.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_uint]
+    helios_lib.setCPURadiationSeed.restype = None
+    helios_lib.setCPURadiationSeed.errcheck = _check_error
+
+    # Band management
+    helios_lib.addCPURadiationBand.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p]
+    helios_lib.addCPURadiationBand.restype = None
+    helios_lib.addCPURadiationBand.errcheck = _check_error
+
+    helios_lib.addCPURadiationBandWithWavelengths.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p, ctypes.c_float, ctypes.c_float]
+    helios_lib.addCPURadiationBandWithWavelengths.restype = None
+    helios_lib.addCPURadiationBandWithWavelengths.errcheck = _check_error
+
+    helios_lib.copyCPURadiationBand.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p, ctypes.c_char_p]
+    helios_lib.copyCPURadiationBand.restype = None
+    helios_lib.copyCPURadiationBand.errcheck = _check_error
+
+    # Source management
+    helios_lib.addCPUCollimatedRadiationSource.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_float, ctypes.c_float, ctypes.c_float]
+    helios_lib.addCPUCollimatedRadiationSource.restype = ctypes.c_uint
+    helios_lib.addCPUCollimatedRadiationSource.errcheck = _check_error
+
+    helios_lib.addCPUSphereRadiationSource.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float]
+    helios_lib.addCPUSphereRadiationSource.restype = ctypes.c_uint
+    helios_lib.addCPUSphereRadiationSource.errcheck = _check_error
+
+    helios_lib.addCPUSunSphereRadiationSource.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float]
+    helios_lib.addCPUSunSphereRadiationSource.restype = ctypes.c_uint
+    helios_lib.addCPUSunSphereRadiationSource.errcheck = _check_error
+
+    # Flux and ray configuration
+    helios_lib.setCPUSourceFlux.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_uint, ctypes.c_char_p, ctypes.c_float]
+    helios_lib.setCPUSourceFlux.restype = None
+    helios_lib.setCPUSourceFlux.errcheck = _check_error
+
+    helios_lib.setCPUSourceFluxMultiple.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.POINTER(ctypes.c_uint), ctypes.c_size_t, ctypes.c_char_p, ctypes.c_float]
+    helios_lib.setCPUSourceFluxMultiple.restype = None
+    helios_lib.setCPUSourceFluxMultiple.errcheck = _check_error
+
+    helios_lib.getCPUSourceFlux.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_uint, ctypes.c_char_p]
+    helios_lib.getCPUSourceFlux.restype = ctypes.c_float
+    helios_lib.getCPUSourceFlux.errcheck = _check_error
+
+    helios_lib.setCPUSourceSpectrum.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_uint, ctypes.c_char_p]
+    helios_lib.setCPUSourceSpectrum.restype = None
+    helios_lib.setCPUSourceSpectrum.errcheck = _check_error
+
+    helios_lib.setCPUDiffuseRadiationFlux.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p, ctypes.c_float]
+    helios_lib.setCPUDiffuseRadiationFlux.restype = None
+    helios_lib.setCPUDiffuseRadiationFlux.errcheck = _check_error
+
+    helios_lib.setCPUDirectRayCount.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p, ctypes.c_size_t]
+    helios_lib.setCPUDirectRayCount.restype = None
+    helios_lib.setCPUDirectRayCount.errcheck = _check_error
+
+    helios_lib.setCPUDiffuseRayCount.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p, ctypes.c_size_t]
+    helios_lib.setCPUDiffuseRayCount.restype = None
+    helios_lib.setCPUDiffuseRayCount.errcheck = _check_error
+
+    helios_lib.setCPUScatteringDepth.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p, ctypes.c_uint]
+    helios_lib.setCPUScatteringDepth.restype = None
+    helios_lib.setCPUScatteringDepth.errcheck = _check_error
+
+    helios_lib.setCPUMinScatterEnergy.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p, ctypes.c_float]
+    helios_lib.setCPUMinScatterEnergy.restype = None
+    helios_lib.setCPUMinScatterEnergy.errcheck = _check_error
+
+    helios_lib.disableCPUEmission.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p]
+    helios_lib.disableCPUEmission.restype = None
+    helios_lib.disableCPUEmission.errcheck = _check_error
+
+    helios_lib.enableCPUEmission.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p]
+    helios_lib.enableCPUEmission.restype = None
+    helios_lib.enableCPUEmission.errcheck = _check_error
+
+    helios_lib.enforceCPUPeriodicBoundary.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p]
+    helios_lib.enforceCPUPeriodicBoundary.restype = None
+    helios_lib.enforceCPUPeriodicBoundary.errcheck = _check_error
+
+    helios_lib.setCPUScatteringTolerance.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p, ctypes.c_float]
+    helios_lib.setCPUScatteringTolerance.restype = None
+    helios_lib.setCPUScatteringTolerance.errcheck = _check_error
+
+    helios_lib.setCPUAdaptiveRayCount.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p, ctypes.c_float, ctypes.c_size_t]
+    helios_lib.setCPUAdaptiveRayCount.restype = None
+    helios_lib.setCPUAdaptiveRayCount.errcheck = _check_error
+
+    helios_lib.getCPURadiationBandStats.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p, ctypes.POINTER(ctypes.c_float), ctypes.c_size_t]
+    helios_lib.getCPURadiationBandStats.restype = ctypes.c_size_t
+    helios_lib.getCPURadiationBandStats.errcheck = _check_error
+
+    helios_lib.enableCPUFluxSuperposition.argtypes = [ctypes.POINTER(UCPURadiationModel)]
+    helios_lib.enableCPUFluxSuperposition.restype = None
+    helios_lib.enableCPUFluxSuperposition.errcheck = _check_error
+
+    helios_lib.disableCPUFluxSuperposition.argtypes = [ctypes.POINTER(UCPURadiationModel)]
+    helios_lib.disableCPUFluxSuperposition.restype = None
+    helios_lib.disableCPUFluxSuperposition.errcheck = _check_error
+
+    helios_lib.enableCPUViewFactorOperator.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_float, ctypes.c_size_t]
+    helios_lib.enableCPUViewFactorOperator.restype = None
+    helios_lib.enableCPUViewFactorOperator.errcheck = _check_error
+
+    helios_lib.disableCPUViewFactorOperator.argtypes = [ctypes.POINTER(UCPURadiationModel)]
+    helios_lib.disableCPUViewFactorOperator.restype = None
+    helios_lib.disableCPUViewFactorOperator.errcheck = _check_error
+
+    helios_lib.getCPUViewFactorOperatorBytes.argtypes = [ctypes.POINTER(UCPURadiationModel)]
+    helios_lib.getCPUViewFactorOperatorBytes.restype = ctypes.c_size_t
+    helios_lib.getCPUViewFactorOperatorBytes.errcheck = _check_error
+
+    helios_lib.getCPUViewFactorOperatorNonzeros.argtypes = [ctypes.POINTER(UCPURadiationModel)]
+    helios_lib.getCPUViewFactorOperatorNonzeros.restype = ctypes.c_size_t
+    helios_lib.getCPUViewFactorOperatorNonzeros.errcheck = _check_error
+
+    helios_lib.precomputeCPUSunlitFractions.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.POINTER(ctypes.c_float), ctypes.c_size_t,
+                                                        ctypes.c_size_t, ctypes.c_float]
+    helios_lib.precomputeCPUSunlitFractions.restype = None
+    helios_lib.precomputeCPUSunlitFractions.errcheck = _check_error
+
+    helios_lib.clearCPUSunlitFractions.argtypes = [ctypes.POINTER(UCPURadiationModel)]
+    helios_lib.clearCPUSunlitFractions.restype = None
+    helios_lib.clearCPUSunlitFractions.errcheck = _check_error
+
+    helios_lib.getCPUSunlitFractionBytes.argtypes = [ctypes.POINTER(UCPURadiationModel)]
+    helios_lib.getCPUSunlitFractionBytes.restype = ctypes.c_size_t
+    helios_lib.getCPUSunlitFractionBytes.errcheck = _check_error
+
+    # Geometry and simulation
+    helios_lib.updateCPURadiationGeometry.argtypes = [ctypes.POINTER(UCPURadiationModel)]
+    helios_lib.updateCPURadiationGeometry.restype = None
+    helios_lib.updateCPURadiationGeometry.errcheck = _check_error
+
+    helios_lib.updateCPURadiationGeometryUUIDs.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.POINTER(ctypes.c_uint), ctypes.c_size_t]
+    helios_lib.updateCPURadiationGeometryUUIDs.restype = None
+    helios_lib.updateCPURadiationGeometryUUIDs.errcheck = _check_error
+
+    helios_lib.updateCPURadiationGeometryDirty.argtypes = [ctypes.POINTER(UCPURadiationModel)]
+    helios_lib.updateCPURadiationGeometryDirty.restype = ctypes.c_size_t
+    helios_lib.updateCPURadiationGeometryDirty.errcheck = _check_error
+
+    helios_lib.runCPURadiationBand.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p]
+    helios_lib.runCPURadiationBand.restype = None
+    helios_lib.runCPURadiationBand.errcheck = _check_error
+
+    helios_lib.runCPURadiationBandMultiple.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.POINTER(ctypes.c_char_p), ctypes.c_size_t]
+    helios_lib.runCPURadiationBandMultiple.restype = None
+    helios_lib.runCPURadiationBandMultiple.errcheck = _check_error
+
+    # Asynchronous runs (job handles are opaque pointers)
+    helios_lib.runCPURadiationBandAsync.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.POINTER(ctypes.c_char_p), ctypes.c_size_t]
+    helios_lib.runCPURadiationBandAsync.restype = ctypes.c_void_p
+    helios_lib.runCPURadiationBandAsync.errcheck = _check_error
+
+    helios_lib.pollCPURadiationJob.argtypes = [ctypes.c_void_p]
+    helios_lib.pollCPURadiationJob.restype = ctypes.c_int
+    helios_lib.pollCPURadiationJob.errcheck = _check_error
+
+    helios_lib.waitCPURadiationJob.argtypes = [ctypes.c_void_p, ctypes.c_double]
+    helios_lib.waitCPURadiationJob.restype = ctypes.c_int
+    helios_lib.waitCPURadiationJob.errcheck = _check_error
+
+    helios_lib.getCPURadiationJobProgress.argtypes = [ctypes.c_void_p]
+    helios_lib.getCPURadiationJobProgress.restype = ctypes.c_float
+    helios_lib.getCPURadiationJobProgress.errcheck = _check_error
+
+    helios_lib.cancelCPURadiationJob.argtypes = [ctypes.c_void_p]
+    helios_lib.cancelCPURadiationJob.restype = None
+    helios_lib.cancelCPURadiationJob.errcheck = _check_error
+
+    helios_lib.destroyCPURadiationJob.argtypes = [ctypes.c_void_p]
+    helios_lib.destroyCPURadiationJob.restype = None
+    helios_lib.destroyCPURadiationJob.errcheck = _check_error
+
+    # Results
+    helios_lib.getCPUTotalAbsorbedFluxToBuffer.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.POINTER(ctypes.c_float), ctypes.c_size_t]
+    helios_lib.getCPUTotalAbsorbedFluxToBuffer.restype = ctypes.c_size_t
+    helios_lib.getCPUTotalAbsorbedFluxToBuffer.errcheck = _check_error
+
+    helios_lib.getCPUAbsorbedFluxBands.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.POINTER(ctypes.c_char_p), ctypes.c_size_t,
+                                                   ctypes.POINTER(ctypes.c_float), ctypes.c_size_t]
+    helios_lib.getCPUAbsorbedFluxBands.restype = ctypes.c_size_t
+    helios_lib.getCPUAbsorbedFluxBands.errcheck = _check_error
+
+    helios_lib.aggregateCPUAbsorbedFlux.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p, ctypes.POINTER(ctypes.c_uint),
+                                                    ctypes.POINTER(ctypes.c_uint), ctypes.c_size_t, ctypes.c_size_t,
+                                                    ctypes.POINTER(ctypes.c_double), ctypes.POINTER(ctypes.c_double)]
+    helios_lib.aggregateCPUAbsorbedFlux.restype = None
+    helios_lib.aggregateCPUAbsorbedFlux.errcheck = _check_error
+
+    helios_lib.aggregateCPUAbsorbedFluxByObject.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p, ctypes.POINTER(ctypes.c_uint),
+                                                            ctypes.POINTER(ctypes.c_double), ctypes.POINTER(ctypes.c_double), ctypes.c_size_t]
+    helios_lib.aggregateCPUAbsorbedFluxByObject.restype = ctypes.c_size_t
+    helios_lib.aggregateCPUAbsorbedFluxByObject.errcheck = _check_error
+
+    # Cameras
+    helios_lib.addCPURadiationCameraVec3.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p, ctypes.POINTER(ctypes.c_char_p), ctypes.c_size_t,
+                                                     ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float,
+                                                     ctypes.POINTER(ctypes.c_float), ctypes.c_uint]
+    helios_lib.addCPURadiationCameraVec3.restype = None
+    helios_lib.addCPURadiationCameraVec3.errcheck = _check_error
+
+    helios_lib.addCPURadiationCameraSpherical.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p, ctypes.POINTER(ctypes.c_char_p), ctypes.c_size_t,
+                                                          ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float, ctypes.c_float,
+                                                          ctypes.POINTER(ctypes.c_float), ctypes.c_uint]
+    helios_lib.addCPURadiationCameraSpherical.restype = None
+    helios_lib.addCPURadiationCameraSpherical.errcheck = _check_error
+
+    helios_lib.renderCPURadiationCameras.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.POINTER(ctypes.c_char_p), ctypes.c_size_t]
+    helios_lib.renderCPURadiationCameras.restype = None
+    helios_lib.renderCPURadiationCameras.errcheck = _check_error
+
+    helios_lib.setCPUCameraTiledOnly.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p, ctypes.c_int]
+    helios_lib.setCPUCameraTiledOnly.restype = None
+    helios_lib.setCPUCameraTiledOnly.errcheck = _check_error
+
+    helios_lib.getCPUCameraImageBuffer.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p, ctypes.c_char_p,
+                                                   ctypes.POINTER(ctypes.c_float), ctypes.c_size_t,
+                                                   ctypes.POINTER(ctypes.c_int), ctypes.POINTER(ctypes.c_int)]
+    helios_lib.getCPUCameraImageBuffer.restype = ctypes.c_size_t
+    helios_lib.getCPUCameraImageBuffer.errcheck = _check_error
+
+    helios_lib.renderCPUCameraTiles.argtypes = [ctypes.POINTER(UCPURadiationModel), ctypes.c_char_p, ctypes.c_uint, ctypes.c_uint,
+                                                _CPUCameraTileCallback, ctypes.c_void_p]
+    helios_lib.renderCPUCameraTiles.restype = None
+    helios_lib.renderCPUCameraTiles.errcheck = _check_error
+
+    # Mark that CPU radiation functions are available
+    _CPU_RADIATION_FUNCTIONS_AVAILABLE = True
+
+except AttributeError:
+    # CPU radiation functions not available in current native library
+    _CPU_RADIATION_FUNCTIONS_AVAILABLE = False
+
+# Python wrapper functions
+
+def _require_model(radiation_model, action: str):
+    """Raise if the native CPU backend is missing or the model pointer is None"""
+    if not _CPU_RADIATION_FUNCTIONS_AVAILABLE:
+        raise RuntimeError("CPU radiation functions are not available. Native library missing or built without the CPU radiation backend.")
+    if radiation_model is None:
+        raise ValueError(f"CPU radiation model instance is None. Cannot {action}.")
+
+def createRadiationModel(context):
+    """Create a new CPU radiation model instance"""
+    if not _CPU_RADIATION_FUNCTIONS_AVAILABLE:
+        raise RuntimeError("CPU radiation functions are not available. Native library missing or built without the CPU radiation backend.")
+    return helios_lib.createCPURadiationModel(context)
+
+def destroyRadiationModel(radiation_model):
+    """Destroy CPU radiation model instance"""
+    if radiation_model is None:
+        return  # Destroying None is acceptable - no-op
+    if not _CPU_RADIATION_FUNCTIONS_AVAILABLE:
+        raise RuntimeError("CPU radiation functions are not available. Native library missing or built without the CPU radiation backend.")
+    helios_lib.destroyCPURadiationModel(radiation_model)
+
+def disableMessages(radiation_model):
+    """Disable CPU radiation model messages"""
+    _require_model(radiation_model, "disable messages")
+    helios_lib.disableCPURadiationMessages(radiation_model)
+
+def enableMessages(radiation_model):
+    """Enable CPU radiation model messages"""
+    _require_model(radiation_model, "enable messages")
+    helios_lib.enableCPURadiationMessages(radiation_model)
+
+def setThreadCount(radiation_model, num_threads: int):
+    """Set the number of worker threads (0 = all cores)"""
+    _require_model(radiation_model, "set thread count")
+    helios_lib.setCPURadiationThreadCount(radiation_model, num_threads)
+
+def setSeed(radiation_model, seed: int):
+    """Set the random seed used for ray sampling"""
+    _require_model(radiation_model, "set seed")
+    helios_lib.setCPURadiationSeed(radiation_model, seed)
+
+def addRadiationBand(radiation_model, label: str):
+    """Add radiation band"""
+    _require_model(radiation_model, "add radiation band")
+    helios_lib.addCPURadiationBand(radiation_model, label.encode('utf-8'))
+
+def addRadiationBandWithWavelengths(radiation_model, label: str, wavelength_min: float, wavelength_max: float):
+    """Add radiation band whose optical properties may be integrated from spectra"""
+    _require_model(radiation_model, "add radiation band")
+    helios_lib.addCPURadiationBandWithWavelengths(radiation_model, label.encode('utf-8'), wavelength_min, wavelength_max)
+
+def copyRadiationBand(radiation_model, old_label: str, new_label: str):
+    """Copy existing radiation band to new label"""
+    _require_model(radiation_model, "copy radiation band")
+    helios_lib.copyCPURadiationBand(radiation_model, old_label.encode('utf-8'), new_label.encode('utf-8'))
+
+def addCollimatedRadiationSourceDefault(radiation_model):
+    """Add collimated radiation source pointing straight down (source along +z)"""
+    _require_model(radiation_model, "create radiation source")
+    return helios_lib.addCPUCollimatedRadiationSource(radiation_model, 0.0, 0.0, 1.0)
+
+def addCollimatedRadiationSourceVec3(radiation_model, x: float, y: float, z: float):
+    """Add collimated radiation source; (x, y, z) points toward the source"""
+    _require_model(radiation_model, "create radiation source")
+    return helios_lib.addCPUCollimatedRadiationSource(radiation_model, x, y, z)
+
+def addSphereRadiationSource(radiation_model, x: float, y: float, z: float, radius: float):
+    """Add spherical radiation source"""
+    _require_model(radiation_model, "create radiation source")
+    return helios_lib.addCPUSphereRadiationSource(radiation_model, x, y, z, radius)
+
+def addSunSphereRadiationSource(radiation_model, zenith: float, azimuth: float,
+                               angular_width: float, flux_scaling: float):
+    """Add sun sphere radiation source (zenith, azimuth and angular width in degrees)"""
+    _require_model(radiation_model, "create radiation source")
+    return helios_lib.addCPUSunSphereRadiationSource(radiation_model, zenith, azimuth,
+                                                    angular_width, flux_scaling)
+
+def setDirectRayCount(radiation_model, label: str, count: int):
+    """Set direct ray count for band"""
+    _require_model(radiation_model, "set ray count")
+    helios_lib.setCPUDirectRayCount(radiation_model, label.encode('utf-8'), count)
+
+def setDiffuseRayCount(radiation_model, label: str, count: int):
+    """Set diffuse ray count for band"""
+    _require_model(radiation_model, "set ray count")
+    helios_lib.setCPUDiffuseRayCount(radiation_model, label.encode('utf-8'), count)
+
+def setDiffuseRadiationFlux(radiation_model, label: str, flux: float):
+    """Set diffuse radiation flux for band"""
+    _require_model(radiation_model, "set radiation flux")
+    helios_lib.setCPUDiffuseRadiationFlux(radiation_model, label.encode('utf-8'), flux)
+
+def setSourceFlux(radiation_model, source_id: int, label: str, flux: float):
+    """Set source flux for single source"""
+    _require_model(radiation_model, "set source flux")
+    helios_lib.setCPUSourceFlux(radiation_model, source_id, label.encode('utf-8'), flux)
+
+def setSourceFluxMultiple(radiation_model, source_ids: List[int], label: str, flux: float):
+    """Set source flux for multiple sources"""
+    _require_model(radiation_model, "set source flux")
+    source_array = (ctypes.c_uint * len(source_ids))(*source_ids)
+    helios_lib.setCPUSourceFluxMultiple(radiation_model, source_array, len(source_ids), label.encode('utf-8'), flux)
+
+def getSourceFlux(radiation_model, source_id: int, label: str) -> float:
+    """Get source flux for band"""
+    _require_model(radiation_model, "get source flux")
+    return helios_lib.getCPUSourceFlux(radiation_model, source_id, label.encode('utf-8'))
+
+def setSourceSpectrum(radiation_model, source_id: int, spectrum_label: str):
+    """Set the spectrum weighting spectral optical properties"""
+    _require_model(radiation_model, "set source spectrum")
+    helios_lib.setCPUSourceSpectrum(radiation_model, source_id, spectrum_label.encode('utf-8'))
+
+def setScatteringDepth(radiation_model, label: str, depth: int):
+    """Set scattering depth for band"""
+    _require_model(radiation_model, "set scattering depth")
+    helios_lib.setCPUScatteringDepth(radiation_model, label.encode('utf-8'), depth)
+
+def setMinScatterEnergy(radiation_model, label: str, energy: float):
+    """Set minimum scatter energy for band"""
+    _require_model(radiation_model, "set scatter energy")
+    helios_lib.setCPUMinScatterEnergy(radiation_model, label.encode('utf-8'), energy)
+
+def disableEmission(radiation_model, label: str):
+    """Disable emission for band"""
+    _require_model(radiation_model, "disable emission")
+    helios_lib.disableCPUEmission(radiation_model, label.encode('utf-8'))
+
+def enableEmission(radiation_model, label: str):
+    """Enable emission for band"""
+    _require_model(radiation_model, "enable emission")
+    helios_lib.enableCPUEmission(radiation_model, label.encode('utf-8'))
+
+def enforcePeriodicBoundary(radiation_model, boundary: str):
+    """Make rays leaving the scene laterally re-enter from the opposite side ("x", "y", "xy" or "" to disable)"""
+    _require_model(radiation_model, "enforce periodic boundary")
+    helios_lib.enforceCPUPeriodicBoundary(radiation_model, boundary.encode('utf-8'))
+
+def setScatteringTolerance(radiation_model, label: str, tolerance: float):
+    """Stop scattering once the remaining scattered power is below tolerance times the injected power"""
+    _require_model(radiation_model, "set scattering tolerance")
+    helios_lib.setCPUScatteringTolerance(radiation_model, label.encode('utf-8'), tolerance)
+
+def setAdaptiveRayCount(radiation_model, label: str, target_error: float, max_ray_count: int):
+    """Trace band in rounds until target relative error or ray budget is reached"""
+    _require_model(radiation_model, "set adaptive ray count")
+    helios_lib.setCPUAdaptiveRayCount(radiation_model, label.encode('utf-8'), target_error, max_ray_count)
+
+# Order of values returned by getCPURadiationBandStats
+_BAND_STATS_FIELDS = ("rounds", "direct_rays", "diffuse_rays", "relative_error", "scattering_passes", "scattering_residual")
+
+def getRadiationBandStats(radiation_model, label: str) -> dict:
+    """Get sampling statistics of the last run of a band"""
+    _require_model(radiation_model, "get band statistics")
+    count = helios_lib.getCPURadiationBandStats(radiation_model, label.encode('utf-8'), None, 0)
+    buffer = (ctypes.c_float * count)()
+    helios_lib.getCPURadiationBandStats(radiation_model, label.encode('utf-8'), buffer, count)
+    stats = dict(zip(_BAND_STATS_FIELDS, buffer))
+    for key in ("rounds", "direct_rays", "diffuse_rays", "scattering_passes"):
+        stats[key] = int(stats[key])
+    return stats
+
+def enableFluxSuperposition(radiation_model):
+    """Cache per-source unit-flux responses so flux changes do not require re-tracing"""
+    _require_model(radiation_model, "enable flux superposition")
+    helios_lib.enableCPUFluxSuperposition(radiation_model)
+
+def disableFluxSuperposition(radiation_model):
+    """Stop caching unit-flux responses"""
+    _require_model(radiation_model, "disable flux superposition")
+    helios_lib.disableCPUFluxSuperposition(radiation_model)
+
+def enableViewFactorOperator(radiation_model, tolerance: float, max_bytes: int):
+    """Build a sparse exchange operator on the next run and reuse it for diffuse and scattering passes"""
+    _require_model(radiation_model, "enable view factor operator")
+    helios_lib.enableCPUViewFactorOperator(radiation_model, tolerance, max_bytes)
+
+def disableViewFactorOperator(radiation_model):
+    """Drop the exchange operator and trace diffuse radiation again"""
+    _require_model(radiation_model, "disable view factor operator")
+    helios_lib.disableCPUViewFactorOperator(radiation_model)
+
+def getViewFactorOperatorInfo(radiation_model) -> dict:
+    """Get memory footprint (bytes) and number of stored entries of the exchange operator"""
+    _require_model(radiation_model, "get view factor operator info")
+    return {
+        "bytes": helios_lib.getCPUViewFactorOperatorBytes(radiation_model),
+        "nonzeros": helios_lib.getCPUViewFactorOperatorNonzeros(radiation_model),
+    }
+
+def precomputeSunlitFractions(radiation_model, directions: List[List[float]], ray_count: int, max_angle: float):
+    """Precompute per-primitive sunlit fractions for a list of (x, y, z) sun directions in one batched trace"""
+    _require_model(radiation_model, "precompute sunlit fractions")
+    flat = [float(c) for direction in directions for c in direction]
+    direction_array = (ctypes.c_float * len(flat))(*flat)
+    helios_lib.precomputeCPUSunlitFractions(radiation_model, direction_array, len(directions), ray_count, max_angle)
+
+def clearSunlitFractions(radiation_model):
+    """Drop the sunlit fraction cache and trace every source again"""
+    _require_model(radiation_model, "clear sunlit fractions")
+    helios_lib.clearCPUSunlitFractions(radiation_model)
+
+def getSunlitFractionBytes(radiation_model) -> int:
+    """Get memory footprint of the sunlit fraction cache in bytes"""
+    _require_model(radiation_model, "get sunlit fraction cache size")
+    return helios_lib.getCPUSunlitFractionBytes(radiation_model)
+
+def updateGeometry(radiation_model):
+    """Update all geometry in CPU radiation model"""
+    _require_model(radiation_model, "update geometry")
+    helios_lib.updateCPURadiationGeometry(radiation_model)
+
+def updateGeometryUUIDs(radiation_model, uuids: List[int]):
+    """Update specific geometry UUIDs in CPU radiation model"""
+    _require_model(radiation_model, "update geometry")
+    uuid_array = (ctypes.c_uint * len(uuids))(*uuids)
+    helios_lib.updateCPURadiationGeometryUUIDs(radiation_model, uuid_array, len(uuids))
+
+def updateGeometryDirty(radiation_model) -> int:
+    """Update CPU radiation geometry only if primitives changed since the last geometry update"""
+    _require_model(radiation_model, "update geometry")
+    return helios_lib.updateCPURadiationGeometryDirty(radiation_model)
+
+def updateGeometryIfChanged(radiation_model) -> bool:
+    """Bring CPU radiation geometry up to date, touching only the changed primitives"""
+    return updateGeometryDirty(radiation_model) > 0
+
+def runBand(radiation_model, label: str):
+    """Run simulation for single band"""
+    _require_model(radiation_model, "run simulation")
+    helios_lib.runCPURadiationBand(radiation_model, label.encode('utf-8'))
+
+def runBandMultiple(radiation_model, labels: List[str]):
+    """Run simulation for multiple bands"""
+    _require_model(radiation_model, "run simulation")
+    encoded_labels = [label.encode('utf-8') for label in labels]
+    label_array = (ctypes.c_char_p * len(encoded_labels))(*encoded_labels)
+    helios_lib.runCPURadiationBandMultiple(radiation_model, label_array, len(encoded_labels))
+
+def runBandAsync(radiation_model, labels: List[str]):
+    """
+    Start simulating one or more bands on a background native thread.
+
+    Returns:
+        Opaque job handle for pollRadiationJob/waitRadiationJob/cancelRadiationJob.
+        The handle must be released with destroyRadiationJob.
+    """
+    _require_model(radiation_model, "run simulation")
+    encoded_labels = [label.encode('utf-8') for label in labels]
+    label_array = (ctypes.c_char_p * len(encoded_labels))(*encoded_labels)
+    return helios_lib.runCPURadiationBandAsync(radiation_model, label_array, len(encoded_labels))
+
+def _require_job(job, action: str):
+    """Raise if the native CPU backend is missing or the job handle is None"""
+    if not _CPU_RADIATION_FUNCTIONS_AVAILABLE:
+        raise RuntimeError("CPU radiation functions are not available. Native library missing or built without the CPU radiation backend.")
+    if job is None:
+        raise ValueError(f"Radiation job handle is None. Cannot {action}.")
+
+def pollRadiationJob(job) -> bool:
+    """Return True if the asynchronous run has finished (successfully or not)"""
+    _require_job(job, "poll job")
+    return bool(helios_lib.pollCPURadiationJob(job))
+
+def waitRadiationJob(job, timeout: float = None) -> bool:
+    """
+    Block until the asynchronous run finishes or the timeout (seconds) expires.
+
+    Returns:
+        True if the run finished, False on timeout. A failed or cancelled run raises the
+        error it stopped with.
+    """
+    _require_job(job, "wait for job")
+    return bool(helios_lib.waitCPURadiationJob(job, -1.0 if timeout is None else float(timeout)))
+
+def getRadiationJobProgress(job) -> float:
+    """Get the completed fraction (0 to 1) of an asynchronous run"""
+    _require_job(job, "get job progress")
+    return helios_lib.getCPURadiationJobProgress(job)
+
+def cancelRadiationJob(job):
+    """Request cancellation of an asynchronous run"""
+    _require_job(job, "cancel job")
+    helios_lib.cancelCPURadiationJob(job)
+
+def destroyRadiationJob(job):
+    """Release a job handle, cancelling and joining the run if it is still going"""
+    if job is None:
+        return  # Destroying None is acceptable - no-op
+    if not _CPU_RADIATION_FUNCTIONS_AVAILABLE:
+        raise RuntimeError("CPU radiation functions are not available. Native library missing or built without the CPU radiation backend.")
+    helios_lib.destroyCPURadiationJob(job)
+
+def getTotalAbsorbedFlux(radiation_model) -> List[float]:
+    """Get total absorbed flux for all primitives"""
+    return getTotalAbsorbedFluxArray(radiation_model).tolist()
+
+def getTotalAbsorbedFluxArray(radiation_model, out=None):
+    """
+    Get total absorbed flux for all primitives as a float32 NumPy array.
+
+    Args:
+        radiation_model: CPU radiation model pointer
+        out: Optional preallocated contiguous float32 array of length >= primitive count.
+             When given, flux is written into it directly and a view of the filled part is returned.
+
+    Returns:
+        NumPy float32 array of absorbed flux per primitive
+    """
+    _require_model(radiation_model, "get absorbed flux")
+
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    if out is not None:
+        if out.dtype != np.float32 or not out.flags['C_CONTIGUOUS']:
+            raise ValueError("Output buffer must be a contiguous float32 NumPy array")
+        count = helios_lib.getCPUTotalAbsorbedFluxToBuffer(radiation_model, out.ctypes.data_as(ctypes.POINTER(ctypes.c_float)), out.size)
+        if count > out.size:
+            raise ValueError(f"Output buffer holds {out.size} values, but {count} primitives have absorbed flux")
+        return out[:count]
+
+    count = helios_lib.getCPUTotalAbsorbedFluxToBuffer(radiation_model, None, 0)
+    while True:
+        result = np.empty(count, dtype=np.float32)
+        required = helios_lib.getCPUTotalAbsorbedFluxToBuffer(radiation_model, result.ctypes.data_as(ctypes.POINTER(ctypes.c_float)), count)
+        if required <= count:
+            return result[:required]
+        count = required
+
+def getAbsorbedFluxBands(radiation_model, context, band_labels: List[str]):
+    """
+    Get absorbed flux for several bands in one call.
+
+    Args:
+        radiation_model: CPU radiation model pointer
+        context: Context pointer the model was created with (unused; the model keeps its Context)
+        band_labels: List of band labels
+
+    Returns:
+        NumPy float32 array of shape (len(band_labels), primitive_count), columns in getAllUUIDs() order
+    """
+    _require_model(radiation_model, "get absorbed flux")
+    if not band_labels:
+        raise ValueError("Band labels list cannot be empty")
+
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    encoded = [label.encode('utf-8') for label in band_labels]
+    label_array = (ctypes.c_char_p * len(encoded))(*encoded)
+
+    primitive_count = helios_lib.getCPUAbsorbedFluxBands(radiation_model, label_array, len(encoded), None, 0)
+    while True:
+        result = np.empty((len(encoded), primitive_count), dtype=np.float32)
+        required = helios_lib.getCPUAbsorbedFluxBands(radiation_model, label_array, len(encoded),
+                                                      result.ctypes.data_as(ctypes.POINTER(ctypes.c_float)), result.size)
+        if required == primitive_count:
+            return result
+        primitive_count = required
+
+def aggregateAbsorbedFlux(radiation_model, context, band_label: str, uuids, groups, group_count: int):
+    """
+    Sum absorbed power and area of one band per group of primitives.
+
+    Args:
+        radiation_model: CPU radiation model pointer
+        context: Context pointer the model was created with (unused; the model keeps its Context)
+        band_label: Band label
+        uuids: Contiguous uint32 array of primitive UUIDs
+        groups: Contiguous uint32 array with the group index of each primitive
+        group_count: Number of groups
+
+    Returns:
+        Tuple (power, area) of float64 arrays with one entry per group
+    """
+    _require_model(radiation_model, "aggregate absorbed flux")
+
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    power = np.zeros(group_count, dtype=np.float64)
+    area = np.zeros(group_count, dtype=np.float64)
+    helios_lib.aggregateCPUAbsorbedFlux(radiation_model, band_label.encode('utf-8'),
+                                        uuids.ctypes.data_as(ctypes.POINTER(ctypes.c_uint)),
+                                        groups.ctypes.data_as(ctypes.POINTER(ctypes.c_uint)), uuids.size, group_count,
+                                        power.ctypes.data_as(ctypes.POINTER(ctypes.c_double)),
+                                        area.ctypes.data_as(ctypes.POINTER(ctypes.c_double)))
+    return power, area
+
+def aggregateAbsorbedFluxByObject(radiation_model, context, band_label: str):
+    """
+    Sum absorbed power and area of one band per parent Context object.
+
+    Args:
+        radiation_model: CPU radiation model pointer
+        context: Context pointer the model was created with (unused; the model keeps its Context)
+        band_label: Band label
+
+    Returns:
+        Tuple (object_ids, power, area) of arrays with one entry per object, in ascending ID order
+    """
+    _require_model(radiation_model, "aggregate absorbed flux")
+
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    encoded = band_label.encode('utf-8')
+    count = helios_lib.aggregateCPUAbsorbedFluxByObject(radiation_model, encoded, None, None, None, 0)
+    while True:
+        object_ids = np.empty(count, dtype=np.uint32)
+        power = np.empty(count, dtype=np.float64)
+        area = np.empty(count, dtype=np.float64)
+        required = helios_lib.aggregateCPUAbsorbedFluxByObject(radiation_model, encoded,
+                                                               object_ids.ctypes.data_as(ctypes.POINTER(ctypes.c_uint)),
+                                                               power.ctypes.data_as(ctypes.POINTER(ctypes.c_double)),
+                                                               area.ctypes.data_as(ctypes.POINTER(ctypes.c_double)), count)
+        if required == count:
+            return object_ids, power, area
+        count = required
+
+def _camera_arrays(band_labels: List[str], camera_properties: List[float]):
+    """Validate camera arguments and convert them to ctypes arrays"""
+    if not band_labels:
+        raise ValueError("At least one band label is required")
+    if len(camera_properties) != 6:
+        raise ValueError("camera_properties must contain exactly 6 values: [resolution_x, resolution_y, focal_distance, lens_diameter, HFOV, FOV_aspect_ratio]")
+    band_array = (ctypes.c_char_p * len(band_labels))(*[label.encode('utf-8') for label in band_labels])
+    props_array = (ctypes.c_float * 6)(*camera_properties)
+    return band_array, props_array
+
+def addRadiationCameraVec3(radiation_model, camera_label: str, band_labels: List[str],
+                           position_x: float, position_y: float, position_z: float,
+                           lookat_x: float, lookat_y: float, lookat_z: float,
+                           camera_properties: List[float], antialiasing_samples: int):
+    """Add radiation camera with position and lookat vectors"""
+    _require_model(radiation_model, "add radiation camera")
+    band_array, props_array = _camera_arrays(band_labels, camera_properties)
+    helios_lib.addCPURadiationCameraVec3(radiation_model, camera_label.encode('utf-8'), band_array, len(band_labels),
+                                         position_x, position_y, position_z, lookat_x, lookat_y, lookat_z,
+                                         props_array, antialiasing_samples)
+
+def addRadiationCameraSpherical(radiation_model, camera_label: str, band_labels: List[str],
+                                position_x: float, position_y: float, position_z: float,
+                                radius: float, elevation: float, azimuth: float,
+                                camera_properties: List[float], antialiasing_samples: int):
+    """Add radiation camera with position and spherical viewing direction"""
+    _require_model(radiation_model, "add radiation camera")
+    band_array, props_array = _camera_arrays(band_labels, camera_properties)
+    helios_lib.addCPURadiationCameraSpherical(radiation_model, camera_label.encode('utf-8'), band_array, len(band_labels),
+                                              position_x, position_y, position_z, radius, elevation, azimuth,
+                                              props_array, antialiasing_samples)
+
+def renderCameras(radiation_model, camera_labels: List[str] = None):
+    """Render cameras in one batch from the last run of their bands (None = all cameras)"""
+    _require_model(radiation_model, "render cameras")
+    labels = camera_labels or []
+    label_array = (ctypes.c_char_p * len(labels))(*[label.encode('utf-8') for label in labels])
+    helios_lib.renderCPURadiationCameras(radiation_model, label_array, len(labels))
+
+def setCameraTiledOnly(radiation_model, camera: str, tiled_only: bool):
+    """Restrict a camera to streamed rendering through renderCameraTiles"""
+    _require_model(radiation_model, "set camera rendering mode")
+    helios_lib.setCPUCameraTiledOnly(radiation_model, camera.encode('utf-8'), int(tiled_only))
+
+def getCameraImageBuffer(radiation_model, camera: str, band: str):
+    """
+    Get the pixel data of one camera band.
+
+    Args:
+        radiation_model: CPU radiation model pointer
+        camera: Camera label
+        band: Band label
+
+    Returns:
+        NumPy float32 array of shape (height, width)
+    """
+    _require_model(radiation_model, "get camera image")
+
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    camera_encoded = camera.encode('utf-8')
+    band_encoded = band.encode('utf-8')
+    width = ctypes.c_int()
+    height = ctypes.c_int()
+
+    count = helios_lib.getCPUCameraImageBuffer(radiation_model, camera_encoded, band_encoded, None, 0,
+                                               ctypes.byref(width), ctypes.byref(height))
+    result = np.empty(count, dtype=np.float32)
+    helios_lib.getCPUCameraImageBuffer(radiation_model, camera_encoded, band_encoded,
+                                       result.ctypes.data_as(ctypes.POINTER(ctypes.c_float)), count,
+                                       ctypes.byref(width), ctypes.byref(height))
+    return result.reshape(height.value, width.value)
+
+def getCameraImageRGB(radiation_model, camera: str, bands: List[str], flux_to_pixel_conversion: float = 1.0,
+                      normalize: bool = False, dtype: str = "float32"):
+    """
+    Get an RGB composite of three camera bands, scaled and clamped like the OptiX backend.
+
+    Args:
+        radiation_model: CPU radiation model pointer
+        camera: Camera label
+        bands: Red, green and blue band labels
+        flux_to_pixel_conversion: Conversion factor from flux to pixel value (ignored if normalize is True)
+        normalize: Divide by the maximum pixel value over the three bands
+        dtype: "float32" for values in [0, 1] or "uint8" for values in [0, 255]
+
+    Returns:
+        NumPy array of shape (height, width, 3)
+    """
+    if len(bands) != 3:
+        raise ValueError("Exactly three band labels (red, green, blue) are required")
+    if dtype not in ("float32", "uint8"):
+        raise ValueError(f"dtype must be 'float32' or 'uint8', got '{dtype}'")
+
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    rgb = np.stack([getCameraImageBuffer(radiation_model, camera, band) for band in bands], axis=-1)
+    scale = np.float32(flux_to_pixel_conversion)
+    if normalize:
+        max_value = rgb.max()
+        scale = np.float32(1.0 / max_value) if max_value > 0 else np.float32(0.0)
+    rgb = np.clip(rgb * scale, 0.0, 1.0)
+    if dtype == "uint8":
+        return (rgb * 255.0 + 0.5).astype(np.uint8)
+    return rgb
+
+def renderCameraTiles(radiation_model, camera: str, tile_width: int, tile_height: int, writer):
+    """
+    Render a camera tile by tile and pass each tile to writer(band, x0, y0, pixels).
+
+    pixels is a float32 array of shape (tile_height, tile_width) that is only valid during the call.
+    An exception raised by writer stops rendering and is re-raised here.
+    """
+    _require_model(radiation_model, "render camera tiles")
+
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    failure = []
+
+    def callback(user_data, band, x0, y0, width, height, pixels):
+        try:
+            tile = np.ctypeslib.as_array(pixels, shape=(height, width))
+            writer(band.decode('utf-8'), x0, y0, tile)
+            return 0
+        except BaseException as e:
+            failure.append(e)
+            return 1
+
+    c_callback = _CPUCameraTileCallback(callback)
+    try:
+        helios_lib.renderCPUCameraTiles(radiation_model, camera.encode('utf-8'), tile_width, tile_height, c_callback, None)
+    except Exception:
+        if failure:
+            raise failure[0]
+        raise
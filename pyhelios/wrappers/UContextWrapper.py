@@ -28,8 +28,12 @@ helios_lib.createContext.restype = ctypes.POINTER(UContext)
 helios_lib.destroyContext.argtypes = [ctypes.POINTER(UContext)]
 
 helios_lib.markGeometryClean.argtypes = [ctypes.POINTER(UContext)]
+helios_lib.markGeometryClean.restype = None
+helios_lib.markGeometryClean.errcheck = _check_error
 
 helios_lib.markGeometryDirty.argtypes = [ctypes.POINTER(UContext)]
+helios_lib.markGeometryDirty.restype = None
+helios_lib.markGeometryDirty.errcheck = _check_error
 
 helios_lib.isGeometryDirty.argtypes = [ctypes.POINTER(UContext)]
 helios_lib.isGeometryDirty.restype = ctypes.c_bool
@@ -427,6 +431,23 @@ try:
 except AttributeError:
     pass
 
+# Bulk triangle mesh function (may not be available in all builds)
+try:
+    helios_lib.addTrianglesBulk.argtypes = [
+        ctypes.POINTER(UContext),                    # context
+        ctypes.POINTER(ctypes.c_float),             # vertices
+        ctypes.c_size_t,                            # nverts
+        ctypes.POINTER(ctypes.c_uint),              # faces
+        ctypes.c_size_t,                            # nfaces
+        ctypes.POINTER(ctypes.c_float),             # colors (nullable)
+        ctypes.POINTER(ctypes.c_uint)               # out_uuids
+    ]
+    helios_lib.addTrianglesBulk.restype = ctypes.c_uint
+    helios_lib.addTrianglesBulk.errcheck = _check_error
+    _AVAILABLE_TRIANGLE_FUNCTIONS.append('addTrianglesBulk')
+except AttributeError:
+    pass
+
 # Mark triangle functions as available if we found any basic functions
 _TRIANGLE_FUNCTIONS_AVAILABLE = len(_AVAILABLE_TRIANGLE_FUNCTIONS) > 0
 
@@ -475,6 +496,89 @@ except AttributeError:
     # Functions not available in current library build
     _COMPOUND_GEOMETRY_FUNCTIONS_AVAILABLE = False
 
+# Caller-buffer ID list function prototypes (may not be available in all builds)
+try:
+    helios_lib.getAllUUIDsToBuffer.argtypes = [ctypes.POINTER(UContext), ctypes.POINTER(ctypes.c_uint), ctypes.c_size_t]
+    helios_lib.getAllUUIDsToBuffer.restype = ctypes.c_size_t
+    helios_lib.getAllUUIDsToBuffer.errcheck = _check_error
+
+    helios_lib.getAllObjectIDsToBuffer.argtypes = [ctypes.POINTER(UContext), ctypes.POINTER(ctypes.c_uint), ctypes.c_size_t]
+    helios_lib.getAllObjectIDsToBuffer.restype = ctypes.c_size_t
+    helios_lib.getAllObjectIDsToBuffer.errcheck = _check_error
+
+    helios_lib.getObjectPrimitiveUUIDsToBuffer.argtypes = [ctypes.POINTER(UContext), ctypes.c_uint, ctypes.POINTER(ctypes.c_uint), ctypes.c_size_t]
+    helios_lib.getObjectPrimitiveUUIDsToBuffer.restype = ctypes.c_size_t
+    helios_lib.getObjectPrimitiveUUIDsToBuffer.errcheck = _check_error
+
+    _BUFFER_ID_FUNCTIONS_AVAILABLE = True
+except AttributeError:
+    _BUFFER_ID_FUNCTIONS_AVAILABLE = False
+
+# Caller-buffer per-primitive geometry function prototypes (may not be available in all builds)
+try:
+    helios_lib.getPrimitiveVerticesToBuffer.argtypes = [ctypes.POINTER(UContext), ctypes.c_uint, ctypes.POINTER(ctypes.c_float), ctypes.c_size_t]
+    helios_lib.getPrimitiveVerticesToBuffer.restype = ctypes.c_size_t
+    helios_lib.getPrimitiveVerticesToBuffer.errcheck = _check_error
+
+    for _name in ('getPrimitiveNormalToBuffer', 'getPrimitiveColorToBuffer', 'getPrimitiveColorRGBToBuffer', 'getPrimitiveColorRGBAToBuffer'):
+        getattr(helios_lib, _name).argtypes = [ctypes.POINTER(UContext), ctypes.c_uint, ctypes.POINTER(ctypes.c_float)]
+        getattr(helios_lib, _name).restype = None
+        getattr(helios_lib, _name).errcheck = _check_error
+
+    _BUFFER_GEOMETRY_FUNCTIONS_AVAILABLE = True
+except AttributeError:
+    _BUFFER_GEOMETRY_FUNCTIONS_AVAILABLE = False
+
+# Bulk geometry export function prototype (may not be available in all builds)
+try:
+    helios_lib.getPrimitiveGeometryBulk.argtypes = [
+        ctypes.POINTER(UContext),                    # context
+        ctypes.POINTER(ctypes.c_uint),              # uuids
+        ctypes.c_size_t,                            # n
+        ctypes.POINTER(ctypes.c_uint),              # vertex_offsets (n+1)
+        ctypes.POINTER(ctypes.c_float),             # vertices (nullable for size query)
+        ctypes.c_size_t,                            # vertex_capacity
+        ctypes.POINTER(ctypes.c_float),             # normals (nullable)
+        ctypes.POINTER(ctypes.c_float),             # areas (nullable)
+        ctypes.POINTER(ctypes.c_uint),              # types (nullable)
+        ctypes.POINTER(ctypes.c_float)              # colors (nullable)
+    ]
+    helios_lib.getPrimitiveGeometryBulk.restype = ctypes.c_size_t
+    helios_lib.getPrimitiveGeometryBulk.errcheck = _check_error
+    _GEOMETRY_BULK_FUNCTIONS_AVAILABLE = True
+except AttributeError:
+    _GEOMETRY_BULK_FUNCTIONS_AVAILABLE = False
+
+# Geometry revision / shared BVH cache functions (may not be available in all builds)
+try:
+    helios_lib.getGeometryRevision.argtypes = [ctypes.POINTER(UContext)]
+    helios_lib.getGeometryRevision.restype = ctypes.c_ulonglong
+    helios_lib.getGeometryRevision.errcheck = _check_error
+
+    helios_lib.getGeometryCacheStats.argtypes = [
+        ctypes.POINTER(UContext),
+        ctypes.POINTER(ctypes.c_ulonglong),
+        ctypes.POINTER(ctypes.c_ulonglong)
+    ]
+    helios_lib.getGeometryCacheStats.restype = None
+    helios_lib.getGeometryCacheStats.errcheck = _check_error
+    _GEOMETRY_REVISION_FUNCTIONS_AVAILABLE = True
+except AttributeError:
+    _GEOMETRY_REVISION_FUNCTIONS_AVAILABLE = False
+
+# Per-primitive dirty tracking functions (may not be available in all builds)
+try:
+    helios_lib.getDirtyPrimitiveUUIDs.argtypes = [ctypes.POINTER(UContext), ctypes.POINTER(ctypes.c_uint), ctypes.c_size_t]
+    helios_lib.getDirtyPrimitiveUUIDs.restype = ctypes.c_size_t
+    helios_lib.getDirtyPrimitiveUUIDs.errcheck = _check_error
+
+    helios_lib.getDeletedPrimitiveUUIDs.argtypes = [ctypes.POINTER(UContext), ctypes.POINTER(ctypes.c_uint), ctypes.c_size_t]
+    helios_lib.getDeletedPrimitiveUUIDs.restype = ctypes.c_size_t
+    helios_lib.getDeletedPrimitiveUUIDs.errcheck = _check_error
+    _DIRTY_UUID_FUNCTIONS_AVAILABLE = True
+except AttributeError:
+    _DIRTY_UUID_FUNCTIONS_AVAILABLE = False
+
 # Legacy compatibility: set _NEW_FUNCTIONS_AVAILABLE based on primitive data availability
 _NEW_FUNCTIONS_AVAILABLE = _PRIMITIVE_DATA_FUNCTIONS_AVAILABLE
 
@@ -494,6 +598,29 @@ def markGeometryDirty(context):
 def isGeometryDirty(context):
     return helios_lib.isGeometryDirty(context)
 
+def getGeometryRevision(context) -> int:
+    if not _GEOMETRY_REVISION_FUNCTIONS_AVAILABLE:
+        raise NotImplementedError("getGeometryRevision not available in current Helios library. Rebuild PyHelios with updated C++ wrapper implementation.")
+    return helios_lib.getGeometryRevision(context)
+
+def getDirtyPrimitiveUUIDs(context) -> List[int]:
+    if not _DIRTY_UUID_FUNCTIONS_AVAILABLE:
+        raise NotImplementedError("getDirtyPrimitiveUUIDs not available in current Helios library. Rebuild PyHelios with updated C++ wrapper implementation.")
+    return _copy_id_list(helios_lib.getDirtyPrimitiveUUIDs, context)
+
+def getDeletedPrimitiveUUIDs(context) -> List[int]:
+    if not _DIRTY_UUID_FUNCTIONS_AVAILABLE:
+        raise NotImplementedError("getDeletedPrimitiveUUIDs not available in current Helios library. Rebuild PyHelios with updated C++ wrapper implementation.")
+    return _copy_id_list(helios_lib.getDeletedPrimitiveUUIDs, context)
+
+def getGeometryCacheStats(context) -> dict:
+    if not _GEOMETRY_REVISION_FUNCTIONS_AVAILABLE:
+        raise NotImplementedError("getGeometryCacheStats not available in current Helios library. Rebuild PyHelios with updated C++ wrapper implementation.")
+    builds = ctypes.c_ulonglong()
+    refits = ctypes.c_ulonglong()
+    helios_lib.getGeometryCacheStats(context, ctypes.byref(builds), ctypes.byref(refits))
+    return {'builds': builds.value, 'refits': refits.value}
+
 def addPatch(context):
     result = helios_lib.addPatch(context)
     return result
@@ -532,24 +659,50 @@ def getPrimitiveArea(context, uuid):
     # Error checking is handled automatically by errcheck
     return helios_lib.getPrimitiveArea(context, uuid)
 
+def _copy_fixed_floats(func, context, uuid, count):
+    """Fill a caller-owned float array through a fixed-size *ToBuffer function."""
+    values = (ctypes.c_float * count)()
+    func(context, uuid, values)
+    return values
+
 def getPrimitiveNormal(context, uuid):
     # Error checking is handled automatically by errcheck
+    if _BUFFER_GEOMETRY_FUNCTIONS_AVAILABLE:
+        return _copy_fixed_floats(helios_lib.getPrimitiveNormalToBuffer, context, uuid, 3)
     return helios_lib.getPrimitiveNormal(context, uuid)
 
 def getPrimitiveVertices(context, uuid, size):
     # Error checking is handled automatically by errcheck
     return helios_lib.getPrimitiveVertices(context, uuid, size)
 
+def getPrimitiveVerticesList(context, uuid) -> List[float]:
+    """Get the vertex coordinates of a primitive as a flat [x0, y0, z0, x1, ...] list."""
+    if _BUFFER_GEOMETRY_FUNCTIONS_AVAILABLE:
+        capacity = helios_lib.getPrimitiveVerticesToBuffer(context, uuid, None, 0)
+        buffer = (ctypes.c_float * capacity)()
+        count = helios_lib.getPrimitiveVerticesToBuffer(context, uuid, buffer, capacity)
+        return list(buffer[:count])
+    size = ctypes.c_uint()
+    vertices_ptr = helios_lib.getPrimitiveVertices(context, uuid, ctypes.byref(size))
+    # size.value is the total number of floats (3 per vertex), not the number of vertices
+    return list(vertices_ptr[:size.value])
+
 def getPrimitiveColor(context, uuid):
     # Error checking is handled automatically by errcheck
+    if _BUFFER_GEOMETRY_FUNCTIONS_AVAILABLE:
+        return _copy_fixed_floats(helios_lib.getPrimitiveColorToBuffer, context, uuid, 3)
     return helios_lib.getPrimitiveColor(context, uuid)
 
 def getPrimitiveColorRGB(context, uuid):
     # Error checking is handled automatically by errcheck
+    if _BUFFER_GEOMETRY_FUNCTIONS_AVAILABLE:
+        return _copy_fixed_floats(helios_lib.getPrimitiveColorRGBToBuffer, context, uuid, 3)
     return helios_lib.getPrimitiveColorRGB(context, uuid)
 
 def getPrimitiveColorRGBA(context, uuid):
     # Error checking is handled automatically by errcheck
+    if _BUFFER_GEOMETRY_FUNCTIONS_AVAILABLE:
+        return _copy_fixed_floats(helios_lib.getPrimitiveColorRGBAToBuffer, context, uuid, 4)
     return helios_lib.getPrimitiveColorRGBA(context, uuid)
 
 def getPrimitiveCount(context):
@@ -568,10 +721,94 @@ def getAllObjectIDs(context, size):
 
 def getObjectPrimitiveUUIDs(context, object_id:int):
     # Error checking is handled automatically by errcheck
+    if _BUFFER_ID_FUNCTIONS_AVAILABLE:
+        return _copy_id_list(helios_lib.getObjectPrimitiveUUIDsToBuffer, context, object_id)
     size = ctypes.c_uint()
     uuids_ptr = helios_lib.getObjectPrimitiveUUIDs(context, object_id, ctypes.byref(size))
     return list(uuids_ptr[:size.value])
 
+def _copy_id_list(func, *args) -> List[int]:
+    """Size-query a *ToBuffer function, then copy into caller-owned storage (retrying if the list grew in between)."""
+    capacity = func(*args, None, 0)
+    while True:
+        buffer = (ctypes.c_uint * capacity)()
+        count = func(*args, buffer, capacity)
+        if count <= capacity:
+            return list(buffer[:count])
+        capacity = count
+
+def getAllUUIDsList(context) -> List[int]:
+    """Get all primitive UUIDs as a list, without sharing wrapper-owned storage when the native library allows it."""
+    if _BUFFER_ID_FUNCTIONS_AVAILABLE:
+        return _copy_id_list(helios_lib.getAllUUIDsToBuffer, context)
+    size = ctypes.c_uint()
+    uuids_ptr = helios_lib.getAllUUIDs(context, ctypes.byref(size))
+    return list(uuids_ptr[:size.value])
+
+def getAllObjectIDsList(context) -> List[int]:
+    """Get all object IDs as a list, without sharing wrapper-owned storage when the native library allows it."""
+    if _BUFFER_ID_FUNCTIONS_AVAILABLE:
+        return _copy_id_list(helios_lib.getAllObjectIDsToBuffer, context)
+    size = ctypes.c_uint()
+    objectids_ptr = helios_lib.getAllObjectIDs(context, ctypes.byref(size))
+    return list(objectids_ptr[:size.value])
+
+def getPrimitiveGeometryBulk(context, uuids) -> dict:
+    """
+    Export geometry for many primitives as NumPy structure-of-arrays in two native calls.
+
+    Args:
+        context: Context pointer
+        uuids: Sequence or NumPy array of primitive UUIDs
+
+    Returns:
+        Dictionary with keys:
+            'vertex_offsets': uint32 array (N+1,); vertices of primitive i are vertices[offsets[i]:offsets[i+1]]
+            'vertices': float32 array (V, 3) of packed vertices
+            'normals': float32 array (N, 3)
+            'areas': float32 array (N,)
+            'types': uint32 array (N,) of PrimitiveType values
+            'colors': float32 array (N, 4) of RGBA colors
+    """
+    if not _GEOMETRY_BULK_FUNCTIONS_AVAILABLE:
+        raise NotImplementedError("getPrimitiveGeometryBulk not available in current Helios library. Rebuild PyHelios with updated C++ wrapper implementation.")
+
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    uuid_array = np.ascontiguousarray(uuids, dtype=np.uint32)
+    n = uuid_array.size
+    uuid_ptr = uuid_array.ctypes.data_as(ctypes.POINTER(ctypes.c_uint))
+    float_ptr = ctypes.POINTER(ctypes.c_float)
+    uint_ptr = ctypes.POINTER(ctypes.c_uint)
+
+    vertex_offsets = np.zeros(n + 1, dtype=np.uint32)
+
+    # First pass: size query fills the offsets and returns the total vertex count
+    total_vertices = helios_lib.getPrimitiveGeometryBulk(context, uuid_ptr, n, vertex_offsets.ctypes.data_as(uint_ptr),
+                                                         None, 0, None, None, None, None)
+
+    vertices = np.empty((total_vertices, 3), dtype=np.float32)
+    normals = np.empty((n, 3), dtype=np.float32)
+    areas = np.empty(n, dtype=np.float32)
+    types = np.empty(n, dtype=np.uint32)
+    colors = np.empty((n, 4), dtype=np.float32)
+
+    if n > 0:
+        helios_lib.getPrimitiveGeometryBulk(context, uuid_ptr, n, vertex_offsets.ctypes.data_as(uint_ptr),
+                                            vertices.ctypes.data_as(float_ptr), total_vertices,
+                                            normals.ctypes.data_as(float_ptr), areas.ctypes.data_as(float_ptr),
+                                            types.ctypes.data_as(uint_ptr), colors.ctypes.data_as(float_ptr))
+
+    return {
+        'vertex_offsets': vertex_offsets,
+        'vertices': vertices,
+        'normals': normals,
+        'areas': areas,
+        'types': types,
+        'colors': colors,
+    }
+
 # Python wrappers for loadPLY functions
 def loadPLY(context, filename:str, silent:bool=False):
     if not _FILE_LOADING_FUNCTIONS_AVAILABLE:
@@ -926,6 +1163,53 @@ def addTrianglesFromArraysMultiTextured(context, vertices, faces,
     else:
         return []
 
+def addTrianglesBulk(context, vertices, faces, colors=None) -> List[int]:
+    """
+    Add an indexed triangle mesh in a single native call.
+
+    Args:
+        context: Helios context
+        vertices: NumPy array of shape (N, 3) containing vertex coordinates
+        faces: NumPy array of shape (M, 3) containing triangle vertex indices
+        colors: Optional NumPy array of shape (M, 3) containing per-triangle RGB colors
+
+    Returns:
+        List of UUIDs for the added triangles, in face order
+    """
+    if 'addTrianglesBulk' not in _AVAILABLE_TRIANGLE_FUNCTIONS:
+        raise NotImplementedError(
+            "addTrianglesBulk function not available in current Helios library. "
+            "Rebuild PyHelios with updated C++ wrapper: build_scripts/build_helios"
+        )
+
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    # Contiguous buffers are handed to the native side directly, without per-element marshalling
+    vertices_c = np.ascontiguousarray(vertices, dtype=np.float32)
+    faces_c = np.ascontiguousarray(faces, dtype=np.uint32)
+    nverts = vertices_c.shape[0]
+    nfaces = faces_c.shape[0]
+
+    colors_ptr = None
+    if colors is not None:
+        colors_c = np.ascontiguousarray(colors, dtype=np.float32)
+        if colors_c.shape != (nfaces, 3):
+            raise ValueError(f"Colors array must have shape ({nfaces}, 3), got {colors_c.shape}")
+        colors_ptr = colors_c.ctypes.data_as(ctypes.POINTER(ctypes.c_float))
+
+    out_uuids = np.empty(nfaces, dtype=np.uint32)
+
+    helios_lib.addTrianglesBulk(
+        context,
+        vertices_c.ctypes.data_as(ctypes.POINTER(ctypes.c_float)), nverts,
+        faces_c.ctypes.data_as(ctypes.POINTER(ctypes.c_uint)), nfaces,
+        colors_ptr,
+        out_uuids.ctypes.data_as(ctypes.POINTER(ctypes.c_uint))
+    )
+
+    return out_uuids.tolist()
+
 # Python wrappers for compound geometry functions
 def addTile(context, center: List[float], size: List[float], rotation: List[float], subdiv: List[int]) -> List[int]:
     """Add a tile (subdivided patch) to the context"""
@@ -1436,6 +1720,103 @@ def getPrimitiveDataAuto(context, uuid:int, label:str):
         raise ValueError(f"Unknown data type {data_type} for primitive {uuid}, label '{label}'")
 
 
+# Try to set up columnar primitive data function prototypes (may not be available in all builds)
+try:
+    helios_lib.getPrimitiveDataColumn.argtypes = [ctypes.POINTER(UContext), ctypes.POINTER(ctypes.c_uint), ctypes.c_size_t, ctypes.c_char_p, ctypes.c_void_p, ctypes.c_int]
+    helios_lib.getPrimitiveDataColumn.restype = ctypes.c_int
+    helios_lib.getPrimitiveDataColumn.errcheck = _check_error
+
+    helios_lib.setPrimitiveDataColumn.argtypes = [ctypes.POINTER(UContext), ctypes.POINTER(ctypes.c_uint), ctypes.c_size_t, ctypes.c_char_p, ctypes.c_int, ctypes.c_void_p, ctypes.c_bool]
+    helios_lib.setPrimitiveDataColumn.restype = ctypes.c_int
+    helios_lib.setPrimitiveDataColumn.errcheck = _check_error
+
+    # Mark that columnar primitive data functions are available
+    _PRIMITIVE_DATA_COLUMN_FUNCTIONS_AVAILABLE = True
+
+except AttributeError:
+    # Columnar primitive data functions not available in current native library
+    _PRIMITIVE_DATA_COLUMN_FUNCTIONS_AVAILABLE = False
+
+# NumPy dtype name and components per value for each HeliosDataType that can be handled as a column
+_PRIMITIVE_DATA_COLUMN_LAYOUTS = {
+    0: ('int32', 1),    # HELIOS_TYPE_INT
+    1: ('uint32', 1),   # HELIOS_TYPE_UINT
+    2: ('float32', 1),  # HELIOS_TYPE_FLOAT
+    3: ('float64', 1),  # HELIOS_TYPE_DOUBLE
+    4: ('float32', 2),  # HELIOS_TYPE_VEC2
+    5: ('float32', 3),  # HELIOS_TYPE_VEC3
+    6: ('float32', 4),  # HELIOS_TYPE_VEC4
+    7: ('int32', 2),    # HELIOS_TYPE_INT2
+    8: ('int32', 3),    # HELIOS_TYPE_INT3
+    9: ('int32', 4),    # HELIOS_TYPE_INT4
+}
+
+def getPrimitiveDataColumn(context, uuids, label: str, data_type: int):
+    """
+    Get one primitive data label for many primitives in a single native call.
+
+    Args:
+        context: Context pointer
+        uuids: Sequence or NumPy array of primitive UUIDs
+        label: String key for the data
+        data_type: HeliosDataType of the label (see getPrimitiveDataTypeWrapper)
+
+    Returns:
+        NumPy array of shape (N,) for scalar types or (N, k) for vector types
+    """
+    if not _PRIMITIVE_DATA_COLUMN_FUNCTIONS_AVAILABLE:
+        raise NotImplementedError("getPrimitiveDataColumn not available in current Helios library. Rebuild PyHelios with updated C++ wrapper implementation.")
+    if data_type not in _PRIMITIVE_DATA_COLUMN_LAYOUTS:
+        raise ValueError(f"Primitive data type {data_type} cannot be returned as a column")
+
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    uuid_array = np.ascontiguousarray(uuids, dtype=np.uint32)
+    dtype_name, components = _PRIMITIVE_DATA_COLUMN_LAYOUTS[data_type]
+    shape = (uuid_array.size,) if components == 1 else (uuid_array.size, components)
+    result = np.empty(shape, dtype=np.dtype(dtype_name))
+
+    helios_lib.getPrimitiveDataColumn(context, uuid_array.ctypes.data_as(ctypes.POINTER(ctypes.c_uint)), uuid_array.size,
+                                      label.encode('utf-8'), result.ctypes.data_as(ctypes.c_void_p), data_type)
+    return result
+
+def setPrimitiveDataColumn(context, uuids, label: str, data_type: int, values):
+    """
+    Set one primitive data label for many primitives in a single native call.
+
+    Args:
+        context: Context pointer
+        uuids: Sequence or NumPy array of primitive UUIDs
+        label: String key for the data
+        data_type: HeliosDataType to store the values as
+        values: Array of shape (N,) / (N, k) with one value per UUID, or a single
+                scalar / length-k value that is broadcast to every UUID
+    """
+    if not _PRIMITIVE_DATA_COLUMN_FUNCTIONS_AVAILABLE:
+        raise NotImplementedError("setPrimitiveDataColumn not available in current Helios library. Rebuild PyHelios with updated C++ wrapper implementation.")
+    if data_type not in _PRIMITIVE_DATA_COLUMN_LAYOUTS:
+        raise ValueError(f"Primitive data type {data_type} cannot be set as a column")
+
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    uuid_array = np.ascontiguousarray(uuids, dtype=np.uint32)
+    dtype_name, components = _PRIMITIVE_DATA_COLUMN_LAYOUTS[data_type]
+    value_array = np.ascontiguousarray(values, dtype=np.dtype(dtype_name))
+
+    if value_array.size == components:
+        broadcast = True
+    elif value_array.size == uuid_array.size * components:
+        broadcast = False
+    else:
+        raise ValueError(f"Expected {uuid_array.size} values with {components} component(s) each "
+                         f"(or a single value to broadcast), got array of shape {value_array.shape}")
+
+    helios_lib.setPrimitiveDataColumn(context, uuid_array.ctypes.data_as(ctypes.POINTER(ctypes.c_uint)), uuid_array.size,
+                                      label.encode('utf-8'), data_type, value_array.ctypes.data_as(ctypes.c_void_p), broadcast)
+
+
 # Try to set up pseudocolor function prototypes
 try:
     # colorPrimitiveByDataPseudocolor function prototypes
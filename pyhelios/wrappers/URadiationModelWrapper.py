@@ -280,6 +280,116 @@ except AttributeError:
     # RadiationModel functions not available in current native library
     _RADIATION_MODEL_FUNCTIONS_AVAILABLE = False
 
+# Caller-buffer flux readback functions (may not be available in all builds)
+try:
+    helios_lib.getTotalAbsorbedFluxToBuffer.argtypes = [ctypes.POINTER(URadiationModel), ctypes.POINTER(ctypes.c_float), ctypes.c_size_t]
+    helios_lib.getTotalAbsorbedFluxToBuffer.restype = ctypes.c_size_t
+    helios_lib.getTotalAbsorbedFluxToBuffer.errcheck = _check_error
+
+    helios_lib.getAbsorbedFluxBands.argtypes = [ctypes.POINTER(URadiationModel), ctypes.POINTER(UContext),
+                                                ctypes.POINTER(ctypes.c_char_p), ctypes.c_size_t,
+                                                ctypes.POINTER(ctypes.c_float), ctypes.c_size_t]
+    helios_lib.getAbsorbedFluxBands.restype = ctypes.c_size_t
+    helios_lib.getAbsorbedFluxBands.errcheck = _check_error
+
+    _FLUX_BUFFER_FUNCTIONS_AVAILABLE = True
+except AttributeError:
+    _FLUX_BUFFER_FUNCTIONS_AVAILABLE = False
+
+# Change-tracking geometry update (may not be available in all builds)
+try:
+    helios_lib.updateRadiationGeometryIfChanged.argtypes = [ctypes.POINTER(URadiationModel)]
+    helios_lib.updateRadiationGeometryIfChanged.restype = ctypes.c_bool
+    helios_lib.updateRadiationGeometryIfChanged.errcheck = _check_error
+
+    _DIRTY_GEOMETRY_FUNCTIONS_AVAILABLE = True
+except AttributeError:
+    _DIRTY_GEOMETRY_FUNCTIONS_AVAILABLE = False
+
+# Source spectra (may not be available in all builds)
+try:
+    helios_lib.setSourceSpectrum.argtypes = [ctypes.POINTER(URadiationModel), ctypes.c_uint, ctypes.c_char_p]
+    helios_lib.setSourceSpectrum.restype = None
+    helios_lib.setSourceSpectrum.errcheck = _check_error
+
+    _SOURCE_SPECTRUM_FUNCTIONS_AVAILABLE = True
+except AttributeError:
+    _SOURCE_SPECTRUM_FUNCTIONS_AVAILABLE = False
+
+# Grouped absorbed flux reduction (may not be available in all builds)
+try:
+    helios_lib.aggregateAbsorbedFlux.argtypes = [ctypes.POINTER(URadiationModel), ctypes.POINTER(UContext), ctypes.c_char_p,
+                                                 ctypes.POINTER(ctypes.c_uint), ctypes.POINTER(ctypes.c_uint), ctypes.c_size_t, ctypes.c_size_t,
+                                                 ctypes.POINTER(ctypes.c_double), ctypes.POINTER(ctypes.c_double)]
+    helios_lib.aggregateAbsorbedFlux.restype = None
+    helios_lib.aggregateAbsorbedFlux.errcheck = _check_error
+
+    helios_lib.aggregateAbsorbedFluxByObject.argtypes = [ctypes.POINTER(URadiationModel), ctypes.POINTER(UContext), ctypes.c_char_p,
+                                                         ctypes.POINTER(ctypes.c_uint), ctypes.POINTER(ctypes.c_double),
+                                                         ctypes.POINTER(ctypes.c_double), ctypes.c_size_t]
+    helios_lib.aggregateAbsorbedFluxByObject.restype = ctypes.c_size_t
+    helios_lib.aggregateAbsorbedFluxByObject.errcheck = _check_error
+
+    _FLUX_AGGREGATION_FUNCTIONS_AVAILABLE = True
+except AttributeError:
+    _FLUX_AGGREGATION_FUNCTIONS_AVAILABLE = False
+
+# Periodic boundary conditions (may not be available in all builds)
+try:
+    helios_lib.enforcePeriodicBoundary.argtypes = [ctypes.POINTER(URadiationModel), ctypes.c_char_p]
+    helios_lib.enforcePeriodicBoundary.restype = None
+    helios_lib.enforcePeriodicBoundary.errcheck = _check_error
+
+    _PERIODIC_BOUNDARY_FUNCTIONS_AVAILABLE = True
+except AttributeError:
+    _PERIODIC_BOUNDARY_FUNCTIONS_AVAILABLE = False
+
+# In-memory camera image readback (may not be available in all builds)
+try:
+    helios_lib.getCameraImageBuffer.argtypes = [ctypes.POINTER(URadiationModel), ctypes.c_char_p, ctypes.c_char_p,
+                                                ctypes.POINTER(ctypes.c_float), ctypes.c_size_t,
+                                                ctypes.POINTER(ctypes.c_int), ctypes.POINTER(ctypes.c_int)]
+    helios_lib.getCameraImageBuffer.restype = ctypes.c_size_t
+    helios_lib.getCameraImageBuffer.errcheck = _check_error
+
+    helios_lib.getCameraImageRGBBuffer.argtypes = [ctypes.POINTER(URadiationModel), ctypes.c_char_p,
+                                                   ctypes.c_char_p, ctypes.c_char_p, ctypes.c_char_p,
+                                                   ctypes.c_float, ctypes.c_int,
+                                                   ctypes.POINTER(ctypes.c_float), ctypes.c_size_t,
+                                                   ctypes.POINTER(ctypes.c_int), ctypes.POINTER(ctypes.c_int)]
+    helios_lib.getCameraImageRGBBuffer.restype = ctypes.c_size_t
+    helios_lib.getCameraImageRGBBuffer.errcheck = _check_error
+
+    helios_lib.getCameraImageRGB8Buffer.argtypes = [ctypes.POINTER(URadiationModel), ctypes.c_char_p,
+                                                    ctypes.c_char_p, ctypes.c_char_p, ctypes.c_char_p,
+                                                    ctypes.c_float, ctypes.c_int,
+                                                    ctypes.POINTER(ctypes.c_uint8), ctypes.c_size_t,
+                                                    ctypes.POINTER(ctypes.c_int), ctypes.POINTER(ctypes.c_int)]
+    helios_lib.getCameraImageRGB8Buffer.restype = ctypes.c_size_t
+    helios_lib.getCameraImageRGB8Buffer.errcheck = _check_error
+
+    _CAMERA_BUFFER_FUNCTIONS_AVAILABLE = True
+except AttributeError:
+    _CAMERA_BUFFER_FUNCTIONS_AVAILABLE = False
+
+# In-memory annotation readback (may not be available in all builds)
+try:
+    helios_lib.getImageBoundingBoxesBuffer.argtypes = [ctypes.POINTER(URadiationModel), ctypes.c_char_p, ctypes.c_char_p,
+                                                       ctypes.c_int, ctypes.POINTER(ctypes.c_uint), ctypes.c_size_t,
+                                                       ctypes.POINTER(ctypes.c_int), ctypes.POINTER(ctypes.c_int)]
+    helios_lib.getImageBoundingBoxesBuffer.restype = ctypes.c_size_t
+    helios_lib.getImageBoundingBoxesBuffer.errcheck = _check_error
+
+    helios_lib.getImageSegmentationMasksRLE.argtypes = [ctypes.POINTER(URadiationModel), ctypes.c_char_p, ctypes.c_char_p,
+                                                        ctypes.c_int, ctypes.POINTER(ctypes.c_uint), ctypes.c_size_t,
+                                                       ctypes.POINTER(ctypes.c_int), ctypes.POINTER(ctypes.c_int)]
+    helios_lib.getImageSegmentationMasksRLE.restype = ctypes.c_size_t
+    helios_lib.getImageSegmentationMasksRLE.errcheck = _check_error
+
+    _ANNOTATION_BUFFER_FUNCTIONS_AVAILABLE = True
+except AttributeError:
+    _ANNOTATION_BUFFER_FUNCTIONS_AVAILABLE = False
+
 # Python wrapper functions
 
 def createRadiationModel(context):
@@ -437,6 +547,14 @@ def getSourceFlux(radiation_model, source_id: int, label: str) -> float:
     label_encoded = label.encode('utf-8')
     return helios_lib.getSourceFlux(radiation_model, source_id, label_encoded)
 
+def setSourceSpectrum(radiation_model, source_id: int, spectrum_label: str):
+    """Set the spectrum weighting spectral optical properties"""
+    if not _SOURCE_SPECTRUM_FUNCTIONS_AVAILABLE:
+        raise NotImplementedError("Source spectra not available in current Helios library. Rebuild PyHelios with updated C++ wrapper implementation.")
+    if radiation_model is None:
+        raise ValueError("RadiationModel instance is None. Cannot set source spectrum.")
+    helios_lib.setSourceSpectrum(radiation_model, source_id, spectrum_label.encode('utf-8'))
+
 def setScatteringDepth(radiation_model, label: str, depth: int):
     """Set scattering depth for band"""
     if not _RADIATION_MODEL_FUNCTIONS_AVAILABLE:
@@ -455,6 +573,14 @@ def setMinScatterEnergy(radiation_model, label: str, energy: float):
     label_encoded = label.encode('utf-8')
     helios_lib.setMinScatterEnergy(radiation_model, label_encoded, energy)
 
+def enforcePeriodicBoundary(radiation_model, boundary: str):
+    """Make rays leaving the domain laterally re-enter from the opposite side ("x", "y" or "xy")"""
+    if not _PERIODIC_BOUNDARY_FUNCTIONS_AVAILABLE:
+        raise NotImplementedError("Periodic boundary conditions not available in current Helios library. Rebuild PyHelios with updated C++ wrapper implementation.")
+    if radiation_model is None:
+        raise ValueError("RadiationModel instance is None. Cannot enforce periodic boundary.")
+    helios_lib.enforcePeriodicBoundary(radiation_model, boundary.encode('utf-8'))
+
 def disableEmission(radiation_model, label: str):
     """Disable emission for band"""
     if not _RADIATION_MODEL_FUNCTIONS_AVAILABLE:
@@ -490,6 +616,14 @@ def updateGeometryUUIDs(radiation_model, uuids: List[int]):
     uuid_array = (ctypes.c_uint * len(uuids))(*uuids)
     helios_lib.updateRadiationGeometryUUIDs(radiation_model, uuid_array, len(uuids))
 
+def updateGeometryIfChanged(radiation_model) -> bool:
+    """Re-upload radiation geometry only if primitives changed since the last geometry update"""
+    if not _DIRTY_GEOMETRY_FUNCTIONS_AVAILABLE:
+        raise RuntimeError("updateRadiationGeometryIfChanged not available in current Helios library. Rebuild PyHelios with updated C++ wrapper implementation.")
+    if radiation_model is None:
+        raise ValueError("RadiationModel instance is None. Cannot update geometry.")
+    return helios_lib.updateRadiationGeometryIfChanged(radiation_model)
+
 def runBand(radiation_model, label: str):
     """Run simulation for single band"""
     if not _RADIATION_MODEL_FUNCTIONS_AVAILABLE:
@@ -520,6 +654,151 @@ def getTotalAbsorbedFlux(radiation_model) -> List[float]:
     flux_ptr = helios_lib.getTotalAbsorbedFlux(radiation_model, ctypes.byref(size))
     return list(flux_ptr[:size.value])
 
+def getTotalAbsorbedFluxArray(radiation_model, out=None):
+    """
+    Get total absorbed flux for all primitives as a float32 NumPy array.
+
+    Args:
+        radiation_model: RadiationModel pointer
+        out: Optional preallocated contiguous float32 array of length >= primitive count.
+             When given, flux is written into it directly and a view of the filled part is returned.
+
+    Returns:
+        NumPy float32 array of absorbed flux per primitive
+    """
+    if not _RADIATION_MODEL_FUNCTIONS_AVAILABLE:
+        raise RuntimeError("RadiationModel functions are not available. Native library missing or radiation plugin not enabled.")
+    if radiation_model is None:
+        raise ValueError("RadiationModel instance is None. Cannot get absorbed flux.")
+
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    if not _FLUX_BUFFER_FUNCTIONS_AVAILABLE:
+        size = ctypes.c_size_t()
+        flux_ptr = helios_lib.getTotalAbsorbedFlux(radiation_model, ctypes.byref(size))
+        flux = np.ctypeslib.as_array(flux_ptr, shape=(size.value,)) if size.value > 0 else np.empty(0, dtype=np.float32)
+        if out is None:
+            return flux.copy()
+        out[:size.value] = flux
+        return out[:size.value]
+
+    if out is not None:
+        if out.dtype != np.float32 or not out.flags['C_CONTIGUOUS']:
+            raise ValueError("Output buffer must be a contiguous float32 NumPy array")
+        count = helios_lib.getTotalAbsorbedFluxToBuffer(radiation_model, out.ctypes.data_as(ctypes.POINTER(ctypes.c_float)), out.size)
+        if count > out.size:
+            raise ValueError(f"Output buffer holds {out.size} values, but {count} primitives have absorbed flux")
+        return out[:count]
+
+    count = helios_lib.getTotalAbsorbedFluxToBuffer(radiation_model, None, 0)
+    while True:
+        result = np.empty(count, dtype=np.float32)
+        required = helios_lib.getTotalAbsorbedFluxToBuffer(radiation_model, result.ctypes.data_as(ctypes.POINTER(ctypes.c_float)), count)
+        if required <= count:
+            return result[:required]
+        count = required
+
+def getAbsorbedFluxBands(radiation_model, context, band_labels: List[str]):
+    """
+    Get absorbed flux for several bands in one call.
+
+    Args:
+        radiation_model: RadiationModel pointer
+        context: Context pointer the model was created with
+        band_labels: List of band labels
+
+    Returns:
+        NumPy float32 array of shape (len(band_labels), primitive_count), columns in getAllUUIDs() order
+    """
+    if not _FLUX_BUFFER_FUNCTIONS_AVAILABLE:
+        raise NotImplementedError("Per-band absorbed flux readback not available in current Helios library. Rebuild PyHelios with updated C++ wrapper implementation.")
+    if radiation_model is None:
+        raise ValueError("RadiationModel instance is None. Cannot get absorbed flux.")
+    if not band_labels:
+        raise ValueError("Band labels list cannot be empty")
+
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    encoded = [label.encode('utf-8') for label in band_labels]
+    label_array = (ctypes.c_char_p * len(encoded))(*encoded)
+
+    primitive_count = helios_lib.getAbsorbedFluxBands(radiation_model, context, label_array, len(encoded), None, 0)
+    while True:
+        result = np.empty((len(encoded), primitive_count), dtype=np.float32)
+        required = helios_lib.getAbsorbedFluxBands(radiation_model, context, label_array, len(encoded),
+                                                   result.ctypes.data_as(ctypes.POINTER(ctypes.c_float)), result.size)
+        if required == primitive_count:
+            return result
+        primitive_count = required
+
+def aggregateAbsorbedFlux(radiation_model, context, band_label: str, uuids, groups, group_count: int):
+    """
+    Sum absorbed power and area of one band per group of primitives.
+
+    Args:
+        radiation_model: RadiationModel pointer
+        context: Context pointer the model was created with
+        band_label: Band label
+        uuids: Contiguous uint32 array of primitive UUIDs
+        groups: Contiguous uint32 array with the group index of each primitive
+        group_count: Number of groups
+
+    Returns:
+        Tuple (power, area) of float64 arrays with one entry per group
+    """
+    if not _FLUX_AGGREGATION_FUNCTIONS_AVAILABLE:
+        raise NotImplementedError("Absorbed flux aggregation not available in current Helios library. Rebuild PyHelios with updated C++ wrapper implementation.")
+    if radiation_model is None:
+        raise ValueError("RadiationModel instance is None. Cannot aggregate absorbed flux.")
+
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    power = np.zeros(group_count, dtype=np.float64)
+    area = np.zeros(group_count, dtype=np.float64)
+    helios_lib.aggregateAbsorbedFlux(radiation_model, context, band_label.encode('utf-8'),
+                                     uuids.ctypes.data_as(ctypes.POINTER(ctypes.c_uint)),
+                                     groups.ctypes.data_as(ctypes.POINTER(ctypes.c_uint)), uuids.size, group_count,
+                                     power.ctypes.data_as(ctypes.POINTER(ctypes.c_double)),
+                                     area.ctypes.data_as(ctypes.POINTER(ctypes.c_double)))
+    return power, area
+
+def aggregateAbsorbedFluxByObject(radiation_model, context, band_label: str):
+    """
+    Sum absorbed power and area of one band per parent Context object.
+
+    Args:
+        radiation_model: RadiationModel pointer
+        context: Context pointer the model was created with
+        band_label: Band label
+
+    Returns:
+        Tuple (object_ids, power, area) of arrays with one entry per object, in ascending ID order
+    """
+    if not _FLUX_AGGREGATION_FUNCTIONS_AVAILABLE:
+        raise NotImplementedError("Absorbed flux aggregation not available in current Helios library. Rebuild PyHelios with updated C++ wrapper implementation.")
+    if radiation_model is None:
+        raise ValueError("RadiationModel instance is None. Cannot aggregate absorbed flux.")
+
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    encoded = band_label.encode('utf-8')
+    count = helios_lib.aggregateAbsorbedFluxByObject(radiation_model, context, encoded, None, None, None, 0)
+    while True:
+        object_ids = np.empty(count, dtype=np.uint32)
+        power = np.empty(count, dtype=np.float64)
+        area = np.empty(count, dtype=np.float64)
+        required = helios_lib.aggregateAbsorbedFluxByObject(radiation_model, context, encoded,
+                                                            object_ids.ctypes.data_as(ctypes.POINTER(ctypes.c_uint)),
+                                                            power.ctypes.data_as(ctypes.POINTER(ctypes.c_double)),
+                                                            area.ctypes.data_as(ctypes.POINTER(ctypes.c_double)), count)
+        if required == count:
+            return object_ids, power, area
+        count = required
+
 #=============================================================================
 # Camera and Image Functions (v1.3.47)
 #=============================================================================
@@ -582,6 +861,84 @@ def writeCameraImageData(radiation_model, camera: str, band: str, imagefile_base
     helios_lib.writeCameraImageData(radiation_model, camera_encoded, band_encoded,
                                    imagefile_base_encoded, image_path_encoded, frame)
 
+def getCameraImageBuffer(radiation_model, camera: str, band: str):
+    """
+    Get the pixel data of one camera band without writing an image file.
+
+    Args:
+        radiation_model: RadiationModel pointer
+        camera: Camera label
+        band: Band label
+
+    Returns:
+        NumPy float32 array of shape (height, width)
+    """
+    if not _CAMERA_BUFFER_FUNCTIONS_AVAILABLE:
+        raise NotImplementedError("In-memory camera images not available in current Helios library. Rebuild PyHelios with updated C++ wrapper implementation.")
+    if radiation_model is None:
+        raise ValueError("RadiationModel instance is None. Cannot get camera image.")
+
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    camera_encoded = camera.encode('utf-8')
+    band_encoded = band.encode('utf-8')
+    width = ctypes.c_int()
+    height = ctypes.c_int()
+
+    count = helios_lib.getCameraImageBuffer(radiation_model, camera_encoded, band_encoded, None, 0,
+                                            ctypes.byref(width), ctypes.byref(height))
+    result = np.empty(count, dtype=np.float32)
+    helios_lib.getCameraImageBuffer(radiation_model, camera_encoded, band_encoded,
+                                    result.ctypes.data_as(ctypes.POINTER(ctypes.c_float)), count,
+                                    ctypes.byref(width), ctypes.byref(height))
+    return result.reshape(height.value, width.value)
+
+def getCameraImageRGB(radiation_model, camera: str, bands: List[str], flux_to_pixel_conversion: float = 1.0,
+                      normalize: bool = False, dtype: str = "float32"):
+    """
+    Get an RGB composite of three camera bands without writing an image file.
+
+    Args:
+        radiation_model: RadiationModel pointer
+        camera: Camera label
+        bands: Red, green and blue band labels
+        flux_to_pixel_conversion: Conversion factor from flux to pixel value (ignored if normalize is True)
+        normalize: Divide by the maximum pixel value over the three bands
+        dtype: "float32" for values in [0, 1] or "uint8" for values in [0, 255]
+
+    Returns:
+        NumPy array of shape (height, width, 3)
+    """
+    if not _CAMERA_BUFFER_FUNCTIONS_AVAILABLE:
+        raise NotImplementedError("In-memory camera images not available in current Helios library. Rebuild PyHelios with updated C++ wrapper implementation.")
+    if radiation_model is None:
+        raise ValueError("RadiationModel instance is None. Cannot get camera image.")
+    if len(bands) != 3:
+        raise ValueError("Exactly three band labels (red, green, blue) are required")
+
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    if dtype == "float32":
+        function, np_type, c_type = helios_lib.getCameraImageRGBBuffer, np.float32, ctypes.c_float
+    elif dtype == "uint8":
+        function, np_type, c_type = helios_lib.getCameraImageRGB8Buffer, np.uint8, ctypes.c_uint8
+    else:
+        raise ValueError(f"dtype must be 'float32' or 'uint8', got '{dtype}'")
+
+    camera_encoded = camera.encode('utf-8')
+    bands_encoded = [band.encode('utf-8') for band in bands]
+    width = ctypes.c_int()
+    height = ctypes.c_int()
+
+    count = function(radiation_model, camera_encoded, *bands_encoded, flux_to_pixel_conversion, int(normalize),
+                     None, 0, ctypes.byref(width), ctypes.byref(height))
+    result = np.empty(count, dtype=np_type)
+    function(radiation_model, camera_encoded, *bands_encoded, flux_to_pixel_conversion, int(normalize),
+             result.ctypes.data_as(ctypes.POINTER(c_type)), count, ctypes.byref(width), ctypes.byref(height))
+    return result.reshape(height.value, width.value, 3)
+
 # Bounding box functions
 def writeImageBoundingBoxes(radiation_model, camera_label: str, primitive_data_label: str, 
                            object_class_id: int, image_file: str, classes_txt_file: str = "classes.txt", 
@@ -759,6 +1116,73 @@ def writeImageSegmentationMasks_ObjectDataVector(radiation_model, camera_label:
     helios_lib.writeImageSegmentationMasks_ObjectDataVector(radiation_model, camera_encoded, label_array, len(object_data_labels),
                                                            id_array, json_encoded, image_file_encoded, int(append_file))
 
+# In-memory annotation functions
+def _getAnnotationBuffer(function, radiation_model, camera_label: str, data_label: str, object_data: bool):
+    """Query the size of an annotation buffer, then fill it; returns the buffer and the image (height, width)"""
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    camera_encoded = camera_label.encode('utf-8')
+    label_encoded = data_label.encode('utf-8')
+    width = ctypes.c_int()
+    height = ctypes.c_int()
+    count = function(radiation_model, camera_encoded, label_encoded, int(object_data), None, 0,
+                     ctypes.byref(width), ctypes.byref(height))
+    result = np.empty(count, dtype=np.uint32)
+    function(radiation_model, camera_encoded, label_encoded, int(object_data),
+             result.ctypes.data_as(ctypes.POINTER(ctypes.c_uint)), count, ctypes.byref(width), ctypes.byref(height))
+    return result, (height.value, width.value)
+
+def getImageBoundingBoxes(radiation_model, camera_label: str, data_label: str, object_data: bool = False):
+    """
+    Get bounding boxes of labelled instances seen by a camera.
+
+    Args:
+        radiation_model: RadiationModel pointer
+        camera_label: Camera label
+        data_label: Primitive data label (or object data label if object_data is True)
+        object_data: Read the label from the parent object of each primitive
+
+    Returns:
+        Tuple of a NumPy uint32 array of shape (instances, 6) holding data value, x min, y min, x max, y max
+        and pixel count per instance, and the image size as (height, width)
+    """
+    if not _ANNOTATION_BUFFER_FUNCTIONS_AVAILABLE:
+        raise NotImplementedError("In-memory annotations not available in current Helios library. Rebuild PyHelios with updated C++ wrapper implementation.")
+    if radiation_model is None:
+        raise ValueError("RadiationModel instance is None. Cannot get bounding boxes.")
+
+    boxes, size = _getAnnotationBuffer(helios_lib.getImageBoundingBoxesBuffer, radiation_model, camera_label, data_label, object_data)
+    return boxes.reshape(-1, 6), size
+
+def getImageSegmentationMasksRLE(radiation_model, camera_label: str, data_label: str, object_data: bool = False):
+    """
+    Get run-length encoded segmentation masks of labelled instances seen by a camera.
+
+    Args:
+        radiation_model: RadiationModel pointer
+        camera_label: Camera label
+        data_label: Primitive data label (or object data label if object_data is True)
+        object_data: Read the label from the parent object of each primitive
+
+    Returns:
+        Tuple of a dict mapping each data value to a NumPy uint32 array of COCO uncompressed RLE counts,
+        and the image size as (height, width)
+    """
+    if not _ANNOTATION_BUFFER_FUNCTIONS_AVAILABLE:
+        raise NotImplementedError("In-memory annotations not available in current Helios library. Rebuild PyHelios with updated C++ wrapper implementation.")
+    if radiation_model is None:
+        raise ValueError("RadiationModel instance is None. Cannot get segmentation masks.")
+
+    buffer, size = _getAnnotationBuffer(helios_lib.getImageSegmentationMasksRLE, radiation_model, camera_label, data_label, object_data)
+    masks = {}
+    position = 0
+    while position < buffer.size:
+        value, run_count = int(buffer[position]), int(buffer[position + 1])
+        masks[value] = buffer[position + 2:position + 2 + run_count]
+        position += 2 + run_count
+    return masks, size
+
 # Auto-calibration function
 def autoCalibrateCameraImage(radiation_model, camera_label: str, red_band_label: str, green_band_label: str, 
                             blue_band_label: str, output_file_path: str, print_quality_report: bool = False, 
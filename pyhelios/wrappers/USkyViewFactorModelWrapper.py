@@ -334,6 +334,47 @@ except AttributeError:
     # SkyViewFactorModel functions not available in current native library
     _SKYVIEWFACTOR_MODEL_FUNCTIONS_AVAILABLE = False
 
+# Optional multithreaded CPU engine (newer native libraries only)
+try:
+    helios_lib.calculateSkyViewFactorsParallelCPU.argtypes = [
+        ctypes.POINTER(USkyViewFactorModel),
+        ctypes.POINTER(UContext),
+        ctypes.POINTER(ctypes.c_float),
+        ctypes.c_size_t,
+        ctypes.POINTER(ctypes.c_float),
+        ctypes.c_int,
+        ctypes.c_uint,
+    ]
+    helios_lib.calculateSkyViewFactorsParallelCPU.restype = None
+    helios_lib.calculateSkyViewFactorsParallelCPU.errcheck = _check_error
+
+    _PARALLEL_CPU_FUNCTIONS_AVAILABLE = True
+
+except AttributeError:
+    _PARALLEL_CPU_FUNCTIONS_AVAILABLE = False
+
+# Progress callback type for chunked calculation: (points_done, total_points) -> non-zero to cancel
+SKYVIEWFACTOR_PROGRESS_CALLBACK = ctypes.CFUNCTYPE(ctypes.c_int, ctypes.c_size_t, ctypes.c_size_t)
+
+# Optional chunked calculation (newer native libraries only)
+try:
+    helios_lib.calculateSkyViewFactorsChunked.argtypes = [
+        ctypes.POINTER(USkyViewFactorModel),
+        ctypes.POINTER(ctypes.c_float),
+        ctypes.c_size_t,
+        ctypes.POINTER(ctypes.c_float),
+        ctypes.c_size_t,
+        SKYVIEWFACTOR_PROGRESS_CALLBACK,
+        ctypes.c_int,
+    ]
+    helios_lib.calculateSkyViewFactorsChunked.restype = ctypes.c_size_t
+    helios_lib.calculateSkyViewFactorsChunked.errcheck = _check_error
+
+    _CHUNKED_FUNCTIONS_AVAILABLE = True
+
+except AttributeError:
+    _CHUNKED_FUNCTIONS_AVAILABLE = False
+
 # Python wrapper functions
 
 
@@ -458,6 +499,55 @@ def calculateSkyViewFactors(skyviewfactor_model, points, num_threads=0):
     return [results_array[i] for i in range(num_points)]
 
 
+def calculateSkyViewFactorsChunked(
+    skyviewfactor_model, points, chunk_size, progress_callback=None, num_threads=0
+):
+    """Calculate sky view factors for a large point cloud in bounded-memory chunks.
+
+    Args:
+        points: N x 3 array-like of point coordinates
+        chunk_size: Number of points evaluated per native call
+        progress_callback: Optional callable(points_done, total_points); return True to cancel
+        num_threads: Number of OpenMP threads per chunk (0 = auto)
+
+    Returns:
+        Tuple of (numpy float32 results array, number of points processed)
+    """
+    if not _CHUNKED_FUNCTIONS_AVAILABLE:
+        raise RuntimeError(
+            "Chunked sky view factor calculation not available in current Helios library. "
+            "Rebuild PyHelios with the skyviewfactor plugin."
+        )
+
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    points_array = np.ascontiguousarray(points, dtype=np.float32).reshape(-1, 3)
+    num_points = points_array.shape[0]
+    results = np.zeros(num_points, dtype=np.float32)
+    if num_points == 0:
+        return results, 0
+
+    if progress_callback is not None:
+        # Keep a reference for the duration of the call so the trampoline is not collected
+        c_callback = SKYVIEWFACTOR_PROGRESS_CALLBACK(
+            lambda done, total: 1 if progress_callback(done, total) else 0
+        )
+    else:
+        c_callback = SKYVIEWFACTOR_PROGRESS_CALLBACK()
+
+    processed = helios_lib.calculateSkyViewFactorsChunked(
+        skyviewfactor_model,
+        points_array.ctypes.data_as(ctypes.POINTER(ctypes.c_float)),
+        num_points,
+        results.ctypes.data_as(ctypes.POINTER(ctypes.c_float)),
+        int(chunk_size),
+        c_callback,
+        int(num_threads),
+    )
+    return results, processed
+
+
 def calculateSkyViewFactorsForPrimitives(skyviewfactor_model, uuids, num_threads=0):
     """Calculate sky view factors for specified primitive centers"""
     if not _SKYVIEWFACTOR_MODEL_FUNCTIONS_AVAILABLE:
@@ -486,6 +576,41 @@ def calculateSkyViewFactorsForPrimitives(skyviewfactor_model, uuids, num_threads
     return [results_array[i] for i in range(num_primitives)]
 
 
+def calculateSkyViewFactorsParallelCPU(skyviewfactor_model, context, points, num_threads=0, seed=0):
+    """Calculate sky view factors for multiple points with the multithreaded CPU engine.
+
+    Results for a given seed do not depend on num_threads.
+
+    Returns:
+        numpy float32 array with one sky view factor per point
+    """
+    if not _PARALLEL_CPU_FUNCTIONS_AVAILABLE:
+        raise RuntimeError(
+            "Parallel CPU sky view factor engine not available in current Helios library. "
+            "Rebuild PyHelios with the skyviewfactor plugin."
+        )
+
+    # Import numpy here to avoid circular imports
+    import numpy as np
+
+    points_array = np.ascontiguousarray(points, dtype=np.float32).reshape(-1, 3)
+    num_points = points_array.shape[0]
+    results = np.zeros(num_points, dtype=np.float32)
+    if num_points == 0:
+        return results
+
+    helios_lib.calculateSkyViewFactorsParallelCPU(
+        skyviewfactor_model,
+        context,
+        points_array.ctypes.data_as(ctypes.POINTER(ctypes.c_float)),
+        num_points,
+        results.ctypes.data_as(ctypes.POINTER(ctypes.c_float)),
+        int(num_threads),
+        int(seed) & 0xFFFFFFFF,
+    )
+    return results
+
+
 def exportSkyViewFactors(skyviewfactor_model, filename):
     """Export sky view factors to file"""
     if not _SKYVIEWFACTOR_MODEL_FUNCTIONS_AVAILABLE:
@@ -248,6 +248,32 @@ class TestPrimitiveProperties:
             basic_context.getPrimitiveNormal(invalid_uuid)
 
 
+    def test_independent_contexts_in_threads(self):
+        """Test that UUID queries on separate Contexts do not interfere across threads."""
+        import threading
+        
+        errors = []
+        
+        def worker(patch_count):
+            try:
+                with Context() as context:
+                    created = [context.addPatch(center=vec3(i, 0, 0)) for i in range(patch_count)]
+                    for _ in range(20):
+                        assert context.getAllUUIDs() == created
+                        vertices = context.getPrimitiveVertices(created[-1])
+                        assert vertices[0].x == pytest.approx(patch_count - 1.5)
+            except Exception as e:  # Collected and re-raised in the main thread
+                errors.append(e)
+        
+        threads = [threading.Thread(target=worker, args=(n,)) for n in (5, 50, 200, 400)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        
+        assert errors == []
+
+
 @pytest.mark.native_only 
 class TestObjectManagement:
     """Test object-level operations."""
@@ -743,6 +769,37 @@ class TestNumPyArrayOperations:
         expected_color = RGBcolor(1.0/3, 1.0/3, 1.0/3)  # Average of RGB
         assert_color_equal(actual_color, expected_color, tolerance=1e-5)
     
+    def test_addTrianglesFromArrays_grid_mesh(self, basic_context):
+        """Test that a larger indexed mesh is added in face order with shared vertices."""
+        # 10x10 grid of quads, each split into two triangles
+        n = 10
+        xs, ys = np.meshgrid(np.arange(n + 1, dtype=np.float32), np.arange(n + 1, dtype=np.float32))
+        vertices = np.column_stack([xs.ravel(), ys.ravel(), np.zeros(xs.size, dtype=np.float32)])
+        faces = []
+        for j in range(n):
+            for i in range(n):
+                v00 = j * (n + 1) + i
+                v10 = v00 + 1
+                v01 = v00 + (n + 1)
+                v11 = v01 + 1
+                faces.append([v00, v10, v11])
+                faces.append([v00, v11, v01])
+        faces = np.array(faces, dtype=np.int64)
+        colors = np.tile(np.array([[0.2, 0.4, 0.6]], dtype=np.float64), (faces.shape[0], 1))
+        
+        triangle_uuids = basic_context.addTrianglesFromArrays(vertices, faces, colors)
+        
+        assert len(triangle_uuids) == 2 * n * n
+        assert len(set(triangle_uuids)) == len(triangle_uuids)
+        assert basic_context.getPrimitiveCount() == 2 * n * n
+        
+        # Spot-check that UUIDs are returned in face order
+        last_vertices = basic_context.getPrimitiveVertices(triangle_uuids[-1])
+        for vertex, index in zip(last_vertices, faces[-1]):
+            assert vertex.x == pytest.approx(vertices[index][0])
+            assert vertex.y == pytest.approx(vertices[index][1])
+        assert_color_equal(basic_context.getPrimitiveColor(triangle_uuids[-1]), RGBcolor(0.2, 0.4, 0.6), tolerance=1e-5)
+    
     def test_addTrianglesFromArrays_validation(self, basic_context):
         """Test validation of NumPy array inputs."""
         # Invalid vertices shape
@@ -1056,6 +1113,44 @@ class TestPrimitiveDataOperations:
         with pytest.raises(ValueError, match="Primitive data .* does not exist"):
             basic_context.getPrimitiveDataArray([patch_uuid], "nonexistent_label")
     
+    def test_getPrimitiveDataArray_many_primitives(self, basic_context):
+        """Test columnar retrieval across many primitives, including partially missing data."""
+        uuids = [basic_context.addPatch(center=vec3(i, 0, 0)) for i in range(200)]
+        for i, uuid in enumerate(uuids):
+            basic_context.setPrimitiveDataFloat(uuid, "radiation_flux_PAR", float(i) * 0.5)
+            basic_context.setPrimitiveDataInt(uuid, "leaf_index", 3 * i)
+        
+        flux = basic_context.getPrimitiveDataArray(uuids, "radiation_flux_PAR")
+        assert flux.dtype == np.float32
+        np.testing.assert_allclose(flux, np.arange(200, dtype=np.float32) * 0.5)
+        
+        indices = basic_context.getPrimitiveDataArray(uuids, "leaf_index")
+        assert indices.dtype == np.int32
+        np.testing.assert_array_equal(indices, np.arange(200) * 3)
+        
+        # Label present on the first primitive but missing on a later one
+        extra_uuid = basic_context.addPatch()
+        with pytest.raises(ValueError, match="Primitive data .* does not exist"):
+            basic_context.getPrimitiveDataArray(uuids + [extra_uuid], "radiation_flux_PAR")
+    
+    def test_setPrimitiveDataArray_roundtrip(self, basic_context):
+        """Test columnar setter with per-UUID values, vector values and broadcast."""
+        uuids = [basic_context.addPatch(center=vec3(i, 0, 0)) for i in range(50)]
+        
+        temperatures = np.linspace(290.0, 300.0, 50)
+        basic_context.setPrimitiveDataArray(uuids, "temperature", temperatures)
+        np.testing.assert_allclose(basic_context.getPrimitiveDataArray(uuids, "temperature"), temperatures, rtol=1e-6)
+        
+        basic_context.setPrimitiveDataArray(uuids, "moisture_conductance", 0.05)
+        assert basic_context.getPrimitiveData(uuids[-1], "moisture_conductance", float) == pytest.approx(0.05)
+        
+        directions = np.tile([0.0, 0.0, 1.0], (50, 1))
+        basic_context.setPrimitiveDataArray(uuids, "direction", directions, data_type="vec3")
+        assert basic_context.getPrimitiveDataArray(uuids, "direction").shape == (50, 3)
+        
+        with pytest.raises(ValueError, match="Expected 50 values"):
+            basic_context.setPrimitiveDataArray(uuids, "temperature", temperatures[:10])
+    
     def test_getPrimitiveDataArray_mixed_primitives(self, basic_context):
         """Test getPrimitiveDataArray with mixed primitive types."""
         # Create different primitive types
@@ -1530,6 +1625,24 @@ class TestPrimitiveInfoOperations:
         assert patch_info.primitive_type == PrimitiveType.Patch
         assert triangle_info.primitive_type == PrimitiveType.Triangle
     
+    def test_getPrimitiveGeometryArrays(self, basic_context):
+        """Test bulk geometry export as NumPy arrays."""
+        patch_uuid = basic_context.addPatch(center=vec3(0, 0, 1), size=vec2(2, 2))
+        triangle_uuid = basic_context.addTriangle(vec3(0,0,0), vec3(1,0,0), vec3(0.5,1,0))
+        
+        geometry = basic_context.getPrimitiveGeometryArrays([patch_uuid, triangle_uuid])
+        
+        np.testing.assert_array_equal(geometry['vertex_offsets'], [0, 4, 7])
+        assert geometry['vertices'].shape == (7, 3)
+        np.testing.assert_array_equal(geometry['types'], [PrimitiveType.Patch, PrimitiveType.Triangle])
+        np.testing.assert_allclose(geometry['areas'], [basic_context.getPrimitiveArea(patch_uuid),
+                                                       basic_context.getPrimitiveArea(triangle_uuid)], rtol=1e-6)
+        np.testing.assert_allclose(geometry['normals'][1], [0, 0, 1], atol=1e-6)
+        assert geometry['colors'].shape == (2, 4)
+        
+        # Triangle vertices are packed after the patch vertices
+        np.testing.assert_allclose(geometry['vertices'][4:7], [[0, 0, 0], [1, 0, 0], [0.5, 1, 0]], atol=1e-6)
+    
     def test_getPrimitivesInfoForObject(self, basic_context):
         """Test getting primitive info for specific object."""
         # Add a patch (which creates an object)
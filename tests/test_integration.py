@@ -241,6 +241,34 @@ class TestContextIntegration:
         basic_context.markGeometryClean()
         assert not basic_context.isGeometryDirty()
 
+    def test_geometry_revision_integration(self, basic_context):
+        """Test geometry revision only advances when geometry changes."""
+        basic_context.addPatch()
+        revision = basic_context.getGeometryRevision()
+
+        # Unchanged geometry keeps its revision
+        assert basic_context.getGeometryRevision() == revision
+
+        basic_context.addPatch(center=DataTypes.vec3(2, 0, 0))
+        changed = basic_context.getGeometryRevision()
+        assert changed > revision
+
+        # Explicitly marking dirty forces the revision forward
+        basic_context.markGeometryDirty()
+        assert basic_context.getGeometryRevision() > changed
+
+    def test_dirty_uuid_tracking(self, basic_context):
+        """Test per-primitive dirty tracking between markGeometryClean calls."""
+        first = basic_context.addPatch()
+        assert basic_context.getDirtyUUIDs() == [first]
+
+        basic_context.markGeometryClean()
+        assert basic_context.getDirtyUUIDs() == []
+
+        second = basic_context.addPatch(center=DataTypes.vec3(2, 0, 0))
+        assert basic_context.getDirtyUUIDs() == [second]
+        assert basic_context.getDeletedUUIDs() == []
+
 
 @pytest.mark.integration
 @pytest.mark.native_only
@@ -214,6 +214,23 @@ class TestPlantArchitectureNative:
 
         # Should complete without exception
 
+    def test_advance_time_advances_geometry_revision(self, context, plantarch):
+        """Test growth followed by a native clean still advances the geometry revision"""
+        models = plantarch.getAvailablePlantModels()
+        if not models:
+            pytest.skip("No plant models available")
+
+        plantarch.loadPlantModelFromLibrary(models[0])
+        plantarch.buildPlantInstanceFromLibrary(vec3(0, 0, 0), 10.0)
+        context.markGeometryClean()
+        revision = context.getGeometryRevision()
+
+        # Growth moves vertices in native code; the clean flag must not hide that from the cache
+        plantarch.advanceTime(5.0)
+        context.markGeometryClean()
+        assert not context.isGeometryDirty()
+        assert context.getGeometryRevision() > revision
+
     def test_get_plant_object_ids(self, plantarch):
         """Test getting object IDs for a plant"""
         # Load model and create plant
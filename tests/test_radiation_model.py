@@ -15,6 +15,7 @@ sys.path.insert(0, os.path.join(os.path.dirname(__file__), '..'))
 
 from pyhelios import Context, RadiationModel, RadiationModelError, DataTypes
 from pyhelios.validation.exceptions import ValidationError
+from pyhelios.exceptions import HeliosRuntimeError
 
 # RadiationSourceType may not be available if RadiationModel is None
 try:
@@ -218,6 +219,641 @@ class TestRadiationModel:
                 flux = radiation_model.getTotalAbsorbedFlux()
                 assert isinstance(flux, list)
 
+    def test_result_access_arrays(self):
+        """Test array-based absorbed flux readback, in-place and per band"""
+        import numpy as np
+        
+        with Context() as context:
+            patches = [context.addPatch(center=DataTypes.vec3(i, 0, 0)) for i in range(3)]
+            
+            with RadiationModel(context) as radiation_model:
+                radiation_model.addRadiationBand("PAR")
+                radiation_model.addRadiationBand("NIR")
+                source = radiation_model.addCollimatedRadiationSource()
+                radiation_model.setSourceFlux(source, "PAR", 500.0)
+                radiation_model.setSourceFlux(source, "NIR", 300.0)
+                radiation_model.updateGeometry()
+                radiation_model.runBand(["PAR", "NIR"])
+                
+                flux = radiation_model.getTotalAbsorbedFluxArray()
+                assert flux.dtype == np.float32
+                np.testing.assert_allclose(flux, radiation_model.getTotalAbsorbedFlux(), rtol=1e-6)
+                
+                # Writing into a preallocated buffer reuses its memory
+                buffer = np.zeros(len(patches) + 2, dtype=np.float32)
+                filled = radiation_model.getTotalAbsorbedFluxArray(out=buffer)
+                assert np.shares_memory(filled, buffer)
+                np.testing.assert_allclose(filled, flux, rtol=1e-6)
+                
+                by_band = radiation_model.getAbsorbedFluxByBand(["PAR", "NIR"])
+                assert by_band.shape == (2, len(patches))
+                np.testing.assert_allclose(by_band.sum(axis=0), flux, rtol=1e-5)
+
+    def test_update_geometry_if_changed(self):
+        """Test change-tracking geometry update skips unchanged scenes"""
+        with Context() as context:
+            context.addPatch(center=DataTypes.vec3(0, 0, 0))
+            
+            with RadiationModel(context) as radiation_model:
+                # First call has no baseline and uploads everything
+                assert radiation_model.updateGeometryIfChanged()
+                
+                # Nothing changed since the last update
+                assert not radiation_model.updateGeometryIfChanged()
+                
+                context.addPatch(center=DataTypes.vec3(2, 0, 0))
+                assert radiation_model.updateGeometryIfChanged()
+                assert not radiation_model.updateGeometryIfChanged()
+
+
+@pytest.mark.native_only
+class TestRadiationModelCPUBackend:
+    """Test RadiationModel with the CPU ray-tracing backend (no GPU required)"""
+    
+    def test_cpu_collimated_source(self):
+        """Test absorbed flux of an unshaded patch under a vertical collimated source"""
+        with Context() as context:
+            patch = context.addPatch(center=DataTypes.vec3(0, 0, 0))
+            
+            with RadiationModel(context, backend="cpu") as radiation_model:
+                assert radiation_model.getBackend() == "cpu"
+                radiation_model.disableMessages()
+                
+                radiation_model.addRadiationBand("SW")
+                radiation_model.disableEmission("SW")
+                source = radiation_model.addCollimatedRadiationSource()
+                radiation_model.setSourceFlux(source, "SW", 1000.0)
+                
+                radiation_model.updateGeometry()
+                radiation_model.runBand("SW")
+                
+                flux = radiation_model.getTotalAbsorbedFlux()
+                assert len(flux) == 1
+                assert flux[0] == pytest.approx(1000.0, rel=1e-3)
+    
+    def test_cpu_multiple_bands_match_single_runs(self):
+        """Test that bands traced together give the same flux as bands run one at a time"""
+        def run(context, together):
+            with RadiationModel(context, backend="cpu") as radiation_model:
+                radiation_model.disableMessages()
+                radiation_model.setThreadCount(1)
+                for band in ["PAR", "NIR"]:
+                    radiation_model.addRadiationBand(band)
+                    radiation_model.disableEmission(band)
+                    radiation_model.setDiffuseRayCount(band, 100)
+                    radiation_model.setDiffuseRadiationFlux(band, 50.0)
+                radiation_model.setScatteringDepth("PAR", 1)
+                radiation_model.setScatteringDepth("NIR", 3)
+                source = radiation_model.addCollimatedRadiationSource()
+                radiation_model.setSourceFlux(source, "PAR", 500.0)
+                radiation_model.setSourceFlux(source, "NIR", 400.0)
+                radiation_model.updateGeometry()
+                if together:
+                    radiation_model.runBand(["PAR", "NIR"])
+                else:
+                    radiation_model.runBand("PAR")
+                    radiation_model.runBand("NIR")
+                return radiation_model.getTotalAbsorbedFlux()
+        
+        with Context() as context:
+            context.addPatch(center=DataTypes.vec3(0, 0, 0), size=DataTypes.vec2(4, 4))
+            leaf = context.addPatch(center=DataTypes.vec3(0, 0, 1))
+            context.setPrimitiveDataFloat(leaf, "reflectivity_PAR", 0.1)
+            context.setPrimitiveDataFloat(leaf, "reflectivity_NIR", 0.45)
+            context.setPrimitiveDataFloat(leaf, "transmissivity_NIR", 0.4)
+            
+            assert run(context, together=True) == pytest.approx(run(context, together=False))
+    
+    def test_cpu_flux_superposition(self):
+        """Test that flux changes are applied from cached responses without re-running the band"""
+        with Context() as context:
+            context.addPatch(center=DataTypes.vec3(0, 0, 0), size=DataTypes.vec2(4, 4))
+            leaf = context.addPatch(center=DataTypes.vec3(0, 0, 1))
+            context.setPrimitiveDataFloat(leaf, "reflectivity_SW", 0.3)
+            
+            with RadiationModel(context, backend="cpu") as radiation_model:
+                radiation_model.disableMessages()
+                radiation_model.enableFluxSuperposition()
+                radiation_model.addRadiationBand("SW")
+                radiation_model.disableEmission("SW")
+                radiation_model.setScatteringDepth("SW", 2)
+                source = radiation_model.addCollimatedRadiationSource()
+                radiation_model.setSourceFlux(source, "SW", 1000.0)
+                radiation_model.setDiffuseRadiationFlux("SW", 100.0)
+                radiation_model.updateGeometry()
+                radiation_model.runBand("SW")
+                
+                first = radiation_model.getTotalAbsorbedFlux()
+                radiation_model.setSourceFlux(source, "SW", 0.0)
+                radiation_model.setDiffuseRadiationFlux("SW", 0.0)
+                assert radiation_model.getTotalAbsorbedFlux() == pytest.approx([0.0, 0.0], abs=1e-4)
+                
+                radiation_model.setSourceFlux(source, "SW", 1000.0)
+                radiation_model.setDiffuseRadiationFlux("SW", 100.0)
+                assert radiation_model.getTotalAbsorbedFlux() == pytest.approx(first, rel=1e-5)
+    
+    def test_cpu_view_factor_operator(self):
+        """Test that diffuse runs reuse the precomputed exchange operator"""
+        with Context() as context:
+            context.addPatch(center=DataTypes.vec3(0, 0, 0))
+            
+            with RadiationModel(context, backend="cpu") as radiation_model:
+                radiation_model.disableMessages()
+                radiation_model.addRadiationBand("SW")
+                radiation_model.disableEmission("SW")
+                radiation_model.enableViewFactorOperator(tolerance=1e-4, max_memory_mb=1.0)
+                radiation_model.updateGeometry()
+                assert radiation_model.getViewFactorOperatorInfo()["bytes"] == 0
+                
+                for diffuse in [100.0, 250.0]:
+                    radiation_model.setDiffuseRadiationFlux("SW", diffuse)
+                    radiation_model.runBand("SW")
+                    # An unobstructed horizontal patch sees the whole sky from its top face
+                    assert radiation_model.getTotalAbsorbedFlux()[0] == pytest.approx(diffuse, rel=1e-5)
+                
+                info = radiation_model.getViewFactorOperatorInfo()
+                assert 0 < info["bytes"] <= 1024 * 1024
+                assert info["nonzeros"] == 0
+    
+    def test_cpu_view_factor_operator_matches_tracing(self):
+        """Test that operator runs match traced runs between facing surfaces with scattering"""
+        with Context() as context:
+            ground = context.addPatch(center=DataTypes.vec3(0, 0, 0), size=DataTypes.vec2(4, 4))
+            upper = context.addPatch(center=DataTypes.vec3(0, 0, 1), size=DataTypes.vec2(4, 4))
+            context.setPrimitiveDataFloat(ground, "reflectivity_SW", 0.4)
+            context.setPrimitiveDataFloat(upper, "reflectivity_SW", 0.4)
+            context.setPrimitiveDataFloat(upper, "transmissivity_SW", 0.2)
+            
+            absorbed = {}
+            for use_operator in [False, True]:
+                with RadiationModel(context, backend="cpu") as radiation_model:
+                    radiation_model.disableMessages()
+                    radiation_model.addRadiationBand("SW")
+                    radiation_model.disableEmission("SW")
+                    radiation_model.setDiffuseRayCount("SW", 2000)
+                    radiation_model.setScatteringDepth("SW", 4)
+                    radiation_model.setDiffuseRadiationFlux("SW", 100.0)
+                    if use_operator:
+                        radiation_model.enableViewFactorOperator(tolerance=1e-4)
+                    radiation_model.updateGeometry()
+                    radiation_model.runBand("SW")
+                    absorbed[use_operator] = radiation_model.getTotalAbsorbedFlux()
+                    
+                    if use_operator:
+                        assert radiation_model.getViewFactorOperatorInfo()["nonzeros"] > 0
+                        # Later runs reuse the operator; with no emission the result scales with the flux
+                        radiation_model.setDiffuseRadiationFlux("SW", 200.0)
+                        radiation_model.runBand("SW")
+                        doubled = radiation_model.getTotalAbsorbedFlux()
+                        assert doubled[0] == pytest.approx(2 * absorbed[True][0], rel=1e-4)
+                        assert doubled[1] == pytest.approx(2 * absorbed[True][1], rel=1e-4)
+            
+            # Both estimates are Monte-Carlo; 2000 rays per face keeps them within a few percent
+            assert absorbed[True][0] == pytest.approx(absorbed[False][0], rel=0.05)
+            assert absorbed[True][1] == pytest.approx(absorbed[False][1], rel=0.05)
+    
+    def test_cpu_view_factor_operator_memory_cap(self):
+        """Test that a memory cap truncates the exchange operator to fit"""
+        with Context() as context:
+            context.addPatch(center=DataTypes.vec3(0, 0, 0), size=DataTypes.vec2(6, 6))
+            for i in range(8):
+                for j in range(8):
+                    leaf = context.addPatch(center=DataTypes.vec3(0.6 * i - 2.1, 0.6 * j - 2.1, 1 + 0.1 * ((i + j) % 3)),
+                                            size=DataTypes.vec2(0.4, 0.4))
+                    context.setPrimitiveDataFloat(leaf, "reflectivity_SW", 0.3)
+            
+            def build_operator(max_memory_mb):
+                with RadiationModel(context, backend="cpu") as radiation_model:
+                    radiation_model.disableMessages()
+                    radiation_model.addRadiationBand("SW")
+                    radiation_model.disableEmission("SW")
+                    radiation_model.setDiffuseRayCount("SW", 200)
+                    radiation_model.setScatteringDepth("SW", 2)
+                    radiation_model.setDiffuseRadiationFlux("SW", 100.0)
+                    radiation_model.enableViewFactorOperator(tolerance=1e-4, max_memory_mb=max_memory_mb)
+                    radiation_model.updateGeometry()
+                    radiation_model.runBand("SW")
+                    return radiation_model.getViewFactorOperatorInfo()
+            
+            full = build_operator(None)
+            assert full["nonzeros"] > 0
+            
+            cap_mb = full["bytes"] / 2 / (1024 * 1024)
+            capped = build_operator(cap_mb)
+            assert 0 < capped["bytes"] <= int(cap_mb * 1024 * 1024)
+            assert 0 < capped["nonzeros"] < full["nonzeros"]
+    
+    def test_cpu_adaptive_ray_count(self):
+        """Test that adaptive tracing reports the achieved error and respects the target"""
+        with Context() as context:
+            context.addPatch(center=DataTypes.vec3(0, 0, 0), size=DataTypes.vec2(4, 4))
+            context.addPatch(center=DataTypes.vec3(0.5, 0, 1))
+            
+            with RadiationModel(context, backend="cpu") as radiation_model:
+                radiation_model.disableMessages()
+                radiation_model.addRadiationBand("SW")
+                radiation_model.disableEmission("SW")
+                radiation_model.setDiffuseRayCount("SW", 50)
+                radiation_model.setDiffuseRadiationFlux("SW", 100.0)
+                radiation_model.setAdaptiveRayCount("SW", target_error=0.02, max_ray_count=100000)
+                radiation_model.updateGeometry()
+                radiation_model.runBand("SW")
+                
+                stats = radiation_model.getRadiationBandStats("SW")
+                assert stats["rounds"] >= 2
+                assert stats["diffuse_rays"] == 50 * stats["rounds"]
+                assert 0.0 <= stats["relative_error"] <= 0.02
+
+    def test_cpu_adaptive_ray_count_traces_diffuse_with_view_factors(self):
+        """Test that adaptive bands keep tracing diffuse radiation when the exchange operator is enabled"""
+        with Context() as context:
+            context.addPatch(center=DataTypes.vec3(0, 0, 0), size=DataTypes.vec2(4, 4))
+            context.addPatch(center=DataTypes.vec3(0.5, 0, 1))
+
+            with RadiationModel(context, backend="cpu") as radiation_model:
+                radiation_model.disableMessages()
+                radiation_model.addRadiationBand("SW")
+                radiation_model.disableEmission("SW")
+                radiation_model.setDiffuseRayCount("SW", 50)
+                radiation_model.setDiffuseRadiationFlux("SW", 100.0)
+                radiation_model.setAdaptiveRayCount("SW", target_error=0.02, max_ray_count=100000)
+                radiation_model.enableViewFactorOperator()
+                radiation_model.updateGeometry()
+                radiation_model.runBand("SW")
+
+                # The fixed operator would hide its sampling noise from the round-to-round error estimate
+                assert radiation_model.getViewFactorOperatorInfo()["nonzeros"] == 0
+                stats = radiation_model.getRadiationBandStats("SW")
+                assert stats["rounds"] >= 2
+                assert 0.0 <= stats["relative_error"] <= 0.02
+
+    def test_cpu_scattering_tolerance(self):
+        """Test that scattering stops once the residual falls below the tolerance"""
+        with Context() as context:
+            context.addPatch(center=DataTypes.vec3(0, 0, 0), size=DataTypes.vec2(4, 4))
+            leaf = context.addPatch(center=DataTypes.vec3(0, 0, 1))
+            context.setPrimitiveDataFloat(leaf, "reflectivity_NIR", 0.1)
+            
+            with RadiationModel(context, backend="cpu") as radiation_model:
+                radiation_model.disableMessages()
+                radiation_model.addRadiationBand("NIR")
+                radiation_model.disableEmission("NIR")
+                radiation_model.setScatteringDepth("NIR", 10)
+                radiation_model.setScatteringTolerance("NIR", 0.05)
+                source = radiation_model.addCollimatedRadiationSource()
+                radiation_model.setSourceFlux(source, "NIR", 1000.0)
+                radiation_model.updateGeometry()
+                radiation_model.runBand("NIR")
+                
+                stats = radiation_model.getRadiationBandStats("NIR")
+                # Black ground: only the leaf's 10% reflection is scattered, and it mostly reaches the ground
+                assert 1 <= stats["scattering_passes"] < 10
+                assert 0.0 <= stats["scattering_residual"] <= 0.05
+
+    def test_cpu_sunlit_fraction_cache(self):
+        """Test that direct flux served from the sunlit fraction cache matches tracing"""
+        with Context() as context:
+            ground = context.addPatch(center=DataTypes.vec3(0, 0, 0), size=DataTypes.vec2(4, 4))
+            leaf = context.addPatch(center=DataTypes.vec3(0, 0, 1))
+
+            with RadiationModel(context, backend="cpu") as radiation_model:
+                radiation_model.disableMessages()
+                radiation_model.addRadiationBand("SW")
+                radiation_model.disableEmission("SW")
+                radiation_model.setDirectRayCount("SW", 2000)
+                source = radiation_model.addCollimatedRadiationSource((0, 0, 1))
+                radiation_model.setSourceFlux(source, "SW", 1000.0)
+                radiation_model.updateGeometry()
+                radiation_model.runBand("SW")
+                traced = radiation_model.getTotalAbsorbedFlux()
+
+                radiation_model.precomputeSunlitFractions([(0.5, 0, 1), (0, 0, 1)], ray_count=2000)
+                assert radiation_model.getSunlitFractionBytes() >= 2 * 2
+                radiation_model.runBand("SW")
+                cached = radiation_model.getTotalAbsorbedFlux()
+
+                # The leaf sees the sun unobstructed; the ground is 1/16 shaded by the leaf
+                assert cached[1] == pytest.approx(1000.0, rel=1e-6)
+                assert cached[0] == pytest.approx(traced[0], rel=0.03)
+                assert cached[0] == pytest.approx(937.5, rel=0.03)
+
+                radiation_model.updateGeometry()
+                assert radiation_model.getSunlitFractionBytes() == 0
+
+    def test_cpu_async_run(self):
+        """Test that runBandAsync runs in the background, reports progress and can be cancelled"""
+        import time
+        import numpy as np
+        from pyhelios.wrappers import UCPURadiationModelWrapper as cpu_radiation_wrapper
+
+        with Context() as context:
+            patches = [context.addPatch(center=DataTypes.vec3(i * 0.5, 0, 0.1 * (i % 3)), size=DataTypes.vec2(0.4, 0.4))
+                       for i in range(20)]
+
+            with RadiationModel(context, backend="cpu") as radiation_model:
+                radiation_model.disableMessages()
+                radiation_model.addRadiationBand("SW")
+                radiation_model.disableEmission("SW")
+                radiation_model.setDiffuseRadiationFlux("SW", 100.0)
+                radiation_model.updateGeometry()
+
+                radiation_model.runBand("SW")
+                expected = radiation_model.getTotalAbsorbedFluxArray().copy()
+
+                # The Context stays usable during the run; flux data is written by wait() on this thread
+                for uuid in patches:
+                    context.setPrimitiveDataFloat(uuid, "radiation_flux_SW", -1.0)
+                job = radiation_model.runBandAsync("SW")
+                added = context.addPatch(center=DataTypes.vec3(0, 5, 0), size=DataTypes.vec2(0.4, 0.4))
+                assert job.wait(timeout=60.0)
+                assert job.done
+                assert job.progress == pytest.approx(1.0)
+                np.testing.assert_allclose(radiation_model.getTotalAbsorbedFluxArray()[:len(patches)], expected, rtol=1e-6)
+                np.testing.assert_allclose([context.getPrimitiveDataFloat(uuid, "radiation_flux_SW") for uuid in patches],
+                                           expected, rtol=1e-6)
+                assert not context.doesPrimitiveDataExist(added, "radiation_flux_SW")
+
+                # Native entry points refuse to touch the model until the job was waited for
+                job = radiation_model.runBandAsync("SW")
+                with pytest.raises(HeliosRuntimeError, match="still active"):
+                    cpu_radiation_wrapper.setDiffuseRadiationFlux(radiation_model.radiation_model, "SW", 50.0)
+                assert job.wait(timeout=60.0)
+                radiation_model.setDiffuseRadiationFlux("SW", 100.0)
+
+                # A run that finished without wait() is written by the next call on the model
+                for uuid in patches:
+                    context.setPrimitiveDataFloat(uuid, "radiation_flux_SW", -1.0)
+                job = radiation_model.runBandAsync("SW")
+                while not job.done:
+                    time.sleep(0.01)
+                radiation_model.getRadiationBandStats("SW")
+                assert context.getPrimitiveDataFloat(patches[0], "radiation_flux_SW") == pytest.approx(expected[0], rel=1e-6)
+
+                # A cancelled run reports its error on wait(), and the model stays usable
+                job = radiation_model.runBandAsync("SW")
+                job.cancel()
+                try:
+                    job.wait()
+                except RadiationModelError as e:
+                    assert "cancelled" in str(e)
+                assert job.done
+                radiation_model.runBand("SW")
+
+                # Bands are checked before the run starts
+                with pytest.raises(RadiationModelError, match="does not exist"):
+                    radiation_model.runBandAsync("missing")
+
+    def test_cpu_spectral_bands(self, tmp_path):
+        """Test that wavelength-bounded bands integrate reflectivity spectra weighted by the source spectrum"""
+        spectra = tmp_path / "spectra.xml"
+        spectra.write_text(
+            "<helios>\n"
+            "  <globaldata_vec2 label=\"leaf_reflectivity\">400 0 700 0.6</globaldata_vec2>\n"
+            "  <globaldata_vec2 label=\"blue_source\">400 1 500 1 500.001 0 800 0</globaldata_vec2>\n"
+            "</helios>\n")
+
+        with Context() as context:
+            context.loadXML(str(spectra), quiet=True)
+            patch = context.addPatch()
+            context.setPrimitiveDataString(patch, "reflectivity_spectrum", "leaf_reflectivity")
+
+            with RadiationModel(context, backend="cpu") as radiation_model:
+                radiation_model.disableMessages()
+                source = radiation_model.addCollimatedRadiationSource((0, 0, 1))
+                # Narrow bands share one cached integral table for the spectrum
+                for lo in (400, 450, 500, 550, 600, 650):
+                    label = f"B{lo}"
+                    radiation_model.addRadiationBand(label, lo, lo + 50)
+                    radiation_model.disableEmission(label)
+                    radiation_model.setSourceFlux(source, label, 100.0)
+                radiation_model.updateGeometry()
+
+                # Flat source: absorbed = flux * (1 - mean reflectivity over the band)
+                radiation_model.runBand(["B400", "B650"])
+                flux = radiation_model.getAbsorbedFluxByBand(["B400", "B650"])
+                assert flux[0][0] == pytest.approx(100.0 * (1.0 - 0.05), rel=1e-4)
+                assert flux[1][0] == pytest.approx(100.0 * (1.0 - 0.55), rel=1e-4)
+
+                # Source spectrum weighting: 400-700 nm sees only the 400-500 nm part
+                radiation_model.addRadiationBand("PAR", 400, 700)
+                radiation_model.disableEmission("PAR")
+                radiation_model.setSourceFlux(source, "PAR", 100.0)
+                radiation_model.setSourceSpectrum(source, "blue_source")
+                radiation_model.runBand("PAR")
+                assert radiation_model.getAbsorbedFluxByBand(["PAR"])[0][0] == pytest.approx(100.0 * (1.0 - 0.1), rel=1e-3)
+
+                # Cached tables are checked against the global data at the start of each run
+                updated = tmp_path / "updated.xml"
+                updated.write_text("<helios>\n  <globaldata_vec2 label=\"leaf_reflectivity\">400 0.5 700 0.5</globaldata_vec2>\n</helios>\n")
+                context.loadXML(str(updated), quiet=True)
+                radiation_model.runBand("B400")
+                assert radiation_model.getAbsorbedFluxByBand(["B400"])[0][0] == pytest.approx(100.0 * (1.0 - 0.5), rel=1e-4)
+
+                with pytest.raises(HeliosRuntimeError):
+                    radiation_model.setSourceSpectrum(source, "missing_spectrum")
+
+    def test_cpu_aggregate_absorbed_flux(self):
+        """Test grouped absorbed flux sums against the per-primitive flux"""
+        with Context() as context:
+            small = context.addPatch(center=DataTypes.vec3(0, 0, 0), size=DataTypes.vec2(1, 1))
+            large = context.addPatch(center=DataTypes.vec3(3, 0, 0), size=DataTypes.vec2(2, 1))
+            lone = context.addPatch(center=DataTypes.vec3(6, 0, 0), size=DataTypes.vec2(1, 1))
+
+            with RadiationModel(context, backend="cpu") as radiation_model:
+                radiation_model.disableMessages()
+                radiation_model.addRadiationBand("SW")
+                radiation_model.disableEmission("SW")
+                source = radiation_model.addCollimatedRadiationSource((0, 0, 1))
+                radiation_model.setSourceFlux(source, "SW", 1000.0)
+                radiation_model.updateGeometry([small, large])
+                radiation_model.runBand("SW")
+
+                result = radiation_model.aggregateAbsorbedFlux("SW", [0, 0, 1], uuids=[small, large, lone])
+                assert result["power"] == pytest.approx([3000.0, 0.0], rel=1e-4)
+                assert result["area"] == pytest.approx([3.0, 0.0], rel=1e-4)
+                assert result["mean_flux"] == pytest.approx([1000.0, 0.0], rel=1e-4)
+
+                # Patches added directly do not belong to an object
+                by_object = radiation_model.aggregateAbsorbedFluxByObject("SW")
+                assert len(by_object["object_ids"]) == 0
+
+                with pytest.raises(ValueError):
+                    radiation_model.aggregateAbsorbedFlux("SW", [0, 1], uuids=[small, large, lone])
+
+    def test_cpu_periodic_boundary(self):
+        """Test that a shadow leaving the domain re-enters from the opposite side"""
+        with Context() as context:
+            context.addPatch(center=DataTypes.vec3(0, 0, 0), size=DataTypes.vec2(2, 2))
+            context.addPatch(center=DataTypes.vec3(0.5, 0, 1), size=DataTypes.vec2(1, 2))
+
+            with RadiationModel(context, backend="cpu") as radiation_model:
+                radiation_model.disableMessages()
+                radiation_model.addRadiationBand("SW")
+                radiation_model.disableEmission("SW")
+                radiation_model.setDirectRayCount("SW", 4000)
+                source = radiation_model.addCollimatedRadiationSource((-1, 0, 1))
+                radiation_model.setSourceFlux(source, "SW", 1000.0)
+                radiation_model.updateGeometry()
+
+                # The strip's shadow falls beside the ground tile, unless it wraps around in x
+                radiation_model.runBand("SW")
+                assert radiation_model.getTotalAbsorbedFlux()[0] == pytest.approx(707.1, rel=1e-3)
+
+                radiation_model.enforcePeriodicBoundary("x")
+                radiation_model.runBand("SW")
+                assert radiation_model.getTotalAbsorbedFlux()[0] == pytest.approx(353.6, rel=0.05)
+
+                radiation_model.enforcePeriodicBoundary("")
+                radiation_model.runBand("SW")
+                assert radiation_model.getTotalAbsorbedFlux()[0] == pytest.approx(707.1, rel=1e-3)
+
+                with pytest.raises(ValueError):
+                    radiation_model.enforcePeriodicBoundary("z")
+
+    def test_cpu_camera_images(self):
+        """Test that CPU cameras see reflected exitance and re-render identically in a batch or in tiles"""
+        import numpy as np
+        from pyhelios import CameraProperties
+        with Context() as context:
+            ground = context.addPatch(center=DataTypes.vec3(0, 0, 0), size=DataTypes.vec2(10, 10))
+            context.setPrimitiveDataFloat(ground, "reflectivity_SW", 0.3)
+
+            with RadiationModel(context, backend="cpu") as radiation_model:
+                radiation_model.disableMessages()
+                radiation_model.addRadiationBand("SW")
+                radiation_model.disableEmission("SW")
+                radiation_model.setScatteringDepth("SW", 1)
+                source = radiation_model.addCollimatedRadiationSource()
+                radiation_model.setSourceFlux(source, "SW", 1000.0)
+                properties = CameraProperties(camera_resolution=(32, 24), lens_diameter=0.0, HFOV=60.0)
+                radiation_model.addRadiationCamera("down", ["SW"], DataTypes.vec3(0, 0, 5), DataTypes.vec3(0, 0, 0),
+                                                   properties, antialiasing_samples=1)
+                radiation_model.addRadiationCamera("side", ["SW"], DataTypes.vec3(0, -10, 3), DataTypes.vec3(0, 0, 0),
+                                                   properties, antialiasing_samples=4)
+                radiation_model.updateGeometry()
+                radiation_model.runBand("SW")
+
+                down = radiation_model.getCameraImage("down", "SW")
+                assert down.shape == (24, 32)
+                assert down[12, 16] == pytest.approx(300.0, rel=1e-4)
+
+                side = radiation_model.getCameraImage("side", "SW")
+                radiation_model.renderCameras(["side"])
+                assert (radiation_model.getCameraImage("side", "SW") == side).all()
+
+                with pytest.raises(RadiationModelError):
+                    radiation_model.getCameraImage("missing", "SW")
+
+                # Tiles that do not divide the frame reassemble into the full-frame image
+                tiled = np.full(side.shape, -1.0, dtype=np.float32)
+
+                def write_tile(band, x0, y0, pixels):
+                    assert band == "SW"
+                    tiled[y0:y0 + pixels.shape[0], x0:x0 + pixels.shape[1]] = pixels
+
+                radiation_model.renderCameraTiles("side", write_tile, tile_size=(10, 7))
+                assert (tiled == side).all()
+
+                def failing_writer(band, x0, y0, pixels):
+                    raise IOError("disk full")
+
+                with pytest.raises(IOError):
+                    radiation_model.renderCameraTiles("side", failing_writer)
+
+    def test_cpu_tiled_only_camera(self):
+        """Test that runBand never renders a tiled-only camera into memory"""
+        import numpy as np
+        from pyhelios import CameraProperties
+        with Context() as context:
+            ground = context.addPatch(center=DataTypes.vec3(0, 0, 0), size=DataTypes.vec2(10, 10))
+            context.setPrimitiveDataFloat(ground, "reflectivity_SW", 0.3)
+
+            with RadiationModel(context, backend="cpu") as radiation_model:
+                radiation_model.disableMessages()
+                radiation_model.addRadiationBand("SW")
+                radiation_model.disableEmission("SW")
+                radiation_model.setScatteringDepth("SW", 1)
+                source = radiation_model.addCollimatedRadiationSource()
+                radiation_model.setSourceFlux(source, "SW", 1000.0)
+                properties = CameraProperties(camera_resolution=(32, 24), lens_diameter=0.0, HFOV=60.0)
+                radiation_model.addRadiationCamera("full", ["SW"], DataTypes.vec3(0, 0, 5), DataTypes.vec3(0, 0, 0),
+                                                   properties, antialiasing_samples=1)
+                radiation_model.addRadiationCamera("tiled", ["SW"], DataTypes.vec3(0, 0, 5), DataTypes.vec3(0, 0, 0),
+                                                   properties, antialiasing_samples=1)
+                radiation_model.setCameraTiledOnly("tiled")
+                radiation_model.updateGeometry()
+                radiation_model.runBand("SW")
+
+                # The tiled camera holds no pixels after the run; the other camera was rendered as usual
+                full = radiation_model.getCameraImage("full", "SW")
+                with pytest.raises(RadiationModelError):
+                    radiation_model.getCameraImage("tiled", "SW")
+
+                # Batch rendering of all cameras skips it, and naming it explicitly is an error
+                radiation_model.renderCameras()
+                with pytest.raises(RadiationModelError):
+                    radiation_model.getCameraImage("tiled", "SW")
+                with pytest.raises(HeliosRuntimeError):
+                    radiation_model.renderCameras(["tiled"])
+
+                tiled = np.full(full.shape, -1.0, dtype=np.float32)
+
+                def write_tile(band, x0, y0, pixels):
+                    tiled[y0:y0 + pixels.shape[0], x0:x0 + pixels.shape[1]] = pixels
+
+                radiation_model.renderCameraTiles("tiled", write_tile, tile_size=(8, 8))
+                assert (tiled == full).all()
+
+                with pytest.raises(RadiationModelError):
+                    radiation_model.setCameraTiledOnly("missing")
+
+    def test_cpu_backend_rejects_cameras(self):
+        """Test that camera features raise on the CPU backend"""
+        with Context() as context:
+            with RadiationModel(context, backend="cpu") as radiation_model:
+                with pytest.raises(RadiationModelError):
+                    radiation_model.writeCameraImage("camera", ["SW"], "image")
+    
+    @pytest.mark.cross_platform
+    def test_invalid_backend(self):
+        """Test that an unknown backend name is rejected"""
+        with Context() as context:
+            with pytest.raises(ValueError):
+                RadiationModel(context, backend="vulkan")
+
+
+@pytest.mark.cross_platform
+class TestCOCOAnnotationWriter:
+    """Test the streaming COCO annotation writer"""
+
+    def test_append_frames(self, tmp_path):
+        """Test that frames appended across writers produce one valid COCO file"""
+        import json
+        from pyhelios.RadiationModel import COCOAnnotationWriter
+
+        frame = {"width": 4, "height": 3, "annotations": [
+            {"category_id": 1, "segmentation": {"size": [3, 4], "counts": [1, 1, 10]},
+             "area": 1, "bbox": [0, 1, 1, 1], "iscrowd": 0}
+        ]}
+        filename = tmp_path / "annotations.json"
+
+        with COCOAnnotationWriter(filename, categories={1: "leaf"}) as writer:
+            assert writer.addFrame("image_0.jpeg", frame) == 1
+        with COCOAnnotationWriter(filename, append=True) as writer:
+            assert writer.addFrame("image_1.jpeg", frame) == 2
+
+        with open(filename) as f:
+            coco = json.load(f)
+        assert [image["file_name"] for image in coco["images"]] == ["image_0.jpeg", "image_1.jpeg"]
+        assert [annotation["id"] for annotation in coco["annotations"]] == [1, 2]
+        assert [annotation["image_id"] for annotation in coco["annotations"]] == [1, 2]
+        assert coco["categories"] == [{"id": 1, "name": "leaf"}]
+
+        other = tmp_path / "other.json"
+        other.write_text('{"images": []}')
+        with pytest.raises(ValueError):
+            COCOAnnotationWriter(other, append=True)
+
 
 @pytest.mark.native_only
 class TestContextPseudocolor:
@@ -518,6 +1154,47 @@ class TestRadiationModelCameraFunctions:
                     frame=-1
                 )
     
+    def test_getCameraImage(self, radiation_model_with_camera):
+        """Test in-memory camera image retrieval"""
+        import numpy as np
+        radiation_model, context = radiation_model_with_camera
+
+        image = radiation_model.getCameraImage("test_camera", "red")
+        assert image.shape == (512, 512)
+        assert image.dtype == np.float32
+
+        rgb = radiation_model.getCameraImageRGB("test_camera", ["red", "red", "red"], normalize=True)
+        assert rgb.shape == (512, 512, 3)
+        assert rgb.min() >= 0.0 and rgb.max() <= 1.0
+
+        rgb8 = radiation_model.getCameraImageRGB("test_camera", ["red", "red", "red"], normalize=True, dtype="uint8")
+        assert rgb8.dtype == np.uint8
+        assert np.array_equal(rgb8, np.floor(rgb * 255 + 0.5).astype(np.uint8))
+
+        with pytest.raises(ValueError):
+            radiation_model.getCameraImageRGB("test_camera", ["red", "red"])
+        with pytest.raises(RadiationModelError):
+            radiation_model.getCameraImage("missing_camera", "red")
+    
+    def test_getImageAnnotations(self, radiation_model_with_camera):
+        """Test in-memory bounding boxes and RLE segmentation masks"""
+        radiation_model, context = radiation_model_with_camera
+
+        boxes = radiation_model.getImageBoundingBoxes("test_camera", primitive_data_label="leaves")
+        masks = radiation_model.getImageSegmentationMasks("test_camera", primitive_data_label="leaves")
+        assert boxes.shape[1] == 6
+        assert sorted(masks.keys()) == sorted(boxes[:, 0].tolist())
+        for value, xmin, ymin, xmax, ymax, area in boxes.tolist():
+            counts = masks[value]
+            assert int(counts.sum()) == 512 * 512
+            assert int(counts[1::2].sum()) == area
+            assert xmin <= xmax and ymin <= ymax
+
+        frame = radiation_model.getImageAnnotations("test_camera", primitive_data_labels=["leaves", "trunk"],
+                                                    object_class_ids=[1, 3])
+        assert (frame["width"], frame["height"]) == (512, 512)
+        assert {annotation["category_id"] for annotation in frame["annotations"]} <= {1, 3}
+
     def test_writeImageBoundingBoxes_single_primitive(self, radiation_model_with_camera):
         """Test writing image bounding boxes with single primitive data label"""
         radiation_model, context = radiation_model_with_camera
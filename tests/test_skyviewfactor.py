@@ -131,6 +131,41 @@ class TestSkyViewFactorModel(unittest.TestCase):
             self.assertGreaterEqual(svf, 0.0)
             self.assertLessEqual(svf, 1.0)
     
+    def test_chunked_calculation_progress(self):
+        """Test chunked calculation reports progress and matches point count."""
+        points = np.array([(0.1 * i, 0.0, 0.0) for i in range(25)], dtype=np.float32)
+        progress = []
+
+        svfs = self.model.calculate_sky_view_factors_chunked(
+            points, chunk_size=10, progress_callback=lambda done, total: progress.append((done, total))
+        )
+
+        self.assertEqual(len(svfs), len(points))
+        self.assertEqual(progress, [(10, 25), (20, 25), (25, 25)])
+        self.assertTrue(np.all((svfs >= 0.0) & (svfs <= 1.0)))
+
+    def test_parallel_cpu_calculation(self):
+        """Test multithreaded CPU calculation is reproducible across thread counts."""
+        self.context.addTriangle(
+            (-1.0, -1.0, 1.0),
+            (1.0, -1.0, 1.0),
+            (0.0, 1.0, 1.0)
+        )
+        self.model.set_ray_count(200)
+        points = [(0.1 * i, 0.0, 0.0) for i in range(50)]
+
+        svfs_single = self.model.calculate_sky_view_factors_parallel_cpu(points, num_threads=1, seed=7)
+        svfs_multi = self.model.calculate_sky_view_factors_parallel_cpu(points, num_threads=4, seed=7)
+
+        self.assertEqual(len(svfs_single), len(points))
+        self.assertEqual(svfs_single, svfs_multi)
+        for svf in svfs_single:
+            self.assertGreaterEqual(svf, 0.0)
+            self.assertLessEqual(svf, 1.0)
+
+        # Point directly beneath the triangle sees less sky than one far from it
+        self.assertLess(svfs_single[0], svfs_single[-1])
+
     def test_empty_points_list(self):
         """Test calculation with empty points list."""
         svfs = self.model.calculate_sky_view_factors([])